@@ -0,0 +1,28 @@
+#pragma once
+#include "core/Window.hpp"
+#include "graphics/Renderer.hpp"
+#include <memory>
+
+// Shared headless GL context for benchmarks that need one. Tries EGL
+// surfaceless first (no display server), then a hidden GLFW window; the
+// Renderer is initialized once and lives until the process exits.
+namespace BenchContext {
+
+inline bool AcquireRenderer() {
+    static std::unique_ptr<Window> window;
+    static bool attempted = false;
+    if (attempted) return window != nullptr;
+    attempted = true;
+
+    for (Window::Mode mode : { Window::Mode::Surfaceless, Window::Mode::Hidden }) {
+        auto candidate = std::make_unique<Window>();
+        if (candidate->Init({ "Benchmark", 1280, 720, false, false, mode })) {
+            window = std::move(candidate);
+            Renderer::getInstance().Init();
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace BenchContext
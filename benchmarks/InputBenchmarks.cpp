@@ -0,0 +1,37 @@
+#include <benchmark/benchmark.h>
+#include "core/Input.hpp"
+#include "core/Window.hpp"
+#include <string>
+
+// Input::Update walks every key, button and action each frame; no window is
+// needed for that, so this runs with Window::Mode::None
+static void BM_InputUpdate(benchmark::State& state) {
+    Window window;
+    window.Init({ "Benchmark", 1, 1, false, false, Window::Mode::None });
+    Input input(&window);
+
+    const int actionCount = static_cast<int>(state.range(0));
+    for (int i = 0; i < actionCount; ++i) {
+        input.MapAction("Action" + std::to_string(i), { GLFW_KEY_A + (i % 26), GLFW_KEY_SPACE });
+    }
+
+    for (auto _ : state) {
+        input.Update();
+        benchmark::DoNotOptimize(input.IsActionActive("Action0"));
+    }
+}
+BENCHMARK(BM_InputUpdate)->Arg(5)->Arg(64);
+
+static void BM_InputIsActionActive(benchmark::State& state) {
+    Window window;
+    window.Init({ "Benchmark", 1, 1, false, false, Window::Mode::None });
+    Input input(&window);
+    input.MapAction("Jump", { GLFW_KEY_SPACE });
+    input.MapAction("MoveLeft", { GLFW_KEY_A, GLFW_KEY_LEFT });
+    input.MapAction("MoveRight", { GLFW_KEY_D, GLFW_KEY_RIGHT });
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(input.IsActionActive("MoveRight"));
+    }
+}
+BENCHMARK(BM_InputIsActionActive);
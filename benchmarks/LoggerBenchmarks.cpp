@@ -0,0 +1,60 @@
+#include <benchmark/benchmark.h>
+#include "core/Logger.hpp"
+#include <cstdio>
+#include <string>
+
+namespace {
+
+// Logs go to a scratch file so they do not interleave with benchmark output
+std::FILE* GetNullStream() {
+    static std::FILE* stream = std::tmpfile();
+    return stream;
+}
+
+void RestartLogger(bool async) {
+    Logger::Shutdown();
+    Logger::Config config;
+    config.Async = async;
+    config.Overflow = LogOverflowPolicy::Block;
+    config.Output = GetNullStream();
+    Logger::Init(config);
+}
+
+} // namespace
+
+// Caller-side cost: encode the record and push it into the thread's ring
+static void BM_LoggerLogAsync(benchmark::State& state) {
+    RestartLogger(true);
+    const std::string name = "player";
+    int frame = 0;
+    for (auto _ : state) {
+        LOG_INFO("Entity {} moved to ({:.1f}, {:.1f}) on frame {}", name, 12.5f, 48.0f, ++frame);
+    }
+    Logger::Flush();
+    Logger::Shutdown();
+}
+BENCHMARK(BM_LoggerLogAsync);
+
+// Full path on the calling thread: encode, format into the line buffer, write
+static void BM_LoggerFormatSync(benchmark::State& state) {
+    RestartLogger(false);
+    const std::string name = "player";
+    int frame = 0;
+    for (auto _ : state) {
+        LOG_INFO("Entity {} moved to ({:.1f}, {:.1f}) on frame {}", name, 12.5f, 48.0f, ++frame);
+    }
+    Logger::Shutdown();
+}
+BENCHMARK(BM_LoggerFormatSync);
+
+// Formats only known at runtime are copied into the record and parsed by the writer
+static void BM_LoggerLogRuntimeFormat(benchmark::State& state) {
+    RestartLogger(true);
+    const std::string format = "Loaded {} in {:.2f} ms";
+    for (auto _ : state) {
+        Logger::Log(LogLevel::Info, format, "texture.png", 1.25);
+    }
+    Logger::Flush();
+    Logger::Shutdown();
+}
+BENCHMARK(BM_LoggerLogRuntimeFormat);
@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+#include "core/JobSystem.hpp"
+#include "graphics/ParticleSystem.hpp"
+#include "graphics/RenderQueue.hpp"
+
+namespace {
+
+// A pool kept near range(0) live particles: each frame replaces what expired
+ParticleEmitter::Properties FountainProperties(size_t count) {
+    ParticleEmitter::Properties props;
+    props.MaxParticles = count;
+    props.Lifetime = 2.0f;
+    props.LifetimeVariation = 1.0f;
+    props.Velocity = glm::vec2(0.0f, 300.0f);
+    props.VelocityVariation = glm::vec2(150.0f, 100.0f);
+    props.Drag = 0.2f;
+    return props;
+}
+
+} // namespace
+
+// One 60 Hz update; range(1) selects single-threaded (0) or the job system (1)
+static void BM_ParticleUpdate(benchmark::State& state) {
+    JobSystem& jobs = JobSystem::getInstance();
+    if (state.range(1)) jobs.Init();
+
+    const size_t count = static_cast<size_t>(state.range(0));
+    ParticleEmitter emitter(FountainProperties(count));
+    emitter.Emit(count, glm::vec2(0.0f));
+
+    for (auto _ : state) {
+        emitter.Emit(count - emitter.GetCount(), glm::vec2(0.0f));
+        emitter.Update(1.0f / 60.0f);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+    if (state.range(1)) jobs.Shutdown();
+}
+BENCHMARK(BM_ParticleUpdate)
+    ->Args({ 10000, 0 })->Args({ 200000, 0 })->Args({ 200000, 1 })
+    ->Unit(benchmark::kMicrosecond);
+
+// Building one emitter's instance data and queueing its single draw
+static void BM_ParticleSubmit(benchmark::State& state) {
+    JobSystem& jobs = JobSystem::getInstance();
+    if (state.range(1)) jobs.Init();
+
+    const size_t count = static_cast<size_t>(state.range(0));
+    ParticleEmitter emitter(FountainProperties(count));
+    emitter.Emit(count, glm::vec2(0.0f));
+    RenderQueue queue;
+
+    for (auto _ : state) {
+        queue.Reset();
+        emitter.Submit(queue, 0);
+        benchmark::DoNotOptimize(queue.GetCommandCount());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+    if (state.range(1)) jobs.Shutdown();
+}
+BENCHMARK(BM_ParticleSubmit)
+    ->Args({ 200000, 0 })->Args({ 200000, 1 })
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+#include "core/JobSystem.hpp"
+#include "physics/PhysicsWorld.hpp"
+#include <random>
+
+namespace {
+
+// A 4096 x 2048 level: ground, walls, and rows of solid and one-way platforms
+void BuildLevel(PhysicsWorld& world) {
+    world.AddStatic({ { 0.0f, -64.0f }, { 4096.0f, 0.0f } });
+    world.AddStatic({ { -64.0f, 0.0f }, { 0.0f, 2048.0f } });
+    world.AddStatic({ { 4096.0f, 0.0f }, { 4160.0f, 2048.0f } });
+    for (int row = 1; row < 8; ++row) {
+        for (int column = 0; column < 16; ++column) {
+            const float x = column * 256.0f + (row % 2) * 128.0f;
+            const float y = row * 256.0f;
+            world.AddStatic({ { x, y }, { x + 96.0f, y + 16.0f } },
+                            column % 3 == 0 ? StaticType::OneWay : StaticType::Solid);
+        }
+    }
+}
+
+void SpawnBodies(PhysicsWorld& world, int count) {
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<float> x(16.0f, 4080.0f);
+    std::uniform_real_distribution<float> y(16.0f, 2000.0f);
+    std::uniform_real_distribution<float> speed(-200.0f, 200.0f);
+    for (int i = 0; i < count; ++i) {
+        world.CreateBody({ { x(random), y(random) }, { 6.0f, 8.0f }, { speed(random), 0.0f } });
+    }
+}
+
+} // namespace
+
+// One 60 Hz step; range(1) selects single-threaded (0) or the job system (1)
+static void BM_PhysicsStep(benchmark::State& state) {
+    JobSystem& jobs = JobSystem::getInstance();
+    if (state.range(1)) jobs.Init();
+
+    PhysicsWorld world;
+    BuildLevel(world);
+    SpawnBodies(world, static_cast<int>(state.range(0)));
+
+    // Let the bodies settle onto platforms first
+    for (int i = 0; i < 60; ++i) {
+        world.Step(1.0f / 60.0f);
+    }
+
+    for (auto _ : state) {
+        world.Step(1.0f / 60.0f);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+    if (state.range(1)) jobs.Shutdown();
+}
+BENCHMARK(BM_PhysicsStep)
+    ->Args({ 1000, 0 })->Args({ 5000, 0 })->Args({ 10000, 0 })->Args({ 100000, 0 })
+    ->Args({ 10000, 1 })
+    ->Unit(benchmark::kMicrosecond);
+
+// Pair generation over settled bodies; range(1) is the BroadphaseType
+static void BM_BroadphaseFindPairs(benchmark::State& state) {
+    PhysicsWorld::Properties props;
+    props.Broadphase = static_cast<BroadphaseType>(state.range(1));
+    PhysicsWorld world(props);
+    BuildLevel(world);
+    SpawnBodies(world, static_cast<int>(state.range(0)));
+    for (int i = 0; i < 60; ++i) {
+        world.Step(1.0f / 60.0f);
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(world.FindBodyPairs().size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BroadphaseFindPairs)
+    ->Args({ 10000, static_cast<int>(BroadphaseType::SpatialHash) })
+    ->Args({ 10000, static_cast<int>(BroadphaseType::AABBTree) })
+    ->Unit(benchmark::kMicrosecond);
+
+// A screen-sized region query, as camera culling would issue
+static void BM_BroadphaseQueryRegion(benchmark::State& state) {
+    PhysicsWorld::Properties props;
+    props.Broadphase = static_cast<BroadphaseType>(state.range(1));
+    PhysicsWorld world(props);
+    BuildLevel(world);
+    SpawnBodies(world, static_cast<int>(state.range(0)));
+
+    const AABB view{ { 1024.0f, 512.0f }, { 2304.0f, 1232.0f } };
+    for (auto _ : state) {
+        size_t found = 0;
+        world.QueryRegion(view, [&found](BodyId) { ++found; });
+        benchmark::DoNotOptimize(found);
+    }
+}
+BENCHMARK(BM_BroadphaseQueryRegion)
+    ->Args({ 10000, static_cast<int>(BroadphaseType::SpatialHash) })
+    ->Args({ 10000, static_cast<int>(BroadphaseType::AABBTree) })
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,131 @@
+#include <benchmark/benchmark.h>
+#include "physics/PhysicsKernels.hpp"
+#include <random>
+#include <vector>
+
+// Each kernel at 1k/10k/100k bodies; range(1) is the SimdLevel, so the
+// speedup over Scalar reads straight off the results
+
+namespace {
+
+std::vector<float> RandomFloats(size_t count, float min, float max, uint32_t seed) {
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<float> distribution(min, max);
+    std::vector<float> values(count);
+    for (float& value : values) {
+        value = distribution(random);
+    }
+    return values;
+}
+
+// Forces the benchmark's level; false (and the run skipped) if the CPU lacks it
+bool SelectLevel(benchmark::State& state) {
+    const SimdLevel level = static_cast<SimdLevel>(state.range(1));
+    if (PhysicsKernels::SetActiveLevel(level) != level) {
+        state.SkipWithError("SIMD level not supported by this CPU");
+        return false;
+    }
+    state.SetLabel(PhysicsKernels::GetLevelName(level));
+    return true;
+}
+
+void RestoreLevel() {
+    PhysicsKernels::SetActiveLevel(PhysicsKernels::GetSupportedLevel());
+}
+
+void KernelArgs(benchmark::internal::Benchmark* benchmark) {
+    for (int64_t count : { 1000, 10000, 100000 }) {
+        for (SimdLevel level : { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2 }) {
+            benchmark->Args({ count, static_cast<int64_t>(level) });
+        }
+    }
+}
+
+} // namespace
+
+static void BM_KernelIntegrateVelocities(benchmark::State& state) {
+    if (!SelectLevel(state)) return;
+
+    const size_t count = static_cast<size_t>(state.range(0));
+    std::vector<float> velocityX = RandomFloats(count, -200.0f, 200.0f, 1);
+    std::vector<float> velocityY = RandomFloats(count, -200.0f, 200.0f, 2);
+    const std::vector<float> gravityScale = RandomFloats(count, 0.5f, 1.5f, 3);
+
+    for (auto _ : state) {
+        PhysicsKernels::IntegrateVelocities(velocityX.data(), velocityY.data(), gravityScale.data(), count,
+                                            glm::vec2(0.0f, -980.0f / 60.0f), 2000.0f);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    RestoreLevel();
+}
+BENCHMARK(BM_KernelIntegrateVelocities)->Apply(KernelArgs);
+
+static void BM_KernelIntegratePositions(benchmark::State& state) {
+    if (!SelectLevel(state)) return;
+
+    const size_t count = static_cast<size_t>(state.range(0));
+    std::vector<float> positionX = RandomFloats(count, 0.0f, 4096.0f, 1);
+    std::vector<float> positionY = RandomFloats(count, 0.0f, 2048.0f, 2);
+    const std::vector<float> velocityX = RandomFloats(count, -200.0f, 200.0f, 3);
+    const std::vector<float> velocityY = RandomFloats(count, -200.0f, 200.0f, 4);
+
+    for (auto _ : state) {
+        PhysicsKernels::IntegratePositions(positionX.data(), positionY.data(), velocityX.data(), velocityY.data(),
+                                           count, 1.0f / 60.0f);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    RestoreLevel();
+}
+BENCHMARK(BM_KernelIntegratePositions)->Apply(KernelArgs);
+
+// One box against every box in the arrays, ~1% of them overlapping
+static void BM_KernelFindOverlaps(benchmark::State& state) {
+    if (!SelectLevel(state)) return;
+
+    const size_t count = static_cast<size_t>(state.range(0));
+    const std::vector<float> minX = RandomFloats(count, 0.0f, 4096.0f, 1);
+    const std::vector<float> minY = RandomFloats(count, 0.0f, 2048.0f, 2);
+    std::vector<float> maxX = minX;
+    std::vector<float> maxY = minY;
+    for (size_t i = 0; i < count; ++i) {
+        maxX[i] += 12.0f;
+        maxY[i] += 16.0f;
+    }
+    std::vector<uint32_t> indices(count);
+    const AABB box{ { 1024.0f, 512.0f }, { 1424.0f, 712.0f } };
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(PhysicsKernels::FindOverlaps(box, minX.data(), minY.data(), maxX.data(), maxY.data(),
+                                                              count, indices.data()));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    RestoreLevel();
+}
+BENCHMARK(BM_KernelFindOverlaps)->Apply(KernelArgs);
+
+// Camera culling: a 1280x720 view over a 4096x2048 level, ~11% visible
+static void BM_KernelOverlapMask(benchmark::State& state) {
+    if (!SelectLevel(state)) return;
+
+    const size_t count = static_cast<size_t>(state.range(0));
+    const std::vector<float> minX = RandomFloats(count, 0.0f, 4096.0f, 1);
+    const std::vector<float> minY = RandomFloats(count, 0.0f, 2048.0f, 2);
+    std::vector<float> maxX = minX;
+    std::vector<float> maxY = minY;
+    for (size_t i = 0; i < count; ++i) {
+        maxX[i] += 12.0f;
+        maxY[i] += 16.0f;
+    }
+    std::vector<uint32_t> mask(PhysicsKernels::GetMaskWordCount(count));
+    const AABB view{ { 1000.0f, 600.0f }, { 2280.0f, 1320.0f } };
+
+    for (auto _ : state) {
+        PhysicsKernels::OverlapMask(view, minX.data(), minY.data(), maxX.data(), maxY.data(), count, mask.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    RestoreLevel();
+}
+BENCHMARK(BM_KernelOverlapMask)->Apply(KernelArgs);
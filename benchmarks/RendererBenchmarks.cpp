@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+#include "BenchContext.hpp"
+#include "graphics/Mesh.hpp"
+#include "graphics/Renderer.hpp"
+#include "graphics/Texture.hpp"
+#include <glad/glad.h>
+#include <vector>
+
+// Each iteration is one frame: record the quads, flush the batch and wait
+// for the driver, so results cover CPU submission and (software) rasterization
+static void BM_RendererDrawRectangle(benchmark::State& state) {
+    if (!BenchContext::AcquireRenderer()) {
+        state.SkipWithError("No headless GL context");
+        return;
+    }
+
+    Renderer& renderer = Renderer::getInstance();
+    const int quadCount = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        renderer.BeginFrame();
+        renderer.BeginScene();
+        for (int i = 0; i < quadCount; ++i) {
+            renderer.DrawRectangle({ static_cast<float>(i % 1280), static_cast<float>((i / 1280) % 720) },
+                                   { 4.0f, 4.0f }, { 1.0f, 0.0f, 0.0f, 1.0f });
+        }
+        renderer.EndScene();
+        glFinish();
+    }
+    state.SetItemsProcessed(state.iterations() * quadCount);
+}
+BENCHMARK(BM_RendererDrawRectangle)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+static void BM_RendererDrawTexturedRectangle(benchmark::State& state) {
+    if (!BenchContext::AcquireRenderer()) {
+        state.SkipWithError("No headless GL context");
+        return;
+    }
+
+    // Alternate two textures so batching has to break on texture changes
+    const std::vector<unsigned char> pixels(32 * 32 * 4, 200);
+    Texture textures[2];
+    textures[0].LoadFromMemory(pixels.data(), 32, 32, 4);
+    textures[1].LoadFromMemory(pixels.data(), 32, 32, 4);
+
+    Renderer& renderer = Renderer::getInstance();
+    const int quadCount = static_cast<int>(state.range(0));
+    const int runLength = static_cast<int>(state.range(1));
+    for (auto _ : state) {
+        renderer.BeginFrame();
+        renderer.BeginScene();
+        for (int i = 0; i < quadCount; ++i) {
+            renderer.DrawTexturedRectangle({ static_cast<float>(i % 1280), static_cast<float>((i / 1280) % 720) },
+                                           { 8.0f, 8.0f }, textures[(i / runLength) & 1]);
+        }
+        renderer.EndScene();
+        glFinish();
+    }
+    state.SetItemsProcessed(state.iterations() * quadCount);
+}
+BENCHMARK(BM_RendererDrawTexturedRectangle)
+    ->Args({ 10000, 10000 })  // One texture for the whole frame
+    ->Args({ 10000, 64 })     // A texture switch every 64 quads
+    ->Unit(benchmark::kMicrosecond);
+
+static void BM_MeshConstruction(benchmark::State& state) {
+    if (!BenchContext::AcquireRenderer()) {
+        state.SkipWithError("No headless GL context");
+        return;
+    }
+
+    // A grid of quads: (n + 1)^2 vertices, 6 n^2 indices
+    const int cells = static_cast<int>(state.range(0));
+    std::vector<Vertex> vertices;
+    std::vector<unsigned int> indices;
+    for (int y = 0; y <= cells; ++y) {
+        for (int x = 0; x <= cells; ++x) {
+            vertices.emplace_back(glm::vec3(static_cast<float>(x), static_cast<float>(y), 0.0f));
+        }
+    }
+    for (int y = 0; y < cells; ++y) {
+        for (int x = 0; x < cells; ++x) {
+            const unsigned int i = static_cast<unsigned int>(y * (cells + 1) + x);
+            const unsigned int stride = static_cast<unsigned int>(cells + 1);
+            indices.insert(indices.end(), { i, i + 1, i + stride, i + 1, i + stride + 1, i + stride });
+        }
+    }
+
+    for (auto _ : state) {
+        Mesh mesh(vertices, indices);
+        benchmark::DoNotOptimize(mesh.IsValid());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(vertices.size()));
+}
+BENCHMARK(BM_MeshConstruction)->Arg(1)->Arg(64)->Unit(benchmark::kMicrosecond);
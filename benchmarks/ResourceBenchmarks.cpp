@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+#include "core/Logger.hpp"
+#include "core/Resource.hpp"
+#include "core/ResourceManager.hpp"
+#include <string>
+#include <vector>
+
+namespace {
+
+class BenchResource : public Resource {
+public:
+    bool loadFromFile(const std::string& filePath) override {
+        path = filePath;
+        return true;
+    }
+};
+
+std::vector<std::string> RegisterResources(int count) {
+    ResourceManager& manager = ResourceManager::getInstance();
+    manager.clearResources<BenchResource>();
+
+    std::vector<std::string> names;
+    for (int i = 0; i < count; ++i) {
+        names.push_back("resource_" + std::to_string(i));
+        manager.addResource(names.back(), std::make_shared<BenchResource>());
+    }
+    return names;
+}
+
+} // namespace
+
+// Name lookup: hash the string, find the slot, copy the shared_ptr
+static void BM_ResourceManagerGetByName(benchmark::State& state) {
+    Logger::Shutdown();  // addResource/clearResources log
+    const std::vector<std::string> names = RegisterResources(static_cast<int>(state.range(0)));
+    ResourceManager& manager = ResourceManager::getInstance();
+
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(manager.getResource<BenchResource>(names[i]));
+        i = (i + 1) % names.size();
+    }
+}
+BENCHMARK(BM_ResourceManagerGetByName)->Arg(16)->Arg(4096);
+
+// Handle lookup: index plus generation check, no hashing or refcounting
+static void BM_ResourceManagerGetByHandle(benchmark::State& state) {
+    Logger::Shutdown();
+    const std::vector<std::string> names = RegisterResources(static_cast<int>(state.range(0)));
+    ResourceManager& manager = ResourceManager::getInstance();
+
+    std::vector<Handle<BenchResource>> handles;
+    for (const std::string& name : names) {
+        handles.push_back(manager.getHandle<BenchResource>(name));
+    }
+
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(manager.get(handles[i]));
+        i = (i + 1) % handles.size();
+    }
+}
+BENCHMARK(BM_ResourceManagerGetByHandle)->Arg(16)->Arg(4096);
@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+"""Compare two Google Benchmark JSON results and flag regressions.
+
+Usage: compare.py BASELINE.json CURRENT.json [--threshold PERCENT] [--metric real_time|cpu_time]
+
+Runs with repetitions are compared by their median aggregate; single runs are
+compared directly. Exits with status 1 if any benchmark got slower than the
+threshold, 2 if either results file is missing, 0 otherwise. Benchmarks
+missing from either file are listed but never fail the comparison.
+"""
+
+import argparse
+import json
+import sys
+
+TIME_UNITS_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load_times(path, metric):
+    with open(path) as f:
+        data = json.load(f)
+
+    medians = {}
+    singles = {}
+    for entry in data.get("benchmarks", []):
+        if entry.get("error_occurred"):
+            continue
+        name = entry.get("run_name", entry["name"])
+        time_ns = entry[metric] * TIME_UNITS_NS[entry.get("time_unit", "ns")]
+        if entry.get("run_type") == "aggregate":
+            if entry.get("aggregate_name") == "median":
+                medians[name] = time_ns
+        else:
+            # Without aggregates, keep the fastest repetition
+            singles[name] = min(time_ns, singles.get(name, time_ns))
+
+    singles.update(medians)
+    return singles
+
+
+def format_ns(ns):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if ns >= scale:
+            return f"{ns / scale:.3f} {unit}"
+    return f"{ns:.1f} ns"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="slowdown in percent reported as a regression (default 10)")
+    parser.add_argument("--metric", choices=("real_time", "cpu_time"), default="real_time")
+    args = parser.parse_args()
+
+    # A gate with nothing to compare against must not pass
+    try:
+        baseline = load_times(args.baseline, args.metric)
+    except FileNotFoundError:
+        print(f"No baseline at {args.baseline}; copy a results file there to create one", file=sys.stderr)
+        return 2
+    try:
+        current = load_times(args.current, args.metric)
+    except FileNotFoundError:
+        print(f"No results at {args.current}; run the benchmarks first", file=sys.stderr)
+        return 2
+
+    names = sorted(set(baseline) | set(current))
+    width = max([len(n) for n in names] + [9])
+    print(f"{'Benchmark':<{width}}  {'Baseline':>12}  {'Current':>12}  {'Change':>8}")
+
+    regressions = []
+    for name in names:
+        if name not in current:
+            print(f"{name:<{width}}  {format_ns(baseline[name]):>12}  {'-':>12}  {'removed':>8}")
+            continue
+        if name not in baseline:
+            print(f"{name:<{width}}  {'-':>12}  {format_ns(current[name]):>12}  {'new':>8}")
+            continue
+
+        change = (current[name] - baseline[name]) / baseline[name] * 100.0
+        flag = ""
+        if change > args.threshold:
+            flag = "  REGRESSION"
+            regressions.append(name)
+        print(f"{name:<{width}}  {format_ns(baseline[name]):>12}  {format_ns(current[name]):>12}  "
+              f"{change:>+7.1f}%{flag}")
+
+    if regressions:
+        print(f"\n{len(regressions)} benchmark(s) slower than the {args.threshold:g}% threshold")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -1,12 +1,33 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <vector>
 #include "Window.hpp"
 #include "Timer.hpp"
 #include "Input.hpp"
+#include "ecs/Entity.hpp"
+
+class Camera2D;
+class RenderBackend;
+class World;
+class PhysicsWorld;
 
 class Engine {
 public:
+    struct Properties {
+        // Run GL submission on a dedicated render thread that owns the context
+        bool ThreadedRendering = false;
+        
+        // Hidden and Surfaceless render without a visible window (Surfaceless
+        // needs no display server); None runs the simulation without GL
+        Window::Mode WindowMode = Window::Mode::Visible;
+        
+        // Where F9 writes profile captures (Chrome trace-event JSON)
+        std::string ProfileCapturePath = "profile_capture.json";
+    };
+
     Engine();
     ~Engine();
     
@@ -15,29 +36,52 @@ public:
     Engine& operator=(const Engine&) = delete;
     
     bool Init();
+    bool Init(const Properties& props);
     void Run();
+    
+    // Run up to frameCount frames back to back, each advancing the simulation
+    // by exactly one fixed step; returns how many ran. For benchmarks,
+    // determinism tests and headless servers.
+    uint32_t RunFrames(uint32_t frameCount);
     void Shutdown();
     
+    const Window* GetWindow() const { return m_Window.get(); }
+    World& GetWorld() { return *m_World; }
+    PhysicsWorld& GetPhysics() { return *m_Physics; }
+    Entity GetPlayer() const { return m_Player; }
+    float GetPlayerX() const;
+    float GetPlayerY() const;
+    
 private:
+    void RunFrame(double deltaTime);
     void Update(float deltaTime);
+    bool UpdatePlayer();  // true if any player input was handled
     void FixedUpdate(float fixedDeltaTime);
     void Render();
+    void ToggleProfileCapture();
     
     std::unique_ptr<Window> m_Window;
     std::unique_ptr<Timer> m_Timer;
     std::unique_ptr<Input> m_Input;
+    std::unique_ptr<RenderBackend> m_RenderBackend;
+    std::unique_ptr<World> m_World;
+    std::unique_ptr<PhysicsWorld> m_Physics;
+    std::unique_ptr<Camera2D> m_Camera;
+    Properties m_Properties;
     bool m_Running;
     
     // Fixed timestep variables
     static constexpr double FIXED_TIME_STEP = 1.0 / 60.0;
     double m_Accumulator;
     
-    // Player movement
-    float m_PlayerX;
-    float m_PlayerY;
-    float m_PlayerSpeed;
-    bool m_IsJumping;
-    float m_JumpForce;
-    float m_Gravity;
-    float m_VerticalVelocity;
+    // Player state lives in its components (Transform, RigidBody, PlayerController)
+    Entity m_Player;
+    Entity m_Ground;
+    
+    // Sprite bounds of one chunk, SoA for Camera2D::Cull
+    std::vector<float> m_CullMinX;
+    std::vector<float> m_CullMinY;
+    std::vector<float> m_CullMaxX;
+    std::vector<float> m_CullMaxY;
+    std::vector<uint32_t> m_CullMask;
 };
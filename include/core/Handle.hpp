@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+
+// Typed reference to a resource slot. The generation is bumped every time a
+// slot is freed, so a handle to an unloaded resource simply stops resolving
+// instead of dangling. Generation 0 is never issued, which makes a
+// default-constructed handle invalid.
+template<typename T>
+struct Handle {
+    uint32_t Index = 0;
+    uint32_t Generation = 0;
+
+    bool IsValid() const { return Generation != 0; }
+
+    bool operator==(const Handle& other) const { return Index == other.Index && Generation == other.Generation; }
+    bool operator!=(const Handle& other) const { return !(*this == other); }
+};
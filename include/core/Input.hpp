@@ -37,7 +37,7 @@ struct InputAction {
 class Input {
 public:
     Input(Window* window);
-    ~Input() = default;
+    ~Input();
     
     // Delete copy constructor and assignment operator
     Input(const Input&) = delete;
@@ -0,0 +1,175 @@
+#pragma once
+
+#include "WorkStealingDeque.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+class JobCounter;
+
+// A unit of work: a callable stored inline, so scheduling never allocates
+struct alignas(64) Job {
+    static constexpr size_t StorageSize = 96;
+
+    void (*Invoke)(void* storage) = nullptr;
+    JobCounter* Counter = nullptr;
+    std::atomic<bool> InUse{ false };
+    bool HeapAllocated = false;
+    alignas(16) unsigned char Storage[StorageSize];
+};
+
+// Tracks a group of jobs: Run() increments it, each finished job decrements
+// it. Also the unit of dependency: jobs run with this counter as their
+// dependency are held back until it reaches zero. Must outlive its jobs:
+// destroy it only after Wait() has returned for it.
+class JobCounter {
+public:
+    JobCounter() : m_Pending(0) {}
+
+    // Delete copy constructor and assignment operator
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    bool IsDone() const { return m_Pending.load(std::memory_order_acquire) == 0; }
+
+private:
+    friend class JobSystem;
+
+    std::atomic<uint32_t> m_Pending;
+    mutable std::mutex m_Mutex;      // Held for the final decrement and m_Continuations
+    std::vector<Job*> m_Continuations;
+};
+
+// Work-stealing job scheduler for fine-grained, non-blocking work.
+//
+// One worker per core besides the thread that called Init() (the main
+// thread), each with its own Chase-Lev deque: threads pop their own newest
+// job and steal the oldest from others when they run dry. Wait() does not
+// block; the waiting thread runs jobs until the counter reaches zero. Jobs
+// scheduled from threads the system does not own (the render thread, pool
+// threads) go through a shared queue instead.
+//
+// Jobs must not block on I/O or locks held across frames; ThreadPool is the
+// place for that. Without Init() every job runs inline on the calling thread.
+class JobSystem {
+public:
+    static constexpr size_t MaxJobsPerThread = 4096;
+
+    static JobSystem& getInstance() {
+        static JobSystem instance;
+        return instance;
+    }
+
+    // workerCount 0 picks hardware_concurrency - 1 (at least one)
+    bool Init(size_t workerCount = 0);
+
+    // Runs every queued job, then joins the workers
+    void Shutdown();
+
+    bool IsRunning() const { return !m_Workers.empty(); }
+    size_t GetWorkerCount() const { return m_Workers.size(); }
+
+    // Runs fn() on some thread. If 'counter' is given it is incremented now
+    // and decremented when fn returns; if 'dependency' is given fn does not
+    // start before it reaches zero.
+    template<typename Fn>
+    void Run(Fn&& fn, JobCounter* counter = nullptr, JobCounter* dependency = nullptr) {
+        using Callable = std::decay_t<Fn>;
+        static_assert(sizeof(Callable) <= Job::StorageSize, "Job callable too large; capture less or by pointer");
+        static_assert(alignof(Callable) <= 16, "Job callable over-aligned");
+
+        if (!IsRunning()) {
+            if (dependency) Wait(*dependency);
+            fn();
+            return;
+        }
+
+        Job* job = AllocateJob();
+        new (job->Storage) Callable(std::forward<Fn>(fn));
+        job->Invoke = [](void* storage) {
+            Callable& callable = *static_cast<Callable*>(storage);
+            callable();
+            callable.~Callable();
+        };
+        job->Counter = counter;
+        if (counter) {
+            counter->m_Pending.fetch_add(1, std::memory_order_relaxed);
+        }
+        Submit(job, dependency);
+    }
+
+    // Calls fn(begin, end) over [0, count) split into batches of batchSize
+    // indices (0 picks a size giving every thread a few batches). 'fn' is
+    // copied into each job.
+    template<typename Fn>
+    void ParallelFor(size_t count, size_t batchSize, const Fn& fn, JobCounter& counter,
+                     JobCounter* dependency = nullptr) {
+        batchSize = ResolveBatchSize(count, batchSize);
+        for (size_t begin = 0; begin < count; begin += batchSize) {
+            const size_t end = std::min(count, begin + batchSize);
+            Run([fn, begin, end] { fn(begin, end); }, &counter, dependency);
+        }
+    }
+
+    // Blocking form: returns once every batch has run, helping meanwhile
+    template<typename Fn>
+    void ParallelFor(size_t count, size_t batchSize, const Fn& fn) {
+        JobCounter counter;
+        const Fn* function = &fn;
+        ParallelFor(count, batchSize, [function](size_t begin, size_t end) { (*function)(begin, end); }, counter);
+        Wait(counter);
+    }
+
+    // Runs jobs on the calling thread until the counter reaches zero
+    void Wait(const JobCounter& counter);
+
+private:
+    using JobQueue = WorkStealingDeque<Job*, MaxJobsPerThread>;
+
+    struct ThreadState {
+        JobQueue Queue;
+        std::unique_ptr<Job[]> Jobs{ new Job[MaxJobsPerThread] };
+        size_t NextJob = 0;
+        uint32_t RandomState = 0;
+    };
+
+    JobSystem();
+    ~JobSystem();
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    Job* AllocateJob();
+    void Submit(Job* job, JobCounter* dependency);
+    void Push(Job* job);
+    bool RunOneJob();
+    bool FindJob(Job*& job);
+    void Execute(Job* job);
+    void Release(JobCounter& counter);
+    void WorkerMain(size_t index);
+    size_t ResolveBatchSize(size_t count, size_t batchSize) const;
+
+    static thread_local ThreadState* s_ThreadState;  // nullptr on threads the system does not own
+
+    std::vector<std::unique_ptr<ThreadState>> m_Threads;  // 0 is the main thread
+    std::vector<std::thread> m_Workers;
+
+    // Jobs from threads without a ThreadState
+    std::vector<Job*> m_Injected;
+    std::mutex m_InjectedMutex;
+
+    // Idle workers sleep here; m_QueuedJobs is the wake-up condition
+    std::atomic<int64_t> m_QueuedJobs;
+    std::atomic<uint32_t> m_Sleepers;
+    std::mutex m_SleepMutex;
+    std::condition_variable m_WorkAvailable;
+    std::atomic<bool> m_StopRequested;
+};
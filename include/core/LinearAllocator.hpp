@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// Bump allocator over a fixed block. Allocations are released all at once by
+// Reset(); nothing is constructed or destroyed, so only trivially
+// destructible data belongs in here.
+class LinearAllocator {
+public:
+    explicit LinearAllocator(size_t capacity);
+    ~LinearAllocator() = default;
+
+    // Delete copy constructor and assignment operator
+    LinearAllocator(const LinearAllocator&) = delete;
+    LinearAllocator& operator=(const LinearAllocator&) = delete;
+
+    // Returns nullptr when the block is exhausted
+    void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+    void Reset() { m_Offset = 0; }
+
+    uint8_t* GetBase() const { return m_Buffer.get(); }
+    size_t GetCapacity() const { return m_Capacity; }
+    size_t GetUsed() const { return m_Offset; }
+
+private:
+    std::unique_ptr<uint8_t[]> m_Buffer;
+    size_t m_Capacity;
+    size_t m_Offset;
+};
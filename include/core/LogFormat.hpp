@@ -0,0 +1,168 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Replacement field options, a subset of std::format's:
+//   {[:[[fill]align][0][width][.precision][type]]}
+// align is one of < > ^, type one of d x X f e g s c p.
+struct LogFormatSpec {
+    char Fill = ' ';
+    char Align = 0;        // 0 picks the default: right for numbers, left for text
+    uint8_t Width = 0;
+    int8_t Precision = -1;
+    char Type = 0;
+};
+
+// Either a run of literal text or one replacement field
+struct LogFormatSegment {
+    uint16_t Begin = 0;    // Offset into the format string (for a field, of its '{')
+    uint16_t Length = 0;
+    bool IsArg = false;
+    LogFormatSpec Spec;
+};
+
+// A format string split into literal runs and replacement fields. The LOG_*
+// macros build one as a static constexpr object, so parsing happens at
+// compile time, malformed formats and argument count mismatches are compile
+// errors, and the logger thread only walks the pre-split segments. Formats
+// only known at runtime are parsed with the same code when they are written.
+class LogFormat {
+public:
+    static constexpr size_t MaxSegments = 32;
+
+    template<size_t N>
+    constexpr LogFormat(const char (&text)[N])
+        : LogFormat(text, N - 1) {
+    }
+
+    constexpr LogFormat(const char* text, size_t length)
+        : m_Text(text), m_Length(length), m_Segments{}, m_SegmentCount(0), m_ArgCount(0), m_Valid(true) {
+        Parse();
+    }
+
+    constexpr bool IsValid() const { return m_Valid; }
+    constexpr size_t GetArgCount() const { return m_ArgCount; }
+    constexpr size_t GetSegmentCount() const { return m_SegmentCount; }
+    constexpr const LogFormatSegment& GetSegment(size_t index) const { return m_Segments[index]; }
+    constexpr const char* GetText() const { return m_Text; }
+    constexpr size_t GetLength() const { return m_Length; }
+
+private:
+    static constexpr bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+    static constexpr bool IsAlign(char c) { return c == '<' || c == '>' || c == '^'; }
+    static constexpr bool IsType(char c) {
+        return c == 'd' || c == 'x' || c == 'X' || c == 'f' || c == 'e' || c == 'g' ||
+               c == 's' || c == 'c' || c == 'p';
+    }
+
+    constexpr void AddLiteral(size_t begin, size_t end) {
+        if (end <= begin) return;
+        if (m_SegmentCount == MaxSegments || end > 0xFFFF) {
+            m_Valid = false;
+            return;
+        }
+        LogFormatSegment& segment = m_Segments[m_SegmentCount++];
+        segment.Begin = static_cast<uint16_t>(begin);
+        segment.Length = static_cast<uint16_t>(end - begin);
+    }
+
+    constexpr void AddArg(size_t begin, size_t end, const LogFormatSpec& spec) {
+        if (m_SegmentCount == MaxSegments || end > 0xFFFF) {
+            m_Valid = false;
+            return;
+        }
+        LogFormatSegment& segment = m_Segments[m_SegmentCount++];
+        segment.Begin = static_cast<uint16_t>(begin);
+        segment.Length = static_cast<uint16_t>(end - begin);
+        segment.IsArg = true;
+        segment.Spec = spec;
+        ++m_ArgCount;
+    }
+
+    // Parses the text between '{' and '}'; returns false if it is malformed
+    constexpr bool ParseSpec(size_t begin, size_t end, LogFormatSpec& spec) const {
+        if (begin == end) return true;
+        if (m_Text[begin] != ':') return false;
+
+        size_t i = begin + 1;
+        if (i + 1 < end && IsAlign(m_Text[i + 1])) {
+            spec.Fill = m_Text[i];
+            spec.Align = m_Text[i + 1];
+            i += 2;
+        } else if (i < end && IsAlign(m_Text[i])) {
+            spec.Align = m_Text[i];
+            ++i;
+        }
+
+        if (i < end && m_Text[i] == '0' && spec.Align == 0) {
+            spec.Fill = '0';
+            spec.Align = '>';
+            ++i;
+        }
+
+        int width = 0;
+        while (i < end && IsDigit(m_Text[i])) {
+            width = width * 10 + (m_Text[i++] - '0');
+        }
+        if (width > 255) return false;
+        spec.Width = static_cast<uint8_t>(width);
+
+        if (i < end && m_Text[i] == '.') {
+            ++i;
+            if (i == end || !IsDigit(m_Text[i])) return false;
+            int precision = 0;
+            while (i < end && IsDigit(m_Text[i])) {
+                precision = precision * 10 + (m_Text[i++] - '0');
+            }
+            if (precision > 127) return false;
+            spec.Precision = static_cast<int8_t>(precision);
+        }
+
+        if (i < end && IsType(m_Text[i])) {
+            spec.Type = m_Text[i++];
+        }
+        return i == end;
+    }
+
+    constexpr void Parse() {
+        size_t literalBegin = 0;
+        size_t i = 0;
+        while (i < m_Length && m_Valid) {
+            const char c = m_Text[i];
+            if ((c == '{' || c == '}') && i + 1 < m_Length && m_Text[i + 1] == c) {
+                // "{{" and "}}" keep one brace; close the literal run just after it
+                AddLiteral(literalBegin, i + 1);
+                i += 2;
+                literalBegin = i;
+            } else if (c == '{') {
+                AddLiteral(literalBegin, i);
+                size_t close = i + 1;
+                while (close < m_Length && m_Text[close] != '}' && m_Text[close] != '{') {
+                    ++close;
+                }
+                LogFormatSpec spec;
+                if (close == m_Length || m_Text[close] != '}' || !ParseSpec(i + 1, close, spec)) {
+                    m_Valid = false;
+                    return;
+                }
+                AddArg(i, close + 1, spec);
+                i = close + 1;
+                literalBegin = i;
+            } else if (c == '}') {
+                m_Valid = false;
+                return;
+            } else {
+                ++i;
+            }
+        }
+        AddLiteral(literalBegin, m_Length);
+    }
+
+    const char* m_Text;
+    size_t m_Length;
+    LogFormatSegment m_Segments[MaxSegments];
+    size_t m_SegmentCount;
+    size_t m_ArgCount;
+    bool m_Valid;
+};
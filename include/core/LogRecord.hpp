@@ -0,0 +1,160 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include "LogFormat.hpp"
+
+enum class LogLevel {
+    Trace,
+    Info,
+    Warning,
+    Error,
+    Critical
+};
+
+// Binary log record, as written by producers and decoded by the logger
+// thread. Layout (all fields unaligned, copied with memcpy):
+//
+//   LogRecordHeader
+//   [uint32 length, bytes]   only when the format is stored inline
+//   { uint8 LogArgType, payload } * ArgCount
+//
+// Numbers are stored raw; strings are copied, since the caller's buffer may
+// be gone by the time the record is formatted. Formats parsed at compile
+// time are stored by pointer only.
+enum class LogArgType : uint8_t {
+    Bool,
+    Char,
+    Int,      // int64_t
+    UInt,     // uint64_t
+    Double,
+    String,   // uint32 length, bytes
+    Pointer
+};
+
+struct LogRecordHeader {
+    uint32_t Size;        // Whole record including this header, multiple of 8
+    uint8_t Level;        // LogLevel, or SkipLevel for ring padding
+    uint8_t ArgCount;
+    uint8_t Flags;
+    uint8_t Reserved;
+    uint64_t Timestamp;   // steady_clock ticks
+    const LogFormat* Format;  // Static, parsed at compile time; nullptr when stored inline
+
+    static constexpr uint8_t SkipLevel = 0xFF;
+    static constexpr uint8_t InlineFormat = 1 << 0;
+    static constexpr uint8_t Truncated = 1 << 1;
+};
+
+// Encodes one record into a fixed stack buffer. Anything that does not fit
+// is cut off and the record is flagged as truncated.
+class LogRecordBuilder {
+public:
+    static constexpr size_t MaxRecordSize = 2048;
+
+    LogRecordBuilder(LogLevel level, const LogFormat* staticFormat, uint64_t timestamp)
+        : m_Size(sizeof(LogRecordHeader)) {
+        LogRecordHeader header{};
+        header.Level = static_cast<uint8_t>(level);
+        header.Timestamp = timestamp;
+        header.Format = staticFormat;
+        std::memcpy(m_Buffer, &header, sizeof(header));
+    }
+
+    // Must be called before any argument is added
+    void SetInlineFormat(const char* text, size_t length) {
+        Header().Format = nullptr;
+        Header().Flags |= LogRecordHeader::InlineFormat;
+        PutString(text, length);
+    }
+
+    template<typename T>
+    void Add(const T& value) {
+        using Decayed = std::decay_t<T>;
+        if constexpr (std::is_same_v<Decayed, bool>) {
+            PutTagged(LogArgType::Bool, static_cast<uint8_t>(value));
+        } else if constexpr (std::is_same_v<Decayed, char>) {
+            PutTagged(LogArgType::Char, value);
+        } else if constexpr (std::is_integral_v<Decayed> && std::is_signed_v<Decayed>) {
+            PutTagged(LogArgType::Int, static_cast<int64_t>(value));
+        } else if constexpr (std::is_integral_v<Decayed>) {
+            PutTagged(LogArgType::UInt, static_cast<uint64_t>(value));
+        } else if constexpr (std::is_enum_v<Decayed>) {
+            PutTagged(LogArgType::Int, static_cast<int64_t>(value));
+        } else if constexpr (std::is_floating_point_v<Decayed>) {
+            PutTagged(LogArgType::Double, static_cast<double>(value));
+        } else if constexpr (std::is_array_v<T>) {
+            PutStringArg(value, std::strlen(value));
+        } else if constexpr (std::is_same_v<Decayed, const char*> || std::is_same_v<Decayed, char*>) {
+            const char* text = value ? value : "(null)";
+            PutStringArg(text, std::strlen(text));
+        } else if constexpr (std::is_same_v<Decayed, std::string> || std::is_same_v<Decayed, std::string_view>) {
+            PutStringArg(value.data(), value.size());
+        } else if constexpr (std::is_pointer_v<Decayed>) {
+            PutTagged(LogArgType::Pointer, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value)));
+        } else {
+            // Rare types fall back to their stream operator on the calling thread
+            std::ostringstream stream;
+            stream << value;
+            const std::string text = stream.str();
+            PutStringArg(text.data(), text.size());
+        }
+    }
+
+    // Pads to a multiple of 8 and stamps the final size
+    const uint8_t* Finish() {
+        m_Size = (m_Size + 7) & ~static_cast<size_t>(7);
+        Header().Size = static_cast<uint32_t>(m_Size);
+        return m_Buffer;
+    }
+
+    size_t GetSize() const { return m_Size; }
+
+private:
+    LogRecordHeader& Header() { return *reinterpret_cast<LogRecordHeader*>(m_Buffer); }
+
+    size_t Remaining() const { return MaxRecordSize - m_Size - 7; }  // Keep room for padding
+
+    template<typename T>
+    void PutTagged(LogArgType type, T value) {
+        if (Remaining() < 1 + sizeof(T)) {
+            Header().Flags |= LogRecordHeader::Truncated;
+            return;
+        }
+        m_Buffer[m_Size++] = static_cast<uint8_t>(type);
+        std::memcpy(m_Buffer + m_Size, &value, sizeof(T));
+        m_Size += sizeof(T);
+        Header().ArgCount++;
+    }
+
+    void PutStringArg(const char* text, size_t length) {
+        if (Remaining() < 1 + sizeof(uint32_t)) {
+            Header().Flags |= LogRecordHeader::Truncated;
+            return;
+        }
+        m_Buffer[m_Size++] = static_cast<uint8_t>(LogArgType::String);
+        PutString(text, length);
+        Header().ArgCount++;
+    }
+
+    void PutString(const char* text, size_t length) {
+        const size_t space = Remaining() - sizeof(uint32_t);
+        if (length > space) {
+            length = space;
+            Header().Flags |= LogRecordHeader::Truncated;
+        }
+        const auto stored = static_cast<uint32_t>(length);
+        std::memcpy(m_Buffer + m_Size, &stored, sizeof(stored));
+        m_Size += sizeof(stored);
+        std::memcpy(m_Buffer + m_Size, text, length);
+        m_Size += length;
+    }
+
+    alignas(8) uint8_t m_Buffer[MaxRecordSize];
+    size_t m_Size;
+};
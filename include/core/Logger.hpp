@@ -1,76 +1,134 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
 #include <string>
-#include <sstream>
-#include <iostream>
-
-enum class LogLevel {
-    Trace,
-    Info,
-    Warning,
-    Error,
-    Critical
+#include <type_traits>
+#include "LogRecord.hpp"
+
+// Log calls below this level compile to nothing, arguments included
+// (0 = Trace, 1 = Info, 2 = Warning, 3 = Error, 4 = Critical)
+#ifndef LOG_LEVEL_MIN
+    #define LOG_LEVEL_MIN 0
+#endif
+
+// What a producer does when its ring buffer is full
+enum class LogOverflowPolicy {
+    Drop,   // Discard the message and count it; the count is logged later
+    Block   // Wait for the logger thread to make room
 };
 
+// Logging front end. Calls encode a compact binary record (level, timestamp,
+// format pointer, packed arguments) and push it into a lock-free ring owned
+// by the calling thread. A background thread drains every ring, formats the
+// records and writes them out in batches, so the caller never formats text,
+// takes a lock or touches stdout.
+//
+// The LOG_* macros parse their format at compile time (see LogFormat.hpp)
+// and only store a pointer to it. Formats built at runtime go through
+// Log(level, std::string, ...) and are copied into the record. Critical
+// messages flush synchronously before returning.
 class Logger {
 public:
+    struct Config {
+        bool Async = true;                                  // false formats and writes on the calling thread
+        LogOverflowPolicy Overflow = LogOverflowPolicy::Drop;
+        size_t RingSize = 64 * 1024;                        // Bytes per producer thread, rounded up to a power of two
+        std::FILE* Output = nullptr;                        // nullptr writes to stdout; not closed by the logger
+    };
+
     static void Init();
+    static void Init(const Config& config);
     static void Shutdown();
-    
+
+    // Block until every message logged so far has been written
+    static void Flush();
+
+    // Messages discarded under LogOverflowPolicy::Drop since Init
+    static uint64_t GetDroppedCount();
+
+    // Levels below LOG_LEVEL_MIN are filtered out on every path
+    static constexpr bool IsLevelEnabled(LogLevel level) {
+        return static_cast<int>(level) >= LOG_LEVEL_MIN;
+    }
+
+    // Used by the LOG_* macros; 'format' was parsed at compile time from 'literal'
+    template<size_t N, typename... Args>
+    static void Log(LogLevel level, const LogFormat* format, const char (&literal)[N], Args&&... args) {
+        (void)literal;
+        if (!s_Initialized.load(std::memory_order_relaxed)) return;
+
+        LogRecordBuilder record(level, format, Now());
+        (record.Add(args), ...);
+        Submit(record);
+    }
+
+    // Runtime formats are copied into the record and parsed when written
     template<typename... Args>
     static void Log(LogLevel level, const std::string& fmt, Args&&... args) {
-        std::stringstream ss;
-        FormatString(ss, fmt, std::forward<Args>(args)...);
-        LogMessage(level, ss.str());
+        if (!IsLevelEnabled(level) || !s_Initialized.load(std::memory_order_relaxed)) return;
+
+        LogRecordBuilder record(level, nullptr, Now());
+        record.SetInlineFormat(fmt.data(), fmt.size());
+        (record.Add(args), ...);
+        Submit(record);
     }
-    
+
     static void Info(const std::string& message) {
-        Log(LogLevel::Info, message);
+        if constexpr (IsLevelEnabled(LogLevel::Info)) {
+            Log(LogLevel::Info, message);
+        }
     }
-    
+
     static void Warn(const std::string& message) {
-        Log(LogLevel::Warning, message);
+        if constexpr (IsLevelEnabled(LogLevel::Warning)) {
+            Log(LogLevel::Warning, message);
+        }
     }
-    
+
     static void Error(const std::string& message) {
-        Log(LogLevel::Error, message);
-    }
-    
-private:
-    static void LogMessage(LogLevel level, const std::string& message);
-    static const char* GetLevelString(LogLevel level);
-    
-    static void FormatString(std::stringstream& ss, const std::string& fmt) {
-        ss << fmt;
-    }
-    
-    template<typename T>
-    static void FormatString(std::stringstream& ss, const std::string& fmt, T&& value) {
-        size_t pos = fmt.find("{}");
-        if (pos != std::string::npos) {
-            ss << fmt.substr(0, pos) << value << fmt.substr(pos + 2);
-        } else {
-            ss << fmt;
+        if constexpr (IsLevelEnabled(LogLevel::Error)) {
+            Log(LogLevel::Error, message);
         }
     }
-    
-    template<typename T, typename... Args>
-    static void FormatString(std::stringstream& ss, const std::string& fmt, T&& value, Args&&... args) {
-        size_t pos = fmt.find("{}");
-        if (pos != std::string::npos) {
-            ss << fmt.substr(0, pos) << value;
-            FormatString(ss, fmt.substr(pos + 2), std::forward<Args>(args)...);
-        } else {
-            ss << fmt;
-        }
+
+private:
+    static uint64_t Now() {
+        return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
     }
-    
-    static bool s_Initialized;
+
+    static void Submit(LogRecordBuilder& record);
+
+    static std::atomic<bool> s_Initialized;
 };
 
-// Convenience macros
-#define LOG_TRACE(...)    Logger::Log(LogLevel::Trace, __VA_ARGS__)
-#define LOG_INFO(...)     Logger::Log(LogLevel::Info, __VA_ARGS__)
-#define LOG_WARN(...)     Logger::Log(LogLevel::Warning, __VA_ARGS__)
-#define LOG_ERROR(...)    Logger::Log(LogLevel::Error, __VA_ARGS__)
-#define LOG_CRITICAL(...) Logger::Log(LogLevel::Critical, __VA_ARGS__)
+namespace LogDetail {
+    // Only used in decltype, to count macro arguments without evaluating them
+    template<typename... Args>
+    std::integral_constant<size_t, sizeof...(Args)> CountArgs(Args&&...);
+}
+
+#define PE_LOG_EXPAND(x) x
+#define PE_LOG_FIRST(first, ...) first
+
+#define PE_LOG(level, ...)                                                                      \
+    do {                                                                                        \
+        if constexpr (Logger::IsLevelEnabled(level)) {                                          \
+            static constexpr LogFormat peLogFormat(PE_LOG_EXPAND(PE_LOG_FIRST(__VA_ARGS__, 0)));\
+            static_assert(peLogFormat.IsValid(), "Malformed log format string");                \
+            static_assert(peLogFormat.GetArgCount() + 1 ==                                      \
+                          decltype(LogDetail::CountArgs(__VA_ARGS__))::value,                   \
+                          "Log argument count does not match the format string");               \
+            Logger::Log(level, &peLogFormat, __VA_ARGS__);                                      \
+        }                                                                                       \
+    } while (0)
+
+// Convenience macros; the first argument must be a string literal
+#define LOG_TRACE(...)    PE_LOG(LogLevel::Trace, __VA_ARGS__)
+#define LOG_INFO(...)     PE_LOG(LogLevel::Info, __VA_ARGS__)
+#define LOG_WARN(...)     PE_LOG(LogLevel::Warning, __VA_ARGS__)
+#define LOG_ERROR(...)    PE_LOG(LogLevel::Error, __VA_ARGS__)
+#define LOG_CRITICAL(...) PE_LOG(LogLevel::Critical, __VA_ARGS__)
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Read-only memory mapping of a whole file. Pages are faulted in by the OS
+// on first touch, so opening a large file costs almost nothing up front.
+class MappedFile {
+public:
+    MappedFile();
+    ~MappedFile();
+
+    // Delete copy constructor and assignment operator
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    // With randomAccess the OS is told not to read ahead around faults, so
+    // only pages actually touched are read in
+    bool Open(const std::string& path, bool randomAccess = false);
+    void Close();
+
+    // Hints only: Prefetch starts reading a byte range in the background and
+    // Release drops its pages (they are read again if touched)
+    void Prefetch(size_t offset, size_t size) const;
+    void Release(size_t offset, size_t size) const;
+
+    bool IsOpen() const { return m_Data != nullptr; }
+    const uint8_t* GetData() const { return m_Data; }
+    size_t GetSize() const { return m_Size; }
+
+private:
+    const uint8_t* m_Data;
+    size_t m_Size;
+#ifdef _WIN32
+    void* m_File;
+    void* m_Mapping;
+#endif
+};
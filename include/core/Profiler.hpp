@@ -0,0 +1,154 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+    #define PROFILER_USE_RDTSC 1
+#elif defined(_M_X64) || defined(_M_IX86)
+    #include <intrin.h>
+    #define PROFILER_USE_RDTSC 1
+#else
+    #define PROFILER_USE_RDTSC 0
+#endif
+
+// One completed zone, as recorded by the thread that ran it
+struct ProfileEvent {
+    const char* Name;     // Must outlive the profiler: a literal or __func__
+    uint64_t Begin;       // Profiler ticks, see Profiler::Now()
+    uint64_t End;
+    uint32_t Depth;       // Nesting level on its thread, 0 for outermost
+    uint32_t ThreadId;
+};
+
+// A node in a frame's zone tree. Every call of a zone under the same parent
+// is merged into one node.
+struct ProfileZone {
+    static constexpr uint32_t NoParent = ~0u;
+
+    const char* Name;
+    uint32_t Parent;      // Index into ProfileFrame::Zones, or NoParent for a thread's roots
+    uint32_t Depth;
+    uint32_t ThreadId;
+    uint32_t CallCount;
+    double TotalMs;
+    double SelfMs;        // TotalMs minus the time spent in child zones
+};
+
+struct ProfileFrame {
+    uint64_t Index = 0;
+    double DurationMs = 0.0;
+    std::vector<ProfileZone> Zones;  // Pre-order, so a parent always precedes its children
+};
+
+// Hierarchical CPU frame profiler.
+//
+// PROFILE_SCOPE records a zone into a buffer owned by the calling thread; the
+// only lock it takes is that buffer's own, which is uncontended except while
+// EndFrame() collects it. EndFrame() gathers every thread's events, merges
+// them into a per-frame zone tree (GetLastFrame()) and, between BeginCapture()
+// and EndCapture(), keeps the raw events for ExportChromeTrace(), which
+// writes the Trace Event JSON read by about://tracing and Perfetto.
+//
+// Timestamps come from rdtsc where available, calibrated against
+// steady_clock at Init(), and from steady_clock elsewhere.
+class Profiler {
+public:
+    // Events beyond this many per thread between two EndFrame() calls are dropped
+    static constexpr size_t MaxEventsPerThread = 64 * 1024;
+    static constexpr size_t MaxCapturedEvents = 4 * 1024 * 1024;
+
+    static void Init();
+    static void Shutdown();
+    static bool IsEnabled() { return s_Enabled.load(std::memory_order_relaxed); }
+
+    // Shown as the thread's name in exported traces
+    static void SetThreadName(const char* name);
+
+    // A named timeline not backed by a thread, such as the GPU; returns its
+    // ThreadId for RecordEvent()
+    static uint32_t RegisterTrack(const char* name);
+
+    // Adds an already timed event, e.g. one read back from a GPU query. It is
+    // collected with the calling thread's zones but keeps its own ThreadId.
+    static void RecordEvent(const ProfileEvent& event);
+
+    // Bracket one frame; call both from the same thread
+    static void BeginFrame();
+    static void EndFrame();
+
+    // Zone tree of the last completed frame; only valid on the frame thread
+    static const ProfileFrame& GetLastFrame();
+
+    static void BeginCapture();
+    static void EndCapture();
+    static bool IsCapturing();
+    static size_t GetCapturedEventCount();
+
+    // Writes the events captured by the last BeginCapture()/EndCapture() pair
+    static bool ExportChromeTrace(const std::string& path);
+
+    // Events dropped because a thread buffer or the capture was full
+    static uint64_t GetDroppedCount();
+
+    static uint64_t Now() {
+#if PROFILER_USE_RDTSC
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+    static double TicksToMilliseconds(uint64_t ticks);
+    static double GetMillisecondsPerTick();
+
+    // Used by ProfileScope; EnterZone returns the zone's begin timestamp
+    static uint64_t EnterZone();
+    static void LeaveZone(const char* name, uint64_t begin);
+
+private:
+    static std::atomic<bool> s_Enabled;
+};
+
+// Records the enclosing scope as a zone
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name)
+        : m_Name(name), m_Begin(0), m_Active(Profiler::IsEnabled()) {
+        if (m_Active) m_Begin = Profiler::EnterZone();
+    }
+
+    ~ProfileScope() {
+        if (m_Active) Profiler::LeaveZone(m_Name, m_Begin);
+    }
+
+    // Delete copy constructor and assignment operator
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* m_Name;
+    uint64_t m_Begin;
+    bool m_Active;
+};
+
+// Set to 0 to compile every zone out
+#ifndef PROFILER_ENABLED
+    #define PROFILER_ENABLED 1
+#endif
+
+#define PE_PROFILE_CONCAT_INNER(a, b) a##b
+#define PE_PROFILE_CONCAT(a, b) PE_PROFILE_CONCAT_INNER(a, b)
+
+#if PROFILER_ENABLED
+    #define PROFILE_SCOPE(name) ProfileScope PE_PROFILE_CONCAT(peProfileScope, __COUNTER__)(name)
+    #define PROFILE_FUNCTION() PROFILE_SCOPE(__func__)
+#else
+    #define PROFILE_SCOPE(name) do {} while (0)
+    #define PROFILE_FUNCTION() do {} while (0)
+#endif
@@ -1,11 +1,22 @@
 #pragma once
 
+#include <future>
 #include <string>
-#include <unordered_map>
 #include <memory>
 #include <stdexcept>
+#include <vector>
 #include "Logger.hpp"
+#include "Handle.hpp"
+#include "ResourcePool.hpp"
+#include "utils/Hash.hpp"
 
+class Texture;
+
+// Resources live in dense per-type slot arrays. Names are hashed once, when a
+// resource is registered; from then on code should hold a Handle<T> and call
+// get(), which resolves in O(1) without allocating or touching refcounts. A
+// handle to a removed resource fails its generation check and yields nullptr.
+// The name-based functions remain for loading and tooling code.
 class ResourceManager {
 public:
     static ResourceManager& getInstance() {
@@ -13,58 +24,107 @@ public:
         return instance;
     }
 
-    // Generic resource loading
+    // Generic resource loading; returns an invalid handle on failure
     template<typename T>
-    void loadResource(const std::string& name, const std::string& path) {
-        if (resources<T>.find(name) != resources<T>.end()) {
+    Handle<T> loadResource(const std::string& name, const std::string& path) {
+        const uint64_t hash = HashString(name);
+        if (Handle<T> existing = findHandle<T>(name, hash); existing.IsValid()) {
             Logger::Warn("Resource '" + name + "' already exists. Skipping load.");
-            return;
+            return existing;
+        }
+        if (isHashCollision<T>(name, hash)) {
+            return {};
         }
 
         try {
             auto resource = std::make_shared<T>();
             if (resource->loadFromFile(path)) {
-                resources<T>[name] = resource;
                 Logger::Info("Successfully loaded resource: " + name);
+                return resources<T>.Add(hash, name, std::move(resource));
             } else {
                 Logger::Error("Failed to load resource: " + name);
             }
         } catch (const std::exception& e) {
             Logger::Error("Exception while loading resource '" + name + "': " + e.what());
         }
+        return {};
+    }
+
+    // Register a resource that was created in memory rather than loaded from a file
+    template<typename T>
+    Handle<T> addResource(const std::string& name, std::shared_ptr<T> resource) {
+        const uint64_t hash = HashString(name);
+        if (Handle<T> existing = findHandle<T>(name, hash); existing.IsValid()) {
+            Logger::Warn("Resource '" + name + "' already exists. Skipping add.");
+            return existing;
+        }
+        if (isHashCollision<T>(name, hash)) {
+            return {};
+        }
+        return resources<T>.Add(hash, name, std::move(resource));
+    }
+
+    // Decode on a worker thread and upload on the GL thread. The future
+    // resolves to the texture once it is resident (nullptr on failure);
+    // updateAsyncLoads() then registers it under the given name.
+    std::shared_future<std::shared_ptr<Texture>> loadTextureAsync(const std::string& name, const std::string& path);
+
+    // Register finished async loads; call once per frame from the main thread
+    void updateAsyncLoads();
+
+    size_t getPendingAsyncLoadCount() const { return pendingTextures.size(); }
+
+    // Look a name up once and keep the handle
+    template<typename T>
+    Handle<T> getHandle(const std::string& name) const {
+        return findHandle<T>(name, HashString(name));
+    }
+
+    // Hot path: nullptr if the handle is invalid or the resource was removed
+    template<typename T>
+    T* get(Handle<T> handle) const {
+        return resources<T>.Get(handle);
+    }
+
+    template<typename T>
+    bool isValid(Handle<T> handle) const {
+        return resources<T>.Get(handle) != nullptr;
     }
 
     // Generic resource getter
     template<typename T>
     std::shared_ptr<T> getResource(const std::string& name) {
-        auto it = resources<T>.find(name);
-        if (it == resources<T>.end()) {
+        Handle<T> handle = getHandle<T>(name);
+        if (!handle.IsValid()) {
             Logger::Warn("Resource '" + name + "' not found.");
             return nullptr;
         }
-        return it->second;
+        return resources<T>.GetShared(handle);
     }
 
     // Resource existence check
     template<typename T>
     bool hasResource(const std::string& name) {
-        return resources<T>.find(name) != resources<T>.end();
+        return getHandle<T>(name).IsValid();
     }
 
-    // Resource removal
+    // Resource removal; outstanding handles become stale
     template<typename T>
     void removeResource(const std::string& name) {
-        auto it = resources<T>.find(name);
-        if (it != resources<T>.end()) {
-            resources<T>.erase(it);
+        if (resources<T>.Remove(getHandle<T>(name))) {
             Logger::Info("Resource removed: " + name);
         }
     }
 
+    template<typename T>
+    void removeResource(Handle<T> handle) {
+        resources<T>.Remove(handle);
+    }
+
     // Clear all resources of a specific type
     template<typename T>
     void clearResources() {
-        resources<T>.clear();
+        resources<T>.Clear();
         Logger::Info("Cleared all resources of specified type");
     }
 
@@ -80,11 +140,37 @@ private:
     ResourceManager(const ResourceManager&) = delete;
     ResourceManager& operator=(const ResourceManager&) = delete;
 
+    template<typename T>
+    Handle<T> findHandle(const std::string& name, uint64_t hash) const {
+        const std::string* stored = resources<T>.FindName(hash);
+        if (!stored || *stored != name) {
+            return {};
+        }
+        return resources<T>.Find(hash);
+    }
+
+    // Two names with the same 64-bit hash cannot share a pool
+    template<typename T>
+    bool isHashCollision(const std::string& name, uint64_t hash) const {
+        const std::string* stored = resources<T>.FindName(hash);
+        if (stored && *stored != name) {
+            Logger::Error("Resource name '" + name + "' collides with '" + *stored + "'");
+            return true;
+        }
+        return false;
+    }
+
+    struct PendingTexture {
+        std::string name;
+        std::shared_future<std::shared_ptr<Texture>> future;
+    };
+    std::vector<PendingTexture> pendingTextures;
+
     // Resource storage for different types
     template<typename T>
-    static std::unordered_map<std::string, std::shared_ptr<T>> resources;
+    static ResourcePool<T> resources;
 };
 
 // Static member initialization
 template<typename T>
-std::unordered_map<std::string, std::shared_ptr<T>> ResourceManager::resources;
+ResourcePool<T> ResourceManager::resources;
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "Handle.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Dense slot array for one resource type.
+//
+// Slots own the resource through a shared_ptr (so getResource() callers can
+// keep it alive) but also cache the raw pointer; resolving a handle is an
+// index, a generation compare and a pointer load, with no refcount traffic.
+// Names are hashed once when a resource is added.
+template<typename T>
+class ResourcePool {
+public:
+    Handle<T> Add(uint64_t nameHash, const std::string& name, std::shared_ptr<T> resource) {
+        uint32_t index;
+        if (!m_FreeList.empty()) {
+            index = m_FreeList.back();
+            m_FreeList.pop_back();
+        } else {
+            index = static_cast<uint32_t>(m_Slots.size());
+            m_Slots.emplace_back();
+        }
+
+        Slot& slot = m_Slots[index];
+        slot.Raw = resource.get();
+        slot.Owner = std::move(resource);
+        slot.Name = name;
+        slot.NameHash = nameHash;
+        m_ByName[nameHash] = index;
+
+        return { index, slot.Generation };
+    }
+
+    // Invalid handle if no resource has this name
+    Handle<T> Find(uint64_t nameHash) const {
+        auto it = m_ByName.find(nameHash);
+        if (it == m_ByName.end()) {
+            return {};
+        }
+        return { it->second, m_Slots[it->second].Generation };
+    }
+
+    // Name stored for the slot a hash maps to; used to reject hash collisions
+    const std::string* FindName(uint64_t nameHash) const {
+        auto it = m_ByName.find(nameHash);
+        return it == m_ByName.end() ? nullptr : &m_Slots[it->second].Name;
+    }
+
+    // Hot path: nullptr for stale or invalid handles
+    T* Get(Handle<T> handle) const {
+        if (handle.Index >= m_Slots.size()) return nullptr;
+        const Slot& slot = m_Slots[handle.Index];
+        return slot.Generation == handle.Generation ? slot.Raw : nullptr;
+    }
+
+    std::shared_ptr<T> GetShared(Handle<T> handle) const {
+        return Get(handle) ? m_Slots[handle.Index].Owner : nullptr;
+    }
+
+    bool Remove(Handle<T> handle) {
+        if (!Get(handle)) return false;
+
+        Slot& slot = m_Slots[handle.Index];
+        m_ByName.erase(slot.NameHash);
+        slot.Owner.reset();
+        slot.Raw = nullptr;
+        slot.Name.clear();
+
+        // Skip 0 on wrap-around so the slot never looks unused
+        if (++slot.Generation == 0) {
+            slot.Generation = 1;
+        }
+        m_FreeList.push_back(handle.Index);
+        return true;
+    }
+
+    void Clear() {
+        for (uint32_t i = 0; i < m_Slots.size(); ++i) {
+            Remove({ i, m_Slots[i].Generation });
+        }
+    }
+
+    size_t GetCount() const { return m_ByName.size(); }
+
+private:
+    struct Slot {
+        std::shared_ptr<T> Owner;
+        T* Raw = nullptr;
+        std::string Name;
+        uint64_t NameHash = 0;
+        uint32_t Generation = 1;
+    };
+
+    std::vector<Slot> m_Slots;
+    std::vector<uint32_t> m_FreeList;
+    std::unordered_map<uint64_t, uint32_t> m_ByName;
+};
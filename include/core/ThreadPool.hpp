@@ -0,0 +1,47 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads pulling tasks from a shared FIFO. Meant for
+// coarse blocking work (file I/O, image decoding), not fine-grained jobs.
+class ThreadPool {
+public:
+    ThreadPool();
+    ~ThreadPool();
+
+    // Delete copy constructor and assignment operator
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // threadCount 0 picks hardware_concurrency - 1 (at least one)
+    bool Init(size_t threadCount = 0);
+
+    // Finishes tasks already queued, then joins the workers
+    void Shutdown();
+
+    // Returns false if the pool is not running
+    bool Enqueue(std::function<void()> task);
+
+    // Block until the queue is empty and no task is running
+    void WaitIdle();
+
+    size_t GetThreadCount() const { return m_Workers.size(); }
+    bool IsRunning() const { return !m_Workers.empty(); }
+
+private:
+    void WorkerMain();
+
+    std::vector<std::thread> m_Workers;
+    std::deque<std::function<void()>> m_Tasks;
+    std::mutex m_Mutex;
+    std::condition_variable m_TaskAvailable;
+    std::condition_variable m_Idle;
+    size_t m_ActiveTasks;
+    bool m_StopRequested;
+};
@@ -1,17 +1,29 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <vector>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 
 class Window {
 public:
+    // How the window and its GL context are created. Everything but Visible
+    // runs without user interaction and never reports ShouldClose().
+    enum class Mode {
+        Visible,      // Regular GLFW window
+        Hidden,       // Invisible GLFW window; still needs a display server
+        Surfaceless,  // EGL context without a window system, drawing into an offscreen framebuffer
+        None          // No window and no GL at all, for simulation-only runs
+    };
+
     struct Properties {
         std::string Title;
         uint32_t Width;
         uint32_t Height;
         bool VSync;
         bool Fullscreen;
+        Mode WindowMode = Mode::Visible;
     };
     
     Window();
@@ -27,8 +39,19 @@ public:
     
     void Clear(float r = 0.0f, float g = 0.0f, float b = 0.0f, float a = 1.0f);
     void SwapBuffers();
+
+    // Move the GL context between threads (see RenderBackend)
+    void MakeContextCurrent();
+    void DetachContext();
     bool ShouldClose() const;
     
+    // True unless the window was created with Mode::None
+    bool HasContext() const { return m_Window != nullptr || m_EglContext != nullptr; }
+    Mode GetMode() const { return m_Properties.WindowMode; }
+    
+    // Read back the current framebuffer as tightly packed RGBA8, bottom row first
+    bool ReadPixels(std::vector<uint8_t>& pixels) const;
+    
     // Getters
     uint32_t GetWidth() const { return m_Properties.Width; }
     uint32_t GetHeight() const { return m_Properties.Height; }
@@ -45,6 +68,17 @@ public:
 private:
     static void ErrorCallback(int error, const char* description);
     
+    bool InitGLFW();
+    bool InitSurfaceless();
+    bool CreateOffscreenFramebuffer();
+    
     GLFWwindow* m_Window;
     Properties m_Properties;
+    
+    // Surfaceless mode; EGL handles are opaque pointers so EGL stays out of this header
+    void* m_EglDisplay;
+    void* m_EglContext;
+    unsigned int m_Framebuffer;
+    unsigned int m_ColorBuffer;
+    unsigned int m_DepthBuffer;
 };
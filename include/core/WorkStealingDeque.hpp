@@ -0,0 +1,89 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Fixed-capacity Chase-Lev deque (Le et al., "Correct and Efficient
+// Work-Stealing for Weak Memory Models", PPoPP 2013). The owning thread
+// pushes and pops at the bottom (LIFO, cache-warm); any other thread steals
+// from the top (FIFO, oldest and usually largest work first). Pop and Steal
+// only contend on the last item.
+template<typename T, size_t Capacity>
+class WorkStealingDeque {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    WorkStealingDeque() : m_Top(0), m_Bottom(0) {}
+
+    // Delete copy constructor and assignment operator
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    // Owner only; false if full
+    bool Push(T item) {
+        const int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+        const int64_t top = m_Top.load(std::memory_order_acquire);
+        if (bottom - top >= static_cast<int64_t>(Capacity)) {
+            return false;
+        }
+
+        m_Items[bottom & Mask].store(item, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Owner only
+    bool Pop(T& item) {
+        const int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+        m_Bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = m_Top.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            // Empty
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        item = m_Items[bottom & Mask].load(std::memory_order_relaxed);
+        if (top == bottom) {
+            // Last item: race the thieves for it
+            const bool won = m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                           std::memory_order_relaxed);
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    // Any thread
+    bool Steal(T& item) {
+        int64_t top = m_Top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+        if (top >= bottom) {
+            return false;
+        }
+
+        item = m_Items[top & Mask].load(std::memory_order_relaxed);
+        return m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                             std::memory_order_relaxed);
+    }
+
+    // Approximate when other threads are pushing or stealing
+    size_t GetSize() const {
+        const int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+        const int64_t top = m_Top.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+    }
+
+private:
+    static constexpr int64_t Mask = static_cast<int64_t>(Capacity) - 1;
+
+    // Thieves hammer m_Top; keep the owner's m_Bottom off its cache line
+    alignas(64) std::atomic<int64_t> m_Top;
+    alignas(64) std::atomic<int64_t> m_Bottom;
+    alignas(64) std::atomic<T> m_Items[Capacity];
+};
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "ComponentType.hpp"
+#include "Entity.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// Fixed-size block holding up to Archetype::GetChunkCapacity() entities. The
+// block is laid out SoA: the entity IDs, then one array per component, each
+// array starting on a cache line.
+struct Chunk {
+    uint8_t* Data = nullptr;
+    uint32_t Count = 0;
+};
+
+// Storage for every entity with exactly one component signature. Entities
+// are packed: only the last chunk is ever partially filled, and removal moves
+// the last entity into the hole.
+class Archetype {
+public:
+    static constexpr size_t ChunkSize = 16 * 1024;
+    static constexpr size_t ColumnAlignment = 64;
+    static constexpr int NoColumn = -1;
+    static_assert(ColumnAlignment + ComponentRegistry::MaxComponentSize <= ChunkSize,
+                  "A chunk must hold at least one row of the largest component");
+
+    explicit Archetype(ComponentMask mask);
+    ~Archetype();
+
+    // Delete copy constructor and assignment operator
+    Archetype(const Archetype&) = delete;
+    Archetype& operator=(const Archetype&) = delete;
+
+    ComponentMask GetMask() const { return m_Mask; }
+    uint32_t GetChunkCapacity() const { return m_ChunkCapacity; }
+    size_t GetEntityCount() const { return m_EntityCount; }
+
+    size_t GetChunkCount() const { return m_Chunks.size(); }
+    Chunk& GetChunk(size_t index) { return m_Chunks[index]; }
+    const Chunk& GetChunk(size_t index) const { return m_Chunks[index]; }
+
+    // Column of a component in this archetype's chunks, or NoColumn
+    int FindColumn(ComponentId id) const {
+        return id < ComponentRegistry::MaxComponentTypes ? m_ColumnOf[id] : NoColumn;
+    }
+
+    Entity* GetEntities(const Chunk& chunk) const {
+        return reinterpret_cast<Entity*>(chunk.Data);
+    }
+
+    void* GetColumn(const Chunk& chunk, int column) const {
+        return chunk.Data + m_Columns[column].Offset;
+    }
+
+    template<typename T>
+    T* GetArray(const Chunk& chunk) const {
+        const int column = FindColumn(GetComponentId<T>());
+        return column == NoColumn ? nullptr : static_cast<T*>(GetColumn(chunk, column));
+    }
+
+    // Appends a row for the entity; component values are left uninitialized.
+    // Returns the row's chunk and index.
+    void Append(Entity entity, uint32_t& chunkIndex, uint32_t& row);
+
+    // Removes a row by moving the last row into it. Returns the entity that
+    // was moved, or an invalid Entity if the removed row was the last one.
+    Entity Remove(uint32_t chunkIndex, uint32_t row);
+
+    // Copies the components both archetypes share from one row to another
+    static void CopyShared(const Archetype& from, uint32_t fromChunk, uint32_t fromRow,
+                           Archetype& to, uint32_t toChunk, uint32_t toRow);
+
+    // Cached targets of adding or removing one component, filled by World
+    std::unordered_map<ComponentId, Archetype*> AddEdges;
+    std::unordered_map<ComponentId, Archetype*> RemoveEdges;
+
+private:
+    struct Column {
+        ComponentId Id;
+        size_t Size;
+        size_t Offset;  // From the start of the chunk
+    };
+
+    std::vector<Column> m_Columns;
+    int m_ColumnOf[ComponentRegistry::MaxComponentTypes];
+    std::vector<Chunk> m_Chunks;
+    ComponentMask m_Mask;
+    uint32_t m_ChunkCapacity;
+    size_t m_EntityCount;
+};
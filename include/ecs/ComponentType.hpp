@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+using ComponentId = uint32_t;
+
+// An archetype's signature: bit N set means it stores component N
+using ComponentMask = uint64_t;
+
+struct ComponentInfo {
+    size_t Size;
+    size_t Alignment;
+};
+
+// Process-wide table of component types, filled in the first time each type
+// is used. IDs are dense, so they double as bit positions in a ComponentMask.
+class ComponentRegistry {
+public:
+    static constexpr size_t MaxComponentTypes = 64;
+    // Largest component one archetype chunk can hold alongside its entity ID
+    static constexpr size_t MaxComponentSize = 8 * 1024;
+
+    static ComponentId Register(size_t size, size_t alignment);
+    static const ComponentInfo& GetInfo(ComponentId id);
+    static size_t GetCount();
+};
+
+template<typename T>
+struct ComponentTypeId {
+    // Components are plain data: chunks move them with memcpy and never run
+    // constructors or destructors on them
+    static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+                  "Components must be trivially copyable and destructible");
+    static_assert(sizeof(T) <= ComponentRegistry::MaxComponentSize,
+                  "Component too large for an archetype chunk; store a handle to the data instead");
+
+    static ComponentId Get() {
+        static const ComponentId id = ComponentRegistry::Register(sizeof(T), alignof(T));
+        return id;
+    }
+};
+
+// const T names the same component as T
+template<typename T>
+ComponentId GetComponentId() {
+    return ComponentTypeId<std::remove_cv_t<T>>::Get();
+}
+
+template<typename... Ts>
+ComponentMask MakeComponentMask() {
+    return (ComponentMask(0) | ... | (ComponentMask(1) << GetComponentId<Ts>()));
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "physics/BodyId.hpp"
+#include <glm/glm.hpp>
+#include <cstdint>
+
+// Components shared by the engine's built-in systems. Game code is free to
+// define its own; any trivially copyable struct works.
+
+struct Transform {
+    glm::vec2 Position{ 0.0f };
+};
+
+struct Velocity {
+    glm::vec2 Value{ 0.0f };
+};
+
+// Solid-colour quad drawn centred on Transform::Position + Offset
+struct Sprite {
+    glm::vec2 Size{ 0.0f };
+    glm::vec2 Offset{ 0.0f };
+    glm::vec4 Color{ 1.0f };
+    uint8_t Layer = 0;
+};
+
+// Links an entity to a PhysicsWorld body. The body owns position and
+// velocity; Transform::Position is copied from the body's centre each step.
+struct RigidBody {
+    BodyId Body;
+};
+
+struct PlayerController {
+    float Speed = 300.0f;
+    float JumpForce = 500.0f;
+    bool IsJumping = false;
+};
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+
+// Generational entity ID. The generation is bumped every time an entity is
+// destroyed, so a stale ID stops resolving instead of aliasing whichever
+// entity reuses its slot. Generation 0 is never issued, which makes a
+// default-constructed Entity invalid.
+struct Entity {
+    uint32_t Index = 0;
+    uint32_t Generation = 0;
+
+    bool IsValid() const { return Generation != 0; }
+
+    bool operator==(const Entity& other) const { return Index == other.Index && Generation == other.Generation; }
+    bool operator!=(const Entity& other) const { return !(*this == other); }
+};
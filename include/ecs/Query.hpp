@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Archetype.hpp"
+#include "ComponentType.hpp"
+#include "Entity.hpp"
+#include "core/JobSystem.hpp"
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+// The archetypes matching one include/exclude signature. Owned by the World,
+// which appends to it whenever a matching archetype is created, so iterating
+// never has to re-match signatures.
+struct QueryCache {
+    ComponentMask Include = 0;
+    ComponentMask Exclude = 0;
+    std::vector<Archetype*> Archetypes;
+
+    bool Matches(ComponentMask mask) const {
+        return (mask & Include) == Include && (mask & Exclude) == 0;
+    }
+};
+
+// Iterates every entity that has all of Ts (and none of the excluded
+// components) one chunk at a time. Cheap to copy and valid for the World's
+// lifetime, so systems can keep one around. Entities must not be created,
+// destroyed or change components while a query is iterating.
+template<typename... Ts>
+class Query {
+public:
+    explicit Query(const QueryCache* cache) : m_Cache(cache) {}
+
+    // fn(uint32_t count, const Entity* entities, Ts*... components): one call
+    // per chunk with its contiguous component arrays
+    template<typename Fn>
+    void ForEachChunk(Fn&& fn) const {
+        for (Archetype* archetype : m_Cache->Archetypes) {
+            for (size_t i = 0; i < archetype->GetChunkCount(); ++i) {
+                const Chunk& chunk = archetype->GetChunk(i);
+                fn(chunk.Count, static_cast<const Entity*>(archetype->GetEntities(chunk)),
+                   archetype->template GetArray<Ts>(chunk)...);
+            }
+        }
+    }
+
+    // ForEachChunk with the chunks spread over the job system; returns once
+    // every chunk is done. Calls run concurrently, so fn may only write to the
+    // chunk it was handed.
+    template<typename Fn>
+    void ParallelForEachChunk(const Fn& fn) const {
+        JobSystem& jobs = JobSystem::getInstance();
+        JobCounter counter;
+        for (Archetype* archetype : m_Cache->Archetypes) {
+            jobs.ParallelFor(archetype->GetChunkCount(), 1, [archetype, &fn](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    const Chunk& chunk = archetype->GetChunk(i);
+                    fn(chunk.Count, static_cast<const Entity*>(archetype->GetEntities(chunk)),
+                       archetype->template GetArray<Ts>(chunk)...);
+                }
+            }, counter);
+        }
+        jobs.Wait(counter);
+    }
+
+    // fn(Ts&... components) or fn(Entity entity, Ts&... components)
+    template<typename Fn>
+    void ForEach(Fn&& fn) const {
+        ForEachChunk([&fn](uint32_t count, const Entity* entities, Ts*... components) {
+            for (uint32_t i = 0; i < count; ++i) {
+                if constexpr (std::is_invocable_v<Fn&, Entity, Ts&...>) {
+                    fn(entities[i], components[i]...);
+                } else {
+                    fn(components[i]...);
+                }
+            }
+        });
+    }
+
+    size_t Count() const {
+        size_t count = 0;
+        for (const Archetype* archetype : m_Cache->Archetypes) {
+            count += archetype->GetEntityCount();
+        }
+        return count;
+    }
+
+private:
+    const QueryCache* m_Cache;
+};
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Archetype.hpp"
+#include "ComponentType.hpp"
+#include "Entity.hpp"
+#include "Query.hpp"
+#include "utils/Debug.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// Archetype-based entity store.
+//
+// Entities with the same set of components share an Archetype, whose 16KB
+// chunks keep each component in its own contiguous array, so a system walks
+// linear memory instead of chasing per-object pointers. Adding or removing a
+// component moves the entity to the matching archetype; the transition is
+// cached on the archetype after the first time.
+class World {
+public:
+    World();
+    ~World();
+
+    // Delete copy constructor and assignment operator
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
+
+    Entity CreateEntity();
+
+    template<typename... Ts>
+    Entity CreateEntity(const Ts&... components) {
+        Entity entity = AllocateEntity(GetOrCreateArchetype(MakeComponentMask<Ts...>()));
+        (WriteComponent(entity, components), ...);
+        return entity;
+    }
+
+    // Does nothing for dead or invalid entities
+    void DestroyEntity(Entity entity);
+    bool IsAlive(Entity entity) const;
+    size_t GetEntityCount() const { return m_EntityCount; }
+    size_t GetArchetypeCount() const { return m_Archetypes.size(); }
+
+    // Overwrites the component if the entity already has one
+    template<typename T>
+    T& AddComponent(Entity entity, const T& value = T()) {
+        ASSERT(IsAlive(entity), "AddComponent on a dead entity");
+        const ComponentId id = GetComponentId<T>();
+        if (!HasComponent(entity, id)) {
+            MoveEntity(entity, GetAddTarget(m_Records[entity.Index].Arch, id));
+        }
+        return WriteComponent(entity, value);
+    }
+
+    template<typename T>
+    void RemoveComponent(Entity entity) {
+        const ComponentId id = GetComponentId<T>();
+        if (!HasComponent(entity, id)) return;
+        MoveEntity(entity, GetRemoveTarget(m_Records[entity.Index].Arch, id));
+    }
+
+    template<typename T>
+    bool HasComponent(Entity entity) const {
+        return HasComponent(entity, GetComponentId<T>());
+    }
+
+    // nullptr if the entity is dead or lacks the component. Valid until the
+    // next structural change to the World.
+    template<typename T>
+    T* GetComponent(Entity entity) const {
+        return static_cast<T*>(GetComponentData(entity, GetComponentId<T>()));
+    }
+
+    // Query over entities with every one of Ts and none of 'exclude' (see
+    // MakeComponentMask). The first call for a signature matches it against
+    // the existing archetypes; later calls reuse that result.
+    template<typename... Ts>
+    Query<Ts...> GetQuery(ComponentMask exclude = 0) {
+        return Query<Ts...>(FindOrCreateQuery(MakeComponentMask<Ts...>(), exclude));
+    }
+
+private:
+    struct EntityRecord {
+        Archetype* Arch = nullptr;  // nullptr while the slot is free
+        uint32_t Chunk = 0;
+        uint32_t Row = 0;
+        uint32_t Generation = 1;
+    };
+
+    template<typename T>
+    T& WriteComponent(Entity entity, const T& value) {
+        T* component = GetComponent<T>(entity);
+        *component = value;
+        return *component;
+    }
+
+    Entity AllocateEntity(Archetype* archetype);
+    void MoveEntity(Entity entity, Archetype* target);
+    bool HasComponent(Entity entity, ComponentId id) const;
+    void* GetComponentData(Entity entity, ComponentId id) const;
+
+    Archetype* GetOrCreateArchetype(ComponentMask mask);
+    Archetype* GetAddTarget(Archetype* archetype, ComponentId id);
+    Archetype* GetRemoveTarget(Archetype* archetype, ComponentId id);
+    const QueryCache* FindOrCreateQuery(ComponentMask include, ComponentMask exclude);
+
+    std::vector<EntityRecord> m_Records;
+    std::vector<uint32_t> m_FreeList;
+    std::vector<std::unique_ptr<Archetype>> m_Archetypes;
+    std::unordered_map<ComponentMask, Archetype*> m_ArchetypeByMask;
+    std::vector<std::unique_ptr<QueryCache>> m_Queries;
+    size_t m_EntityCount;
+};
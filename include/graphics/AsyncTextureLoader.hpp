@@ -0,0 +1,86 @@
+#pragma once
+#include "core/ThreadPool.hpp"
+#include "Texture.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+
+// Loads textures without stalling the frame.
+//
+// Worker threads decode images into RGBA pixel buffers and push them onto a
+// bounded upload queue; when the queue is full, decoding waits, which caps
+// the memory held by decoded-but-not-uploaded images. The thread that owns
+// the GL context drains the queue with ProcessUploads() under a time budget,
+// optionally staging through pixel buffer objects.
+//
+// Load() returns a future that resolves to the texture once it is resident,
+// or to nullptr if decoding or upload failed. Never block on it from the GL
+// thread: the upload it waits for happens there.
+class AsyncTextureLoader {
+public:
+    static constexpr size_t DefaultMaxPendingUploads = 8;
+    static constexpr double DefaultUploadBudgetMs = 2.0;
+
+    using TextureFuture = std::shared_future<std::shared_ptr<Texture>>;
+
+    static AsyncTextureLoader& getInstance() {
+        static AsyncTextureLoader instance;
+        return instance;
+    }
+
+    // workerCount 0 lets the pool pick
+    bool Init(size_t workerCount = 0, size_t maxPendingUploads = DefaultMaxPendingUploads,
+              bool usePixelBuffers = true);
+    // Unfinished loads resolve to nullptr
+    void Shutdown();
+
+    TextureFuture Load(const std::string& path);
+
+    // GL thread: upload decoded images until budgetMs has elapsed (at least
+    // one per call so loading always makes progress). Returns the upload count.
+    size_t ProcessUploads(double budgetMs = DefaultUploadBudgetMs);
+
+    // GL thread: delete the staging buffers before the context goes away
+    void ReleaseGLResources();
+
+    bool IsRunning() const { return m_Pool.IsRunning(); }
+    size_t GetPendingUploadCount();
+
+private:
+    struct DecodedImage {
+        std::shared_ptr<Texture> Target;
+        std::shared_ptr<std::promise<std::shared_ptr<Texture>>> Promise;
+        std::string Path;
+        unsigned char* Pixels = nullptr;  // stbi-owned, RGBA8
+        int Width = 0;
+        int Height = 0;
+    };
+
+    static constexpr unsigned int PixelBufferCount = 2;
+
+    AsyncTextureLoader();
+    ~AsyncTextureLoader();
+    AsyncTextureLoader(const AsyncTextureLoader&) = delete;
+    AsyncTextureLoader& operator=(const AsyncTextureLoader&) = delete;
+
+    void Decode(std::shared_ptr<Texture> target, std::shared_ptr<std::promise<std::shared_ptr<Texture>>> promise,
+                const std::string& path);
+    bool Upload(const DecodedImage& image);
+
+    ThreadPool m_Pool;
+
+    std::deque<DecodedImage> m_Uploads;
+    std::mutex m_Mutex;
+    std::condition_variable m_SpaceAvailable;
+    size_t m_MaxPendingUploads;
+    bool m_StopRequested;
+
+    // GL thread only
+    bool m_UsePixelBuffers;
+    unsigned int m_PixelBuffers[PixelBufferCount];
+    unsigned int m_NextPixelBuffer;
+};
@@ -0,0 +1,46 @@
+#pragma once
+#include "SkylinePacker.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Packs RGBA8 images into one or more fixed-size pages. Shared by runtime
+// atlas building (TextureAtlas::Build) and the offline AtlasPacker tool.
+class AtlasBuilder {
+public:
+    struct Image {
+        std::string Name;
+        int Width = 0;
+        int Height = 0;
+        const unsigned char* Pixels = nullptr;  // RGBA8, row 0 is the bottom row
+    };
+
+    struct Page {
+        int Width = 0;
+        int Height = 0;
+        std::vector<unsigned char> Pixels;  // RGBA8
+    };
+
+    struct Region {
+        std::string Name;
+        uint32_t Page = 0;
+        SkylinePacker::Rect Rect;
+    };
+
+    explicit AtlasBuilder(int pageSize = 2048, int padding = 1);
+
+    // Fails if any single image is larger than a page
+    bool Build(const std::vector<Image>& images);
+
+    const std::vector<Page>& GetPages() const { return m_Pages; }
+    const std::vector<Region>& GetRegions() const { return m_Regions; }
+
+    // Write the binary index (see AtlasFormat.hpp); pagePaths[i] names page i
+    bool WriteIndex(const std::string& path, const std::vector<std::string>& pagePaths) const;
+
+private:
+    int m_PageSize;
+    int m_Padding;
+    std::vector<Page> m_Pages;
+    std::vector<Region> m_Regions;
+};
@@ -0,0 +1,47 @@
+#pragma once
+#include <cstdint>
+
+// On-disk layout of a packed atlas index (.atlas). Everything is
+// little-endian and 4-byte aligned so the engine can use the tables straight
+// out of a memory mapping:
+//
+//   AtlasFileHeader
+//   AtlasPageEntry[PageCount]
+//   AtlasRegionEntry[RegionCount]   sorted by NameHash
+//   string table                    NUL-terminated names and page paths
+//
+// Page paths are relative to the directory holding the index.
+namespace AtlasFormat {
+    constexpr char Magic[4] = { 'P', 'A', 'T', 'L' };
+    constexpr uint32_t Version = 1;
+}
+
+struct AtlasFileHeader {
+    char Magic[4];
+    uint32_t Version;
+    uint32_t PageCount;
+    uint32_t RegionCount;
+    uint32_t PageTableOffset;
+    uint32_t RegionTableOffset;
+    uint32_t StringTableOffset;
+    uint32_t StringTableSize;
+};
+
+struct AtlasPageEntry {
+    uint32_t PathOffset;  // Into the string table
+    uint32_t Width;
+    uint32_t Height;
+};
+
+struct AtlasRegionEntry {
+    uint64_t NameHash;    // HashString of the sprite name
+    uint32_t NameOffset;  // Into the string table
+    uint32_t Page;
+    float U0, V0, U1, V1;
+    uint32_t Width;
+    uint32_t Height;
+};
+
+static_assert(sizeof(AtlasFileHeader) == 32, "AtlasFileHeader layout changed");
+static_assert(sizeof(AtlasPageEntry) == 12, "AtlasPageEntry layout changed");
+static_assert(sizeof(AtlasRegionEntry) == 40, "AtlasRegionEntry layout changed");
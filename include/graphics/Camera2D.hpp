@@ -0,0 +1,101 @@
+#pragma once
+#include "physics/AABB.hpp"
+#include "physics/PhysicsKernels.hpp"
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+
+// Orthographic camera for the 2D world.
+//
+// The camera is centered on its position. Zoom is in screen pixels per
+// world unit. The view, projection and view-projection matrices are cached
+// and only rebuilt, each on its own, after something they depend on
+// changes. Renderer::SetCamera() takes the cached matrices and view
+// bounds, so a camera that did not move costs nothing to set again.
+//
+// With pixel snapping on, the drawn position is rounded to whole screen
+// pixels so tile and sprite edges stay crisp. The unrounded position is
+// kept, so slow follow movement still adds up.
+//
+// Cull() tests arrays of boxes against the view in one SIMD pass (see
+// PhysicsKernels::OverlapMask). Submission code uses it to skip whatever
+// is off screen.
+class Camera2D {
+public:
+    Camera2D();
+    Camera2D(float viewportWidth, float viewportHeight);
+
+    // Screen size in pixels
+    void SetViewportSize(float width, float height);
+    const glm::vec2& GetViewportSize() const { return m_ViewportSize; }
+
+    // World position at the center of the view
+    void SetPosition(const glm::vec2& position);
+    const glm::vec2& GetPosition() const { return m_Position; }
+    // The position the matrices use: snapped when pixel snapping is on
+    glm::vec2 GetRenderPosition() const;
+
+    // Screen pixels per world unit; values <= 0 are ignored
+    void SetZoom(float zoom);
+    float GetZoom() const { return m_Zoom; }
+
+    void SetPixelSnap(bool enabled);
+    bool IsPixelSnapEnabled() const { return m_PixelSnap; }
+
+    // Follow() leaves the camera alone while the target stays within the
+    // deadzone (half extents, world units) around the view center. Once the
+    // target leaves it, the camera eases toward the point that brings the
+    // target back to the deadzone edge. Speed is the rate per second; 0
+    // moves the camera there at once.
+    void SetDeadzone(const glm::vec2& halfExtents) { m_Deadzone = glm::max(halfExtents, glm::vec2(0.0f)); }
+    void SetFollowSpeed(float speed) { m_FollowSpeed = speed > 0.0f ? speed : 0.0f; }
+    const glm::vec2& GetDeadzone() const { return m_Deadzone; }
+    float GetFollowSpeed() const { return m_FollowSpeed; }
+    void Follow(const glm::vec2& target, float deltaTime);
+
+    const glm::mat4& GetViewMatrix() const;
+    const glm::mat4& GetProjectionMatrix() const;
+    const glm::mat4& GetViewProjectionMatrix() const;
+
+    // World-space rectangle the view covers
+    const AABB& GetViewBounds() const;
+
+    // Screen positions are in pixels from the top-left corner, as the
+    // window reports the mouse
+    glm::vec2 ScreenToWorld(const glm::vec2& screen) const;
+    glm::vec2 WorldToScreen(const glm::vec2& world) const;
+
+    // Touching the edge of the view does not count as visible
+    bool IsVisible(const AABB& box) const { return GetViewBounds().Overlaps(box); }
+
+    // Sets bit i % 32 of mask[i / 32] for every visible box i of the SoA
+    // arrays; 'mask' must hold GetMaskWordCount(count) words. Returns how
+    // many boxes are visible.
+    size_t Cull(const float* minX, const float* minY, const float* maxX, const float* maxY,
+                size_t count, uint32_t* mask) const;
+
+    static constexpr size_t GetMaskWordCount(size_t count) { return PhysicsKernels::GetMaskWordCount(count); }
+
+private:
+    // Edges of the view in pixels around the center; whole numbers, so
+    // pixel edges land on whole numbers even for odd viewport sizes
+    glm::vec4 GetPixelExtents() const;
+
+    glm::vec2 m_ViewportSize;
+    glm::vec2 m_Position;
+    float m_Zoom;
+    bool m_PixelSnap;
+
+    glm::vec2 m_Deadzone;
+    float m_FollowSpeed;
+
+    // Built on demand
+    mutable glm::mat4 m_View;
+    mutable glm::mat4 m_Projection;
+    mutable glm::mat4 m_ViewProjection;
+    mutable AABB m_ViewBounds;
+    mutable bool m_ViewDirty;
+    mutable bool m_ProjectionDirty;
+    mutable bool m_ViewProjectionDirty;
+    mutable bool m_BoundsDirty;
+};
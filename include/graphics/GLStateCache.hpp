@@ -0,0 +1,59 @@
+#pragma once
+#include <array>
+#include <cstdint>
+
+// Shadow copy of the GL state the engine touches most often. All binds go
+// through here so redundant glUseProgram / glBindVertexArray / glBindTexture /
+// blend calls are skipped. Code that changes this state behind the cache's
+// back must call Invalidate() afterwards.
+class GLStateCache {
+public:
+    static constexpr unsigned int MaxTextureSlots = 16;
+
+    struct Stats {
+        uint32_t Issued = 0;
+        uint32_t Skipped = 0;
+    };
+
+    static GLStateCache& getInstance() {
+        static GLStateCache instance;
+        return instance;
+    }
+
+    void UseProgram(unsigned int program);
+    void BindVertexArray(unsigned int vao);
+    void BindTexture(unsigned int slot, unsigned int texture);
+    void SetBlend(bool enabled);
+    void SetBlendFunc(unsigned int srcFactor, unsigned int dstFactor);
+
+    // GL unbinds deleted objects; keep the shadow state in sync
+    void OnProgramDeleted(unsigned int program);
+    void OnVertexArrayDeleted(unsigned int vao);
+    void OnTextureDeleted(unsigned int texture);
+
+    // Forget everything so the next bind of each kind is always issued
+    void Invalidate();
+
+    // Per-frame counters
+    const Stats& GetStats() const { return m_Stats; }
+    void ResetStats() { m_Stats = Stats(); }
+
+private:
+    static constexpr unsigned int Unknown = ~0u;
+
+    GLStateCache();
+    ~GLStateCache() = default;
+    GLStateCache(const GLStateCache&) = delete;
+    GLStateCache& operator=(const GLStateCache&) = delete;
+
+    bool Changed(unsigned int& current, unsigned int value);
+
+    unsigned int m_Program;
+    unsigned int m_VertexArray;
+    unsigned int m_ActiveSlot;
+    std::array<unsigned int, MaxTextureSlots> m_Textures;
+    unsigned int m_BlendEnabled;
+    unsigned int m_BlendSrc;
+    unsigned int m_BlendDst;
+    Stats m_Stats;
+};
@@ -0,0 +1,104 @@
+#pragma once
+#include "core/Profiler.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// GPU timing for the frame profiler. GPU_PROFILE_SCOPE brackets a run of GL
+// commands with two GL_TIMESTAMP queries (timestamps rather than
+// GL_TIME_ELAPSED, which cannot nest). Query sets rotate over FrameLatency
+// frames, so a frame's results are read FrameLatency - 1 frames later, when
+// they are normally long available; a set that is still pending is dropped
+// rather than waited on.
+//
+// Each frame pairs glGetInteger64v(GL_TIMESTAMP) with Profiler::Now() to map
+// GPU time onto the CPU clock, and resolved zones are handed to the Profiler
+// on a "GPU" track, so they show up in the zone tree and in exported traces
+// next to the CPU zones that issued them.
+//
+// All calls must come from the thread that owns the GL context.
+class GpuProfiler {
+public:
+    static constexpr size_t FrameLatency = 3;
+    static constexpr size_t MaxZonesPerFrame = 256;
+
+    static GpuProfiler& getInstance() {
+        static GpuProfiler instance;
+        return instance;
+    }
+
+    // Needs a current context; stays disabled if timer queries are unsupported
+    void Init();
+    void Shutdown();
+    bool IsEnabled() const { return m_Enabled; }
+
+    // Bracket the GL work of one frame
+    void BeginFrame();
+    void EndFrame();
+
+    void BeginZone(const char* name);
+    void EndZone();
+
+    // GPU time between the first and last timestamp of the last resolved frame
+    double GetLastFrameTimeMs() const { return m_LastFrameTimeMs; }
+    uint64_t GetResolvedFrameCount() const { return m_ResolvedFrames; }
+    uint64_t GetSkippedFrameCount() const { return m_SkippedFrames; }
+
+private:
+    struct Zone {
+        const char* Name;
+        uint32_t BeginQuery;  // Index into FrameQueries::Queries
+        uint32_t EndQuery;
+        uint32_t Depth;
+    };
+
+    struct FrameQueries {
+        std::vector<unsigned int> Queries;  // Grown on demand, reused every FrameLatency frames
+        std::vector<Zone> Zones;
+        uint32_t QueryCount = 0;
+        uint64_t CpuTicks = 0;   // Profiler::Now() ...
+        int64_t GpuTime = 0;     // ... and GL_TIMESTAMP in ns, sampled together
+        bool Pending = false;
+    };
+
+    GpuProfiler();
+    ~GpuProfiler() = default;
+    GpuProfiler(const GpuProfiler&) = delete;
+    GpuProfiler& operator=(const GpuProfiler&) = delete;
+
+    uint32_t IssueTimestamp(FrameQueries& frame);
+    void Resolve(FrameQueries& frame);
+
+    FrameQueries m_Frames[FrameLatency];
+    size_t m_FrameIndex;
+    std::vector<uint32_t> m_OpenZones;  // Indices into the current frame's Zones
+    std::vector<uint64_t> m_Results;
+    uint32_t m_TrackId;
+    bool m_Enabled;
+    bool m_InFrame;
+    double m_LastFrameTimeMs;
+    uint64_t m_ResolvedFrames;
+    uint64_t m_SkippedFrames;
+};
+
+// Times the GL commands issued in the enclosing scope
+class GpuProfileScope {
+public:
+    explicit GpuProfileScope(const char* name) {
+        GpuProfiler::getInstance().BeginZone(name);
+    }
+
+    ~GpuProfileScope() {
+        GpuProfiler::getInstance().EndZone();
+    }
+
+    // Delete copy constructor and assignment operator
+    GpuProfileScope(const GpuProfileScope&) = delete;
+    GpuProfileScope& operator=(const GpuProfileScope&) = delete;
+};
+
+#if PROFILER_ENABLED
+    #define GPU_PROFILE_SCOPE(name) GpuProfileScope PE_PROFILE_CONCAT(peGpuProfileScope, __COUNTER__)(name)
+#else
+    #define GPU_PROFILE_SCOPE(name) do {} while (0)
+#endif
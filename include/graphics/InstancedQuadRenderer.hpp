@@ -0,0 +1,35 @@
+#pragma once
+#include "QuadInstance.hpp"
+#include "Shader.hpp"
+#include <cstddef>
+#include <memory>
+
+// Draws many quads sharing one texture with a single glDrawElementsInstanced.
+// The unit quad lives in a static buffer; per-instance data is streamed into
+// an instance buffer that grows to the largest batch seen so far.
+class InstancedQuadRenderer {
+public:
+    InstancedQuadRenderer();
+    ~InstancedQuadRenderer();
+
+    bool Init(std::shared_ptr<Shader> shader);
+    void Shutdown();
+
+    // Binds the texture to unit 0 and issues one instanced draw
+    void Draw(const QuadInstance* instances, size_t count, unsigned int textureID);
+
+    size_t GetCapacity() const { return m_Capacity; }
+
+    // Prevent copying
+    InstancedQuadRenderer(const InstancedQuadRenderer&) = delete;
+    InstancedQuadRenderer& operator=(const InstancedQuadRenderer&) = delete;
+
+private:
+    void CreateBuffers();
+    void CleanupBuffers();
+
+    std::shared_ptr<Shader> m_Shader;
+    unsigned int m_VAO, m_QuadVBO, m_EBO, m_InstanceVBO;
+    size_t m_Capacity; // In instances
+    bool m_Initialized;
+};
@@ -0,0 +1,154 @@
+#pragma once
+#include "QuadInstance.hpp"
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+class RenderQueue;
+class Texture;
+
+// One pool of particles sharing their settings and texture.
+//
+// Particles live in SoA arrays (position, velocity, life, size, color)
+// sized for MaxParticles up front, so emitting never allocates. A particle
+// that dies is replaced by the last live one, which keeps the live range
+// packed and in step across every array. Update() runs branch-free loops
+// over those arrays (positions through PhysicsKernels::IntegratePositions);
+// pools above ParticlesPerJob are split across the job system.
+//
+// Every live particle is drawn with one instanced draw: Draw() goes
+// straight to the Renderer, Submit() through a RenderQueue, which copies
+// the instances into its own growable instance buffer.
+class ParticleEmitter {
+public:
+    struct Properties {
+        size_t MaxParticles = 10000;
+        size_t ParticlesPerJob = 16384;
+
+        glm::vec2 Position{ 0.0f };           // Where continuous emission spawns
+        float EmissionRate = 0.0f;            // Particles per second; 0 emits only on Emit()
+
+        // Each particle picks its own value within +/- the variation
+        glm::vec2 PositionVariation{ 0.0f };  // Half extents of the spawn box
+        glm::vec2 Velocity{ 0.0f, 100.0f };
+        glm::vec2 VelocityVariation{ 50.0f };
+        float Lifetime = 1.0f;                // Seconds
+        float LifetimeVariation = 0.0f;
+        float Size = 8.0f;                    // World units, at birth
+        float SizeVariation = 0.0f;
+
+        // Over each particle's life, from birth to death
+        float SizeEndScale = 0.0f;
+        glm::vec4 ColorBegin{ 1.0f };
+        glm::vec4 ColorEnd{ 1.0f, 1.0f, 1.0f, 0.0f };
+
+        glm::vec2 Gravity{ 0.0f, -400.0f };
+        float Drag = 0.0f;                    // Share of the velocity lost per second
+
+        const Texture* TextureRef = nullptr;  // White if null; must outlive the emitter
+        glm::vec4 UVRect{ 0.0f, 0.0f, 1.0f, 1.0f };
+        uint32_t Seed = 1;
+    };
+
+    struct Stats {
+        uint32_t Emitted = 0;
+        uint32_t Expired = 0;
+        uint32_t Dropped = 0;                 // Emits refused with the pool full
+    };
+
+    ParticleEmitter();
+    explicit ParticleEmitter(const Properties& props);
+
+    // Delete copy constructor and assignment operator
+    ParticleEmitter(const ParticleEmitter&) = delete;
+    ParticleEmitter& operator=(const ParticleEmitter&) = delete;
+
+    // Spawns up to 'count' particles around 'position'; returns how many fit
+    size_t Emit(size_t count, const glm::vec2& position);
+    size_t Emit(size_t count) { return Emit(count, m_Properties.Position); }
+
+    // Ages, moves and fades every particle, then drops the dead ones
+    void Update(float deltaTime);
+
+    void Draw();
+    void Submit(RenderQueue& queue, uint8_t layer, float depth = 0.0f);
+
+    void Clear() { m_Count = 0; }
+
+    void SetPosition(const glm::vec2& position) { m_Properties.Position = position; }
+    void SetEmissionRate(float rate) { m_Properties.EmissionRate = rate > 0.0f ? rate : 0.0f; }
+    const Properties& GetProperties() const { return m_Properties; }
+
+    size_t GetCount() const { return m_Count; }
+    size_t GetCapacity() const { return m_Properties.MaxParticles; }
+
+    // Live range of the SoA arrays, [0, GetCount())
+    const float* GetPositionX() const { return m_PositionX.data(); }
+    const float* GetPositionY() const { return m_PositionY.data(); }
+    const float* GetVelocityX() const { return m_VelocityX.data(); }
+    const float* GetVelocityY() const { return m_VelocityY.data(); }
+    const float* GetLife() const { return m_Life.data(); }        // Seconds left
+    const float* GetSize() const { return m_Size.data(); }
+    glm::vec4 GetColor(size_t index) const;
+
+    const Stats& GetStats() const { return m_Stats; }
+    void ResetStats() { m_Stats = Stats(); }
+
+private:
+    void UpdateRange(size_t begin, size_t end, float deltaTime);
+    void RemoveExpired();
+    void MoveParticle(size_t from, size_t to);
+    // Fills m_Instances for the live particles
+    void BuildInstances();
+    void BuildInstanceRange(size_t begin, size_t end);
+
+    Properties m_Properties;
+    size_t m_Count;
+    float m_EmissionAccumulator;
+    std::mt19937 m_Random;
+
+    std::vector<float> m_PositionX;
+    std::vector<float> m_PositionY;
+    std::vector<float> m_VelocityX;
+    std::vector<float> m_VelocityY;
+    std::vector<float> m_Life;
+    std::vector<float> m_InverseLifetime;
+    std::vector<float> m_BaseSize;            // Size at birth
+    std::vector<float> m_Size;
+    std::vector<float> m_ColorR;
+    std::vector<float> m_ColorG;
+    std::vector<float> m_ColorB;
+    std::vector<float> m_ColorA;
+
+    std::vector<QuadInstance> m_Instances;
+    Stats m_Stats;
+};
+
+// Owns a set of emitters and updates and draws them together. Each
+// emitter is one draw call.
+class ParticleSystem {
+public:
+    ParticleSystem() = default;
+
+    // Delete copy constructor and assignment operator
+    ParticleSystem(const ParticleSystem&) = delete;
+    ParticleSystem& operator=(const ParticleSystem&) = delete;
+
+    // The emitter lives until DestroyEmitter() or the system goes away
+    ParticleEmitter& CreateEmitter();
+    ParticleEmitter& CreateEmitter(const ParticleEmitter::Properties& props);
+    void DestroyEmitter(ParticleEmitter& emitter);
+
+    void Update(float deltaTime);
+    void Draw();
+    void Submit(RenderQueue& queue, uint8_t layer, float depth = 0.0f);
+
+    size_t GetEmitterCount() const { return m_Emitters.size(); }
+    size_t GetParticleCount() const;
+
+private:
+    std::vector<std::unique_ptr<ParticleEmitter>> m_Emitters;
+};
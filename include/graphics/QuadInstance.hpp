@@ -0,0 +1,20 @@
+#pragma once
+#include <glm/glm.hpp>
+
+// Per-instance data for Renderer::DrawQuadsInstanced. Tightly packed so a
+// contiguous array can be uploaded to the instance buffer as-is.
+struct QuadInstance {
+    glm::vec2 Position;  // Quad center
+    glm::vec2 Size;
+    glm::vec4 Color;     // Multiplied with the texture sample
+    glm::vec4 UVRect;    // u0, v0, u1, v1
+    float Rotation;      // Radians, around the center
+
+    QuadInstance() = default;
+
+    QuadInstance(const glm::vec2& position, const glm::vec2& size,
+                 const glm::vec4& color = glm::vec4(1.0f),
+                 const glm::vec4& uvRect = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f),
+                 float rotation = 0.0f)
+        : Position(position), Size(size), Color(color), UVRect(uvRect), Rotation(rotation) {}
+};
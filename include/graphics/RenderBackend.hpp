@@ -0,0 +1,56 @@
+#pragma once
+#include "RenderQueue.hpp"
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+class Window;
+
+// Executes recorded RenderQueues against the Renderer and presents the frame.
+//
+// Game code records into GetSubmissionQueue() and calls SubmitFrame(). Inline,
+// the queue is sorted and executed immediately. Threaded, a dedicated render
+// thread owns the GL context: SubmitFrame() hands the queue over and returns,
+// so recording frame N+1 overlaps GL submission of frame N. The two queues are
+// swapped each frame; SubmitFrame() only blocks if the render thread is still
+// busy with the previous frame.
+class RenderBackend {
+public:
+    RenderBackend();
+    ~RenderBackend();
+
+    // Delete copy constructor and assignment operator
+    RenderBackend(const RenderBackend&) = delete;
+    RenderBackend& operator=(const RenderBackend&) = delete;
+
+    // Initializes the Renderer on whichever thread will own the GL context
+    bool Init(Window* window, bool threaded);
+    void Shutdown();
+
+    RenderQueue& GetSubmissionQueue() { return *m_Queues[m_WriteIndex]; }
+    void SubmitFrame();
+
+    // Block until the render thread has finished every submitted frame
+    void WaitIdle();
+
+    bool IsThreaded() const { return m_Threaded; }
+
+private:
+    void Execute(RenderQueue& queue);
+    void RenderThreadMain();
+
+    Window* m_Window;
+    std::unique_ptr<RenderQueue> m_Queues[2];
+    int m_WriteIndex;
+    bool m_Threaded;
+    bool m_Initialized;
+
+    // Render thread hand-off
+    std::thread m_Thread;
+    std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+    bool m_FramePending;
+    bool m_StopRequested;
+    bool m_ThreadReady;
+};
@@ -0,0 +1,125 @@
+#pragma once
+#include "core/LinearAllocator.hpp"
+#include "QuadInstance.hpp"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+class Camera2D;
+class Texture;
+class Mesh;
+class Shader;
+
+enum class RenderCommandType : uint8_t {
+    Quad,
+    InstancedQuads,
+    Mesh
+};
+
+// Every packet in the command stream starts with this header
+struct RenderCommand {
+    RenderCommandType Type;
+};
+
+struct QuadCommand : RenderCommand {
+    glm::vec2 Position;
+    glm::vec2 Size;
+    glm::vec4 Color;
+    const Texture* TextureRef;  // nullptr for a plain colored quad
+};
+
+struct InstancedQuadsCommand : RenderCommand {
+    uint32_t FirstInstance;  // Into the queue's instance buffer; see RenderQueue::GetInstances
+    uint32_t Count;
+    const Texture* TextureRef;
+};
+
+struct MeshCommand : RenderCommand {
+    const Mesh* MeshRef;
+    const Shader* ShaderRef;
+};
+
+// 64-bit sort key, most significant field first:
+//   [ layer : 8 ][ shader : 12 ][ texture : 20 ][ depth : 24 ]
+// Sorting groups draws by layer, then by GL state so consecutive commands
+// batch, and finally back to front by depth.
+namespace RenderKey {
+    constexpr uint64_t Make(uint8_t layer, uint32_t shader, uint32_t texture, float depth01) {
+        const float clamped = depth01 < 0.0f ? 0.0f : (depth01 > 1.0f ? 1.0f : depth01);
+        const uint64_t depthBits = static_cast<uint64_t>(clamped * 16777215.0f);
+        return (static_cast<uint64_t>(layer) << 56)
+             | (static_cast<uint64_t>(shader & 0xFFFu) << 44)
+             | (static_cast<uint64_t>(texture & 0xFFFFFu) << 24)
+             | depthBits;
+    }
+
+    constexpr uint8_t GetLayer(uint64_t key) { return static_cast<uint8_t>(key >> 56); }
+}
+
+// Per-frame list of draw commands. Packets are written into a linear arena;
+// only (key, offset) pairs are sorted, with an LSD radix sort that keeps
+// submission order for equal keys. Instance data goes into a separate
+// buffer that grows to the largest frame seen, so a big particle emitter
+// never competes with the fixed-size arena.
+//
+// Commands hold raw pointers to textures, meshes and shaders. With a threaded
+// backend those must stay alive until the frame after they were submitted.
+class RenderQueue {
+public:
+    static constexpr size_t DefaultArenaSize = 4 * 1024 * 1024;
+
+    struct Entry {
+        uint64_t Key;
+        uint32_t Offset;  // Byte offset of the packet in the arena
+    };
+
+    explicit RenderQueue(size_t arenaSize = DefaultArenaSize);
+
+    // Delete copy constructor and assignment operator
+    RenderQueue(const RenderQueue&) = delete;
+    RenderQueue& operator=(const RenderQueue&) = delete;
+
+    void Reset();
+
+    // Frame-wide state
+    void SetClearColor(const glm::vec4& color) { m_ClearColor = color; }
+    void SetCamera(const glm::mat4& projection, const glm::mat4& view);
+    void SetCamera(const Camera2D& camera);
+    const glm::vec4& GetClearColor() const { return m_ClearColor; }
+    const glm::mat4& GetProjectionMatrix() const { return m_ProjectionMatrix; }
+    const glm::mat4& GetViewMatrix() const { return m_ViewMatrix; }
+
+    // Depth is normalized to [0, 1]; larger values draw later within a state group
+    void SubmitQuad(uint8_t layer, float depth, const glm::vec2& position, const glm::vec2& size,
+                    const glm::vec4& color, const Texture* texture = nullptr);
+    void SubmitInstancedQuads(uint8_t layer, float depth, const QuadInstance* instances, size_t count,
+                              const Texture* texture = nullptr);
+    void SubmitMesh(uint8_t layer, float depth, const Mesh& mesh, const Shader& shader);
+
+    void Sort();
+
+    size_t GetCommandCount() const { return m_Entries.size(); }
+    const std::vector<Entry>& GetEntries() const { return m_Entries; }
+    const RenderCommand* GetCommand(const Entry& entry) const {
+        return reinterpret_cast<const RenderCommand*>(m_Arena.GetBase() + entry.Offset);
+    }
+    const QuadInstance* GetInstances(const InstancedQuadsCommand& command) const {
+        return m_Instances.data() + command.FirstInstance;
+    }
+
+    uint32_t GetDroppedCount() const { return m_Dropped; }
+
+private:
+    template<typename T>
+    T* Allocate(uint64_t key);
+
+    LinearAllocator m_Arena;
+    std::vector<Entry> m_Entries;
+    std::vector<Entry> m_SortScratch;
+    std::vector<QuadInstance> m_Instances;  // Cleared by Reset(), capacity kept
+
+    glm::vec4 m_ClearColor;
+    glm::mat4 m_ProjectionMatrix;
+    glm::mat4 m_ViewMatrix;
+    uint32_t m_Dropped;
+};
@@ -2,12 +2,23 @@
 #include "Shader.hpp"
 #include "Mesh.hpp"
 #include "Texture.hpp"
+#include "SpriteBatch.hpp"
+#include "UniformBuffer.hpp"
+#include "InstancedQuadRenderer.hpp"
+#include "physics/AABB.hpp"
 #include <glm/glm.hpp>
 #include <memory>
 #include <unordered_map>
+#include <vector>
+
+class Camera2D;
 
 class Renderer {
 public:
+    // Binding point of the shared "Camera" uniform block:
+    //   layout(std140) uniform Camera { mat4 projection; mat4 view; mat4 viewProjection; };
+    static constexpr unsigned int CameraBlockBinding = 0;
+
     static Renderer& getInstance() {
         static Renderer instance;
         return instance;
@@ -16,19 +27,47 @@ public:
     void Init();
     void Shutdown();
 
+    // Resets the per-frame counters (state cache binds, batch draw calls, culled quads)
+    void BeginFrame();
+
+    // Batched scene rendering. Quads drawn between BeginScene and EndScene are
+    // collected by the sprite batch; outside a scene each quad is flushed on its own.
+    void BeginScene();
+    void EndScene();
+    SpriteBatch& GetSpriteBatch() { return *m_SpriteBatch; }
+
     // Basic rendering functions
     void Clear(const glm::vec4& color = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
     void DrawMesh(const Mesh& mesh, const Shader& shader);
+    // Rectangles outside the view of the camera last set with SetCamera() are skipped
     void DrawRectangle(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color);
     void DrawTexturedRectangle(const glm::vec2& position, const glm::vec2& size, 
                              const Texture& texture, const glm::vec4& tint = glm::vec4(1.0f));
 
-    // Camera and transformation
+    // Draw a contiguous array of quads sharing one texture (white if null) in a single draw call
+    void DrawQuadsInstanced(const QuadInstance* instances, size_t count, const Texture* texture = nullptr);
+    void DrawQuadsInstanced(const std::vector<QuadInstance>& instances, const Texture* texture = nullptr) {
+        DrawQuadsInstanced(instances.data(), instances.size(), texture);
+    }
+
+    // Draw prebuilt static geometry with the sprite shader in one call. The
+    // VAO uses the sprite vertex inputs (0: position, 1: UV, 2: color) and has
+    // an element buffer of 32-bit indices bound; see TileMap.
+    void DrawIndexed(unsigned int vao, size_t indexCount, const Texture* texture = nullptr);
+
+    // Camera and transformation. Setting the matrices already in use does
+    // nothing, so the camera block is only uploaded when the camera moved.
+    // Raw matrices turn culling off; a Camera2D also provides the view bounds.
+    void SetCamera(const Camera2D& camera);
     void SetProjectionMatrix(const glm::mat4& projection);
     void SetViewMatrix(const glm::mat4& view);
     const glm::mat4& GetProjectionMatrix() const { return m_ProjectionMatrix; }
     const glm::mat4& GetViewMatrix() const { return m_ViewMatrix; }
 
+    // False only for boxes known to be off screen
+    bool IsVisible(const AABB& box) const { return !m_HasViewBounds || m_ViewBounds.Overlaps(box); }
+    uint32_t GetCulledCount() const { return m_CulledCount; }
+
 private:
     Renderer();
     ~Renderer();
@@ -37,15 +76,27 @@ private:
 
     void CreateDefaultShaders();
     void CreateDefaultMeshes();
+    void OnCameraChanged();
+    void UploadCameraIfDirty();
 
     // Matrices
     glm::mat4 m_ProjectionMatrix;
     glm::mat4 m_ViewMatrix;
+    glm::mat4 m_ViewProjectionMatrix;
+    std::unique_ptr<UniformBuffer> m_CameraUBO;
+    bool m_CameraDirty;
+
+    // Culling
+    AABB m_ViewBounds;
+    bool m_HasViewBounds;
+    uint32_t m_CulledCount;
 
     // Default resources
-    std::shared_ptr<Shader> m_ColorShader;
-    std::shared_ptr<Shader> m_TextureShader;
+    std::shared_ptr<Shader> m_SpriteShader;
+    std::shared_ptr<Shader> m_InstanceShader;
     std::unique_ptr<Mesh> m_QuadMesh;
+    std::unique_ptr<SpriteBatch> m_SpriteBatch;
+    std::unique_ptr<InstancedQuadRenderer> m_InstancedQuads;
 
     bool m_Initialized;
 };
@@ -1,14 +1,44 @@
 #pragma once
 #include <string>
+#include <vector>
+#include <cstdint>
 #include <glm/glm.hpp>
 
 class Shader {
 public:
+    // Handle to a uniform resolved once after linking. Setting a uniform through
+    // a handle skips both the name lookup and the driver round trip.
+    struct Uniform {
+        int Location = -1;
+        bool IsValid() const { return Location >= 0; }
+    };
+
     Shader();
     ~Shader();
 
     bool Init(const std::string& vertexSource, const std::string& fragmentSource);
     void Use() const;
+    unsigned int GetProgram() const { return m_Program; }
+
+    // Uniform reflection (filled at link time)
+    Uniform GetUniform(const std::string& name) const;
+    bool HasUniform(const std::string& name) const { return GetUniform(name).IsValid(); }
+    size_t GetUniformCount() const { return m_Uniforms.size(); }
+
+    // Attach a named uniform block to a uniform buffer binding point.
+    // Returns false if the program has no block with that name.
+    bool BindUniformBlock(const std::string& name, unsigned int bindingPoint) const;
+
+    // Handle-based setters
+    void SetBool(Uniform uniform, bool value) const;
+    void SetInt(Uniform uniform, int value) const;
+    void SetFloat(Uniform uniform, float value) const;
+    void SetVec2(Uniform uniform, const glm::vec2& value) const;
+    void SetVec3(Uniform uniform, const glm::vec3& value) const;
+    void SetVec4(Uniform uniform, const glm::vec4& value) const;
+    void SetMat4(Uniform uniform, const glm::mat4& value) const;
+
+    // Name-based setters (resolved through the reflection table)
     void SetBool(const std::string& name, bool value) const;
     void SetInt(const std::string& name, int value) const;
     void SetFloat(const std::string& name, float value) const;
@@ -17,7 +47,28 @@ public:
     void SetVec4(const std::string& name, const glm::vec4& value) const;
     void SetMat4(const std::string& name, const glm::mat4& value) const;
 
+    // Prevent copying
+    Shader(const Shader&) = delete;
+    Shader& operator=(const Shader&) = delete;
+
 private:
+    struct UniformEntry {
+        uint64_t Hash;
+        int Location;
+    };
+
+    struct UniformBlockEntry {
+        uint64_t Hash;
+        unsigned int Index;
+        mutable int Binding;
+    };
+
     bool CompileShader(unsigned int& shader, const std::string& source, unsigned int type);
+    void ReflectUniforms();
+
     unsigned int m_Program;
+
+    // Sorted by hash for binary search
+    std::vector<UniformEntry> m_Uniforms;
+    std::vector<UniformBlockEntry> m_UniformBlocks;
 };
@@ -0,0 +1,47 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+// Bottom-left skyline rectangle packer for a single fixed-size page.
+// The skyline is a list of horizontal segments describing the top edge of
+// everything placed so far; each rectangle goes where it rests lowest.
+class SkylinePacker {
+public:
+    struct Rect {
+        int X = 0;
+        int Y = 0;
+        int Width = 0;
+        int Height = 0;
+    };
+
+    SkylinePacker(int width, int height, int padding = 1);
+
+    // Returns false if the rectangle does not fit anywhere on the page
+    bool Pack(int width, int height, Rect& outRect);
+    void Reset();
+
+    int GetWidth() const { return m_Width; }
+    int GetHeight() const { return m_Height; }
+    int GetPadding() const { return m_Padding; }
+
+    // Fraction of the page covered by packed rectangles (including padding)
+    float GetOccupancy() const;
+
+private:
+    struct Segment {
+        int X;
+        int Y;
+        int Width;
+    };
+
+    // Height at which a rectangle of the given width would rest if its left
+    // edge sits on segment index; -1 if it runs off the page
+    int FitAt(size_t index, int width, int height) const;
+    void Insert(size_t index, int x, int y, int width, int height);
+
+    int m_Width;
+    int m_Height;
+    int m_Padding;
+    long long m_UsedArea;
+    std::vector<Segment> m_Skyline;
+};
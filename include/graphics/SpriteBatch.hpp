@@ -0,0 +1,80 @@
+#pragma once
+#include "Vertex.hpp"
+#include "Shader.hpp"
+#include "Texture.hpp"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Batches colored and textured quads into a single streaming vertex buffer.
+//
+// Quads are accumulated on the CPU and flushed in chunks of up to MaxQuads.
+// A flush happens when the batch is full, when the shader or texture changes,
+// or on End(). Untextured quads sample a 1x1 white texture so colored and
+// textured sprites sharing a shader end up in the same draw call. Camera
+// matrices come from the Renderer's "Camera" uniform block.
+class SpriteBatch {
+public:
+    static constexpr uint32_t MaxQuads = 16384;
+    static constexpr uint32_t MaxVertices = MaxQuads * 4;
+    static constexpr uint32_t MaxIndices = MaxQuads * 6;
+
+    // Number of chunks the streaming buffer can hold before it is orphaned
+    static constexpr uint32_t BufferChunks = 4;
+
+    struct Stats {
+        uint32_t DrawCalls = 0;
+        uint32_t QuadCount = 0;
+    };
+
+    SpriteBatch();
+    ~SpriteBatch();
+
+    bool Init(std::shared_ptr<Shader> defaultShader);
+    void Shutdown();
+
+    void Begin();
+    void End();
+    void Flush();
+
+    // Switch the shader used for subsequent quads (nullptr restores the default)
+    void SetShader(const Shader* shader);
+
+    // Position is the quad center, matching Renderer::DrawRectangle
+    void Submit(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color);
+    void Submit(const glm::vec2& position, const glm::vec2& size, const Texture& texture,
+                const glm::vec4& tint = glm::vec4(1.0f),
+                const glm::vec4& uvRect = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f));
+
+    // Submit four pre-transformed vertices (bottom-left, bottom-right, top-right, top-left)
+    void SubmitQuad(const Vertex* vertices, unsigned int textureID);
+
+    bool IsActive() const { return m_Active; }
+    const Texture& GetWhiteTexture() const { return m_WhiteTexture; }
+    const Stats& GetStats() const { return m_Stats; }
+    void ResetStats() { m_Stats = Stats(); }
+
+    // Prevent copying
+    SpriteBatch(const SpriteBatch&) = delete;
+    SpriteBatch& operator=(const SpriteBatch&) = delete;
+
+private:
+    void CreateBuffers();
+    void CleanupBuffers();
+
+    std::vector<Vertex> m_Vertices;
+    uint32_t m_QuadCount;
+
+    unsigned int m_VAO, m_VBO, m_EBO;
+    uint32_t m_BufferCursor; // In vertices
+
+    std::shared_ptr<Shader> m_DefaultShader;
+    const Shader* m_CurrentShader;
+    unsigned int m_CurrentTexture;
+    Texture m_WhiteTexture;
+
+    bool m_Active;
+    bool m_Initialized;
+    Stats m_Stats;
+};
@@ -1,5 +1,6 @@
 #pragma once
 #include "core/Resource.hpp"
+#include <cstddef>
 #include <string>
 
 class Texture : public Resource {
@@ -10,9 +11,19 @@ public:
     // Implement Resource interface
     bool loadFromFile(const std::string& path) override;
 
+    // Create the texture from raw pixel data (1, 3 or 4 channels)
+    bool LoadFromMemory(const unsigned char* data, int width, int height, int channels);
+
+    // Same, sourcing the pixels from the currently bound GL_PIXEL_UNPACK_BUFFER
+    bool LoadFromPixelBuffer(size_t offset, int width, int height, int channels);
+
+    // Upload a cooked texture (see TextureFormat.hpp) with its pre-built mip
+    // chain; loadFromFile() forwards .ptex paths here
+    bool LoadFromContainer(const std::string& path);
+
     // Texture-specific functionality
     void Bind(unsigned int slot = 0) const;
-    void Unbind() const;
+    void Unbind(unsigned int slot = 0) const;
 
     // Getters
     unsigned int GetID() const { return m_TextureID; }
@@ -21,6 +32,7 @@ public:
     int GetChannels() const { return m_Channels; }
 
 private:
+    bool Upload(const void* pixels, int width, int height, int channels);
     void Cleanup();
 
     unsigned int m_TextureID;
@@ -0,0 +1,61 @@
+#pragma once
+#include "core/Resource.hpp"
+#include "core/MappedFile.hpp"
+#include "AtlasFormat.hpp"
+#include "Texture.hpp"
+#include <glm/glm.hpp>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Many sprites packed into a few large texture pages, addressed by name.
+//
+// Offline mode: loadFromFile() memory-maps an index written by the
+// AtlasPacker tool and loads its page images through the ResourceManager.
+// Runtime mode: Build() decodes and packs a set of images at load time.
+// Both modes look regions up the same way, by binary search on the name hash.
+class TextureAtlas : public Resource {
+public:
+    struct Region {
+        uint32_t Page = 0;
+        glm::vec4 UVRect = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);  // u0, v0, u1, v1
+        int Width = 0;
+        int Height = 0;
+    };
+
+    TextureAtlas();
+    ~TextureAtlas() = default;
+
+    // Implement Resource interface (offline mode)
+    bool loadFromFile(const std::string& path) override;
+
+    // Runtime mode: (sprite name, image path) pairs
+    bool Build(const std::string& name, const std::vector<std::pair<std::string, std::string>>& sprites,
+               int pageSize = 2048, int padding = 1);
+
+    bool GetRegion(const std::string& name, Region& outRegion) const;
+    bool HasRegion(const std::string& name) const;
+
+    const Texture* GetPage(uint32_t index) const;
+    size_t GetPageCount() const { return m_Pages.size(); }
+    size_t GetRegionCount() const { return m_RegionCount; }
+
+private:
+    const AtlasRegionEntry* FindEntry(const std::string& name) const;
+    void Clear();
+
+    // Offline mode keeps the index mapped and points straight into it
+    MappedFile m_Index;
+
+    // Runtime mode owns the same tables
+    std::vector<AtlasRegionEntry> m_OwnedRegions;
+    std::vector<char> m_OwnedStrings;
+
+    const AtlasRegionEntry* m_Regions;
+    size_t m_RegionCount;
+    const char* m_Strings;
+    size_t m_StringsSize;
+
+    std::vector<std::shared_ptr<Texture>> m_Pages;
+};
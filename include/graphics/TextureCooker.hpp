@@ -0,0 +1,23 @@
+#pragma once
+#include <string>
+#include <vector>
+
+// Converts decoded images into the cooked texture format (TextureFormat.hpp).
+// Used by the offline TextureCooker tool; kept in the engine library so
+// tests and editor code can cook textures too.
+class TextureCooker {
+public:
+    struct MipLevel {
+        int Width = 0;
+        int Height = 0;
+        std::vector<unsigned char> Pixels;  // Tightly packed, bottom row first
+    };
+
+    // Full chain down to 1x1 using a 2x2 box filter
+    static std::vector<MipLevel> BuildMipChain(const unsigned char* pixels, int width, int height, int channels);
+
+    // Compression is silently skipped when the build has no LZ4
+    static bool Write(const std::string& path, const std::vector<MipLevel>& mips, int channels, bool compress);
+
+    static bool IsCompressionAvailable();
+};
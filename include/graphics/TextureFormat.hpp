@@ -0,0 +1,45 @@
+#pragma once
+#include <cstdint>
+
+// On-disk layout of a cooked texture (.ptex). Everything is little-endian;
+// the file is meant to be memory-mapped and uploaded level by level:
+//
+//   TextureFileHeader
+//   TextureMipEntry[MipCount]       level 0 (full size) first
+//   mip data                        each level 16-byte aligned
+//
+// Uncompressed levels are exactly what glTexImage2D expects: tightly packed
+// rows (unpack alignment 1), bottom row first to match the engine's flipped
+// loading. Compressed levels are independent LZ4 blocks.
+namespace TextureFormat {
+    constexpr char Magic[4] = { 'P', 'T', 'E', 'X' };
+    constexpr uint32_t Version = 1;
+    constexpr const char* Extension = ".ptex";
+
+    enum class Compression : uint32_t {
+        None = 0,
+        LZ4 = 1
+    };
+}
+
+struct TextureFileHeader {
+    char Magic[4];
+    uint32_t Version;
+    uint32_t Width;
+    uint32_t Height;
+    uint32_t Channels;     // 1, 3 or 4 (8 bits each)
+    uint32_t MipCount;
+    uint32_t Compression;  // TextureFormat::Compression
+    uint32_t Reserved;
+};
+
+struct TextureMipEntry {
+    uint64_t Offset;      // From the start of the file
+    uint32_t StoredSize;  // Bytes on disk
+    uint32_t Size;        // Bytes once decompressed
+    uint32_t Width;
+    uint32_t Height;
+};
+
+static_assert(sizeof(TextureFileHeader) == 32, "TextureFileHeader layout changed");
+static_assert(sizeof(TextureMipEntry) == 24, "TextureMipEntry layout changed");
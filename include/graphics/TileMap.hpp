@@ -0,0 +1,130 @@
+#pragma once
+#include "Texture.hpp"
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class Camera2D;
+
+using TileId = uint16_t;
+
+// A grid of equally sized tiles inside one texture, or inside one region of
+// an atlas page (pass TextureAtlas::Region::UVRect). Tile ids start at 1 in
+// the top-left cell and run left to right, top to bottom; 0 is empty.
+struct Tileset {
+    std::shared_ptr<Texture> Sheet;
+    glm::vec4 UVRect{ 0.0f, 0.0f, 1.0f, 1.0f };  // u0, v0, u1, v1
+    int Columns = 1;
+    int Rows = 1;
+
+    // u0, v0, u1, v1 of one tile
+    glm::vec4 GetTileUV(TileId tile) const;
+};
+
+// Static tile layer drawn from baked per-chunk vertex buffers.
+//
+// Tiles are grouped into ChunkSize x ChunkSize chunks. A chunk's quads are
+// baked once into a static VBO (all chunks share one index buffer) and drawn
+// with a single call; only chunks overlapping the view are drawn. Changing a
+// tile marks its chunk dirty, and a dirty chunk is rebuilt the next time it
+// is drawn, so edits off screen cost nothing until they come into view.
+// Empty chunks never get GPU buffers, and at most MaxResidentChunks keep
+// theirs; the least recently drawn is released first.
+//
+// Tile (0, 0) is the bottom-left one; world positions grow up and right
+// from the map's origin, matching the physics world.
+class TileMap {
+public:
+    static constexpr TileId EmptyTile = 0;
+    static constexpr int ChunkSize = 32;
+    static constexpr size_t DefaultMaxResidentChunks = 256;
+
+    struct Stats {
+        uint32_t DrawCalls = 0;
+        uint32_t ChunksVisible = 0;    // Overlapping the view, including empty ones
+        uint32_t ChunksRebuilt = 0;
+        uint32_t TilesDrawn = 0;
+    };
+
+    TileMap(int width, int height, float tileSize = 16.0f, const glm::vec2& origin = glm::vec2(0.0f));
+    ~TileMap();
+
+    // Delete copy constructor and assignment operator
+    TileMap(const TileMap&) = delete;
+    TileMap& operator=(const TileMap&) = delete;
+
+    void SetTileset(const Tileset& tileset);
+    const Tileset& GetTileset() const { return m_Tileset; }
+
+    // Out-of-range reads return EmptyTile; out-of-range writes are ignored
+    TileId GetTile(int x, int y) const;
+    void SetTile(int x, int y, TileId tile);
+    void Fill(int x, int y, int width, int height, TileId tile);
+
+    // Submits every chunk overlapping the world-space rectangle
+    void Draw(const glm::vec2& viewMin, const glm::vec2& viewMax);
+    // Submits every chunk overlapping the camera's view bounds
+    void Draw(const Camera2D& camera);
+
+    // Releases all GPU buffers; they are recreated on the next Draw()
+    void ReleaseGpuResources();
+
+    void SetMaxResidentChunks(size_t count) { m_MaxResidentChunks = count > 0 ? count : 1; }
+    size_t GetResidentChunkCount() const { return m_Resident.size(); }
+
+    glm::ivec2 WorldToTile(const glm::vec2& position) const;
+    glm::vec2 TileToWorld(int x, int y) const;  // Bottom-left corner
+
+    int GetWidth() const { return m_Width; }
+    int GetHeight() const { return m_Height; }
+    float GetTileSize() const { return m_TileSize; }
+    const glm::vec2& GetOrigin() const { return m_Origin; }
+    int GetChunksX() const { return m_ChunksX; }
+    int GetChunksY() const { return m_ChunksY; }
+    bool IsChunkDirty(int chunkX, int chunkY) const;
+
+    const Stats& GetStats() const { return m_Stats; }
+    void ResetStats() { m_Stats = Stats(); }
+
+private:
+    // Position and UV as floats plus a packed RGBA8 color: 20 bytes a vertex
+    struct TileVertex {
+        glm::vec2 Position;
+        glm::vec2 TexCoords;
+        uint32_t Color;
+    };
+
+    struct Chunk {
+        unsigned int VAO = 0;
+        unsigned int VBO = 0;
+        uint32_t QuadCount = 0;
+        uint64_t LastDrawn = 0;
+        bool Dirty = true;
+    };
+
+    void RebuildChunk(uint32_t index);
+    void ReleaseChunk(Chunk& chunk);
+    void EvictLeastRecentlyDrawn();
+    void CreateIndexBuffer();
+    void MarkAllDirty();
+
+    int m_Width;
+    int m_Height;
+    float m_TileSize;
+    glm::vec2 m_Origin;
+    int m_ChunksX;
+    int m_ChunksY;
+
+    std::vector<TileId> m_Tiles;     // Row-major, bottom row first
+    std::vector<Chunk> m_Chunks;     // Row-major
+    std::vector<uint32_t> m_Resident;
+    std::vector<TileVertex> m_Scratch;
+
+    Tileset m_Tileset;
+    unsigned int m_IndexBuffer;      // Enough quads for a full chunk, shared
+    size_t m_MaxResidentChunks;
+    uint64_t m_DrawCounter;
+    Stats m_Stats;
+};
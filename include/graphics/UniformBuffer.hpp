@@ -0,0 +1,26 @@
+#pragma once
+#include <cstddef>
+
+// GPU buffer bound to a uniform block binding point, shared by every shader
+// that declares a matching block.
+class UniformBuffer {
+public:
+    UniformBuffer(size_t size, unsigned int bindingPoint);
+    ~UniformBuffer();
+
+    void SetData(const void* data, size_t size, size_t offset = 0);
+
+    // Getters
+    bool IsValid() const { return m_UBO != 0; }
+    unsigned int GetBindingPoint() const { return m_BindingPoint; }
+    size_t GetSize() const { return m_Size; }
+
+    // Prevent copying
+    UniformBuffer(const UniformBuffer&) = delete;
+    UniformBuffer& operator=(const UniformBuffer&) = delete;
+
+private:
+    unsigned int m_UBO;
+    unsigned int m_BindingPoint;
+    size_t m_Size;
+};
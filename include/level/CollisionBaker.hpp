@@ -0,0 +1,29 @@
+#pragma once
+#include "LevelFormat.hpp"
+#include "physics/AABB.hpp"
+#include "physics/PhysicsWorld.hpp"
+#include <glm/glm.hpp>
+#include <vector>
+
+// Turns a tile collision layer into a few large static colliders.
+//
+// Solid tiles are merged greedily into rectangles: each run starts at the
+// lowest, leftmost unmerged solid tile, grows right as far as it can, then
+// up while every tile of the next row is free and solid. One-way tiles only
+// merge along a row, since every tile stacked above another keeps a top the
+// player can land on. Levels made of long floors and walls typically end up
+// with one collider per ten or more tiles, with no seams for bodies sliding
+// along a floor to catch on.
+class CollisionBaker {
+public:
+    struct Collider {
+        AABB Box;
+        StaticType Type;
+    };
+
+    // Bakes the width x height block starting at 'tiles' (rows 'stride'
+    // tiles apart, bottom row first) and appends the colliders to 'out'.
+    // 'origin' is the world position of the block's bottom-left corner.
+    static void Bake(const LevelFormat::Collision* tiles, int width, int height, int stride,
+                     float tileSize, const glm::vec2& origin, std::vector<Collider>& out);
+};
@@ -0,0 +1,78 @@
+#pragma once
+#include "LevelFormat.hpp"
+#include "LevelStreamer.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+class PhysicsWorld;
+
+// Keeps a PhysicsWorld's static colliders in step with the sections a
+// LevelStreamer has loaded, and with collision tiles changed at runtime.
+//
+// Loading a section adds the colliders baked when the level was cooked;
+// nothing is merged at load time. Changing a tile copies that section's
+// collision layer, and the next Update() re-bakes just that section, so
+// destroying a tile costs one section's worth of merging no matter how big
+// the level is. Edited layers outlive unloading, so a section comes back
+// the way it was left.
+//
+// Forward the streamer's load and unload callbacks to OnSectionLoaded() and
+// OnSectionUnloaded(). Must be destroyed before the world.
+class LevelCollision {
+public:
+    struct Stats {
+        uint32_t SectionsRebaked = 0;
+        uint32_t CollidersAdded = 0;
+        uint32_t CollidersRemoved = 0;
+    };
+
+    LevelCollision(PhysicsWorld& world, const LevelStreamer& streamer);
+    ~LevelCollision();
+
+    // Delete copy constructor and assignment operator
+    LevelCollision(const LevelCollision&) = delete;
+    LevelCollision& operator=(const LevelCollision&) = delete;
+
+    void OnSectionLoaded(const LevelStreamer::Section& section);
+    void OnSectionUnloaded(const LevelStreamer::Section& section);
+
+    // None outside loaded sections
+    LevelFormat::Collision GetCollision(int tileX, int tileY) const;
+    // Only tiles in loaded sections can change; returns false for others
+    bool SetCollision(int tileX, int tileY, LevelFormat::Collision type);
+
+    // Re-bakes the sections changed since the last call
+    void Update();
+
+    // Static colliders currently in the world on behalf of the level
+    size_t GetColliderCount() const { return m_ColliderCount; }
+
+    const Stats& GetStats() const { return m_Stats; }
+    void ResetStats() { m_Stats = Stats(); }
+
+private:
+    struct SectionState {
+        std::vector<uint32_t> Statics;               // PhysicsWorld ids
+        const LevelFormat::Collision* Layer = nullptr;  // Mapped, or Edited.data()
+        std::vector<LevelFormat::Collision> Edited;  // Copy made on the first change
+        int X = 0;
+        int Y = 0;
+        bool Loaded = false;
+        bool Dirty = false;
+    };
+
+    // Section index and tile index within it; false outside the level
+    bool LocateTile(int tileX, int tileY, uint32_t& section, size_t& tile) const;
+    void AddStatics(SectionState& state, const LevelStreamer::Section& section);
+    void Rebake(SectionState& state);
+    void RemoveStatics(SectionState& state);
+
+    PhysicsWorld& m_World;
+    const LevelStreamer& m_Streamer;
+    std::unordered_map<uint32_t, SectionState> m_Sections;  // By section index
+    std::vector<uint32_t> m_DirtySections;
+    size_t m_ColliderCount;
+    Stats m_Stats;
+};
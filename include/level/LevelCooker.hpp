@@ -0,0 +1,33 @@
+#pragma once
+#include "LevelFormat.hpp"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Writes levels in the cooked level format (LevelFormat.hpp), baking each
+// section's collision layer into merged colliders on the way. Used by
+// editor and tooling code; the game only ever streams the result through
+// LevelStreamer.
+class LevelCooker {
+public:
+    static constexpr int DefaultSectionSize = 64;
+
+    struct Spawn {
+        std::string Type;
+        glm::vec2 Position{ 0.0f };
+        uint32_t Param = 0;
+    };
+
+    struct Level {
+        int Width = 0;                                  // In tiles
+        int Height = 0;
+        float TileSize = 16.0f;
+        glm::vec2 Origin{ 0.0f };
+        std::vector<uint16_t> Tiles;                    // Width * Height, bottom row first
+        std::vector<LevelFormat::Collision> Collision;  // Same size, or empty for none
+        std::vector<Spawn> Spawns;                      // Stored with the section they are in
+    };
+
+    static bool Write(const std::string& path, const Level& level, int sectionSize = DefaultSectionSize);
+};
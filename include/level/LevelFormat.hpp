@@ -0,0 +1,79 @@
+#pragma once
+#include <cstdint>
+
+// On-disk layout of a cooked level (.plvl). Everything is little-endian and
+// meant to be used straight out of a memory mapping:
+//
+//   LevelFileHeader
+//   LevelSectionEntry[SectionsX * SectionsY]   row-major, bottom row first
+//   section data                               each section page-aligned
+//
+// The level is cut into square sections of SectionSize tiles. Each section
+// holds its own layers, so streaming one in touches only its own pages:
+//
+//   uint16_t tiles[SectionSize * SectionSize]      TileMap ids, row-major
+//   uint8_t collision[SectionSize * SectionSize]   LevelFormat::Collision
+//   LevelSpawnEntry spawns[SpawnCount]             8-byte aligned
+//   LevelColliderEntry colliders[ColliderCount]    collision layer, baked
+//
+// Sections on the right and top edges are padded with empty tiles. The
+// baked colliders (see CollisionBaker) never cross a section boundary, so
+// each section's physics can come and go with it.
+namespace LevelFormat {
+    constexpr char Magic[4] = { 'P', 'L', 'V', 'L' };
+    constexpr uint32_t Version = 2;
+    constexpr const char* Extension = ".plvl";
+    constexpr uint32_t SectionAlignment = 4096;
+
+    enum class Collision : uint8_t {
+        None = 0,
+        Solid = 1,
+        OneWay = 2
+    };
+}
+
+struct LevelFileHeader {
+    char Magic[4];
+    uint32_t Version;
+    uint32_t Width;          // In tiles
+    uint32_t Height;
+    uint32_t SectionSize;    // Tiles along each side of a section
+    uint32_t SectionsX;
+    uint32_t SectionsY;
+    float TileSize;          // World units
+    float OriginX;           // World position of tile (0, 0)'s bottom-left corner
+    float OriginY;
+    uint32_t SectionTableOffset;
+    uint32_t Reserved;
+};
+
+struct LevelSectionEntry {
+    uint64_t Offset;           // From the start of the file
+    uint32_t Size;             // Bytes, all layers
+    uint32_t CollisionOffset;  // From the section start; tiles are at 0
+    uint32_t SpawnOffset;      // From the section start
+    uint32_t SpawnCount;
+    uint32_t ColliderOffset;   // From the section start
+    uint32_t ColliderCount;
+};
+
+struct LevelSpawnEntry {
+    uint64_t TypeHash;  // HashString of the entity type name
+    float X;            // World position
+    float Y;
+    uint32_t Param;     // Meaning depends on the type
+    uint32_t Reserved;
+};
+
+struct LevelColliderEntry {
+    float MinX;         // World space
+    float MinY;
+    float MaxX;
+    float MaxY;
+    uint32_t Type;      // LevelFormat::Collision, never None
+};
+
+static_assert(sizeof(LevelFileHeader) == 48, "LevelFileHeader layout changed");
+static_assert(sizeof(LevelSectionEntry) == 32, "LevelSectionEntry layout changed");
+static_assert(sizeof(LevelSpawnEntry) == 24, "LevelSpawnEntry layout changed");
+static_assert(sizeof(LevelColliderEntry) == 20, "LevelColliderEntry layout changed");
@@ -0,0 +1,125 @@
+#pragma once
+#include "LevelFormat.hpp"
+#include "core/MappedFile.hpp"
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Streams the sections of a cooked level (LevelFormat.hpp) in and out of
+// memory around the camera.
+//
+// The file is memory-mapped for random access and only its header and
+// section table are read on Open(), so startup touches a page or two no
+// matter how large the level is. Each Update() loads the sections that
+// overlap the view, asks the OS to prefetch the ones the view is heading
+// towards, and drops the least recently needed sections once the resident
+// data exceeds the memory budget.
+//
+// Section layers are used in place, straight from the mapping. The pointers
+// in a Section stay valid until that section is unloaded.
+class LevelStreamer {
+public:
+    struct Properties {
+        size_t MemoryBudget = 16 * 1024 * 1024;  // Bytes of section data kept resident
+        float PrefetchTime = 0.75f;              // Seconds of movement to prefetch ahead
+        float LoadMargin = 0.0f;                 // World units loaded around the view
+    };
+
+    struct Section {
+        int X = 0;                  // Section coordinates
+        int Y = 0;
+        int TileX = 0;              // Level coordinates of the first tile
+        int TileY = 0;
+        int Size = 0;               // Tiles along each side, padding included
+        const uint16_t* Tiles = nullptr;               // Size * Size TileMap ids, bottom row first
+        const LevelFormat::Collision* Collision = nullptr;
+        const LevelSpawnEntry* Spawns = nullptr;
+        uint32_t SpawnCount = 0;
+        const LevelColliderEntry* Colliders = nullptr;  // Baked from Collision
+        uint32_t ColliderCount = 0;
+    };
+
+    struct Stats {
+        uint32_t SectionsLoaded = 0;
+        uint32_t SectionsUnloaded = 0;   // Loaded sections evicted
+        uint32_t SectionsPrefetched = 0;
+    };
+
+    using SectionCallback = std::function<void(const Section&)>;
+
+    LevelStreamer();
+    ~LevelStreamer();
+
+    // Delete copy constructor and assignment operator
+    LevelStreamer(const LevelStreamer&) = delete;
+    LevelStreamer& operator=(const LevelStreamer&) = delete;
+
+    bool Open(const std::string& path);
+    bool Open(const std::string& path, const Properties& props);
+    // Unloads every loaded section, firing the unload callback for each
+    void Close();
+    bool IsOpen() const { return m_File.IsOpen(); }
+
+    // Called as sections come in and just before they go away
+    void SetOnSectionLoaded(SectionCallback callback) { m_OnLoaded = std::move(callback); }
+    void SetOnSectionUnloaded(SectionCallback callback) { m_OnUnloaded = std::move(callback); }
+
+    // viewMin/viewMax is the world-space area that must be loaded; velocity
+    // (world units per second) decides what is prefetched
+    void Update(const glm::vec2& viewMin, const glm::vec2& viewMax, const glm::vec2& velocity = glm::vec2(0.0f));
+
+    const Properties& GetProperties() const { return m_Properties; }
+    void SetMemoryBudget(size_t bytes) { m_Properties.MemoryBudget = bytes; }
+    size_t GetResidentBytes() const { return m_ResidentBytes; }
+    size_t GetLoadedSectionCount() const;
+    bool IsSectionLoaded(int x, int y) const;
+    bool IsSectionResident(int x, int y) const;  // Loaded or prefetched
+
+    // Valid while open
+    const LevelFileHeader& GetHeader() const { return m_Header; }
+    Section GetSection(int x, int y) const;
+
+    const Stats& GetStats() const { return m_Stats; }
+    void ResetStats() { m_Stats = Stats(); }
+
+private:
+    enum class SectionState : uint8_t {
+        Unloaded,
+        Prefetched,  // Pages requested from the OS, not handed to the game yet
+        Loaded
+    };
+
+    struct SectionSlot {
+        SectionState State = SectionState::Unloaded;
+        uint64_t LastNeeded = 0;
+    };
+
+    struct SectionRange {
+        int MinX, MinY, MaxX, MaxY;  // Inclusive; empty when Min > Max
+    };
+
+    SectionRange GetOverlappingSections(const glm::vec2& min, const glm::vec2& max) const;
+    bool ValidateSections() const;
+    size_t GetResidentSize(uint32_t index) const;
+    void MakeResident(uint32_t index, SectionState state);
+    void Evict(uint32_t index);
+    void EvictOverBudget();
+
+    MappedFile m_File;
+    std::string m_Path;
+    LevelFileHeader m_Header;
+    const LevelSectionEntry* m_Entries;
+    std::vector<SectionSlot> m_Slots;
+    std::vector<uint32_t> m_Resident;
+
+    Properties m_Properties;
+    SectionCallback m_OnLoaded;
+    SectionCallback m_OnUnloaded;
+    size_t m_ResidentBytes;
+    uint64_t m_UpdateCounter;
+    bool m_WarnedOverBudget;
+    Stats m_Stats;
+};
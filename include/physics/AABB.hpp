@@ -0,0 +1,34 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <algorithm>
+
+// Axis-aligned bounding box. Touching boxes do not overlap.
+struct AABB {
+    glm::vec2 Min{ 0.0f };
+    glm::vec2 Max{ 0.0f };
+
+    static AABB FromCenter(const glm::vec2& center, const glm::vec2& halfExtents) {
+        return { center - halfExtents, center + halfExtents };
+    }
+
+    glm::vec2 GetCenter() const { return (Min + Max) * 0.5f; }
+    glm::vec2 GetHalfExtents() const { return (Max - Min) * 0.5f; }
+
+    bool Overlaps(const AABB& other) const {
+        return Min.x < other.Max.x && Max.x > other.Min.x
+            && Min.y < other.Max.y && Max.y > other.Min.y;
+    }
+
+    bool Contains(const glm::vec2& point) const {
+        return point.x >= Min.x && point.x <= Max.x && point.y >= Min.y && point.y <= Max.y;
+    }
+
+    AABB Merged(const AABB& other) const {
+        return { glm::min(Min, other.Min), glm::max(Max, other.Max) };
+    }
+
+    AABB Expanded(float margin) const {
+        return { Min - glm::vec2(margin), Max + glm::vec2(margin) };
+    }
+};
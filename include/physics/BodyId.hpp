@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+
+// Generational reference to a PhysicsWorld body; see Entity for the scheme
+struct BodyId {
+    uint32_t Index = 0;
+    uint32_t Generation = 0;
+
+    bool IsValid() const { return Generation != 0; }
+
+    bool operator==(const BodyId& other) const { return Index == other.Index && Generation == other.Generation; }
+    bool operator!=(const BodyId& other) const { return !(*this == other); }
+};
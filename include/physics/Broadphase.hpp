@@ -0,0 +1,69 @@
+#pragma once
+
+#include "AABB.hpp"
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+// Two proxies whose boxes overlap, as their user data; First < Second
+struct BroadphasePair {
+    uint32_t First;
+    uint32_t Second;
+
+    bool operator==(const BroadphasePair& other) const { return First == other.First && Second == other.Second; }
+    bool operator<(const BroadphasePair& other) const {
+        return First != other.First ? First < other.First : Second < other.Second;
+    }
+};
+
+enum class BroadphaseType : uint8_t {
+    SpatialHash,
+    AABBTree,
+};
+
+// Finds which boxes might touch without testing every pair. Proxies carry a
+// user value (PhysicsWorld stores a body slot) that is what queries and
+// pairs report. Implementations update incrementally: MoveProxy() is cheap
+// when a box stays within the cells or fattened node it already occupies.
+//
+// Queries never allocate and, being const, may run concurrently with each
+// other but not with changes to the proxies.
+class Broadphase {
+public:
+    using ProxyId = uint32_t;
+    static constexpr ProxyId NullProxy = ~0u;
+
+    // Return false to stop the query early
+    using QueryCallback = bool (*)(void* context, uint32_t userData);
+
+    virtual ~Broadphase() = default;
+
+    virtual ProxyId CreateProxy(const AABB& bounds, uint32_t userData) = 0;
+    virtual void DestroyProxy(ProxyId proxy) = 0;
+    virtual void MoveProxy(ProxyId proxy, const AABB& bounds) = 0;
+    virtual void Clear() = 0;
+
+    virtual size_t GetProxyCount() const = 0;
+    virtual BroadphaseType GetType() const = 0;
+
+    // Every proxy whose box overlaps 'region', each reported once
+    virtual void Query(const AABB& region, QueryCallback callback, void* context) const = 0;
+
+    // Replaces the contents of 'pairs' with every overlapping pair, each once
+    virtual void FindPairs(std::vector<BroadphasePair>& pairs) const = 0;
+
+    // Query() with any callable: fn(uint32_t userData), optionally returning
+    // bool to stop early
+    template<typename Fn>
+    void QueryRegion(const AABB& region, Fn&& fn) const {
+        Query(region, [](void* context, uint32_t userData) {
+            Fn& callback = *static_cast<std::remove_reference_t<Fn>*>(context);
+            if constexpr (std::is_same_v<decltype(callback(userData)), bool>) {
+                return callback(userData);
+            } else {
+                callback(userData);
+                return true;
+            }
+        }, const_cast<void*>(static_cast<const void*>(&fn)));
+    }
+};
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Broadphase.hpp"
+#include <cstdint>
+#include <vector>
+
+// Bounding volume hierarchy over fattened boxes, kept balanced with tree
+// rotations (the scheme Box2D uses). Handles any mix of box sizes and large
+// empty areas well. A proxy whose box still fits inside its fattened leaf
+// box is not touched by MoveProxy(); only proxies that leave it are removed
+// and reinserted, with the fat box stretched along their motion.
+class DynamicAABBTree : public Broadphase {
+public:
+    static constexpr float DefaultMargin = 4.0f;
+    // How many steps' worth of the last displacement a reinserted box covers
+    static constexpr float DisplacementMultiplier = 2.0f;
+    static constexpr int32_t NullNode = -1;
+
+    explicit DynamicAABBTree(float margin = DefaultMargin);
+
+    ProxyId CreateProxy(const AABB& bounds, uint32_t userData) override;
+    void DestroyProxy(ProxyId proxy) override;
+    void MoveProxy(ProxyId proxy, const AABB& bounds) override;
+    void Clear() override;
+
+    size_t GetProxyCount() const override { return m_ProxyCount; }
+    BroadphaseType GetType() const override { return BroadphaseType::AABBTree; }
+
+    void Query(const AABB& region, QueryCallback callback, void* context) const override;
+    void FindPairs(std::vector<BroadphasePair>& pairs) const override;
+
+    // 0 for a single leaf; -1 when empty
+    int32_t GetHeight() const { return m_Root == NullNode ? -1 : m_Nodes[m_Root].Height; }
+
+private:
+    // Deepest traversal stack a query needs; the tree's height is logarithmic
+    static constexpr size_t MaxQueryDepth = 256;
+
+    struct Node {
+        AABB Box;             // Fattened for leaves, the union of the children otherwise
+        AABB Tight;           // Leaves only: the proxy's actual box
+        int32_t Parent = NullNode;
+        int32_t Child1 = NullNode;
+        int32_t Child2 = NullNode;
+        int32_t Height = -1;  // 0 for leaves, -1 while on the free list
+        int32_t NextFree = NullNode;
+        uint32_t UserData = 0;
+
+        bool IsLeaf() const { return Child1 == NullNode; }
+    };
+
+    int32_t AllocateNode();
+    void FreeNode(int32_t node);
+    void InsertLeaf(int32_t leaf);
+    void RemoveLeaf(int32_t leaf);
+    int32_t Balance(int32_t node);
+    void Refit(int32_t node);
+
+    template<typename Fn>
+    void Traverse(const AABB& region, Fn&& fn) const;
+
+    std::vector<Node> m_Nodes;
+    int32_t m_Root;
+    int32_t m_FreeList;
+    size_t m_ProxyCount;
+    float m_Margin;
+};
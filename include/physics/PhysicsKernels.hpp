@@ -0,0 +1,58 @@
+#pragma once
+
+#include "AABB.hpp"
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+
+// Instruction sets the kernels are built for, in increasing order
+enum class SimdLevel : uint8_t {
+    Scalar,
+    SSE2,
+    AVX2,
+};
+
+// Branch-free loops over SoA float arrays used by PhysicsWorld::Step() and
+// Camera2D culling.
+//
+// Each kernel has a scalar version plus SSE2 and AVX2 versions on x86; the
+// best one the CPU supports is picked at startup. Every version performs the
+// same float operations in the same order (no FMA contraction), so results
+// are bit-identical whichever level runs and replays stay deterministic.
+namespace PhysicsKernels {
+
+// Best level this CPU supports
+SimdLevel GetSupportedLevel();
+
+SimdLevel GetActiveLevel();
+
+// Forces a level, clamped to what the CPU supports; returns the level set.
+// For tests and benchmarks. Not safe while a Step() is running.
+SimdLevel SetActiveLevel(SimdLevel level);
+
+const char* GetLevelName(SimdLevel level);
+
+// velocity += gravityDelta * gravityScale, then velocityY is clamped to
+// -maxFallSpeed from below
+void IntegrateVelocities(float* velocityX, float* velocityY, const float* gravityScale, size_t count,
+                         const glm::vec2& gravityDelta, float maxFallSpeed);
+
+// position += velocity * deltaTime
+void IntegratePositions(float* positionX, float* positionY, const float* velocityX, const float* velocityY,
+                        size_t count, float deltaTime);
+
+// Writes the index of every box in the SoA arrays that overlaps 'box'
+// (strictly, as AABB::Overlaps) to 'indices', in ascending order, and
+// returns how many there were. 'indices' must hold 'count' entries.
+size_t FindOverlaps(const AABB& box, const float* minX, const float* minY, const float* maxX, const float* maxY,
+                    size_t count, uint32_t* indices);
+
+// Same test as FindOverlaps, written as a bitmask: bit i % 32 of mask[i / 32]
+// is set when box i overlaps. 'mask' must hold GetMaskWordCount(count)
+// words; every one is overwritten, and bits past 'count' are left clear.
+void OverlapMask(const AABB& box, const float* minX, const float* minY, const float* maxX, const float* maxY,
+                 size_t count, uint32_t* mask);
+
+constexpr size_t GetMaskWordCount(size_t count) { return (count + 31) / 32; }
+
+} // namespace PhysicsKernels
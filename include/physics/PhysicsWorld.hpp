@@ -0,0 +1,192 @@
+#pragma once
+
+#include "AABB.hpp"
+#include "BodyId.hpp"
+#include "Broadphase.hpp"
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Which sides of a body touched static geometry during the last Step()
+enum ContactFlags : uint8_t {
+    ContactNone = 0,
+    ContactGround = 1 << 0,
+    ContactCeiling = 1 << 1,
+    ContactWallLeft = 1 << 2,   // Wall on the body's left
+    ContactWallRight = 1 << 3,
+};
+
+struct BodyDesc {
+    glm::vec2 Position{ 0.0f };     // Centre
+    glm::vec2 HalfExtents{ 0.5f };
+    glm::vec2 Velocity{ 0.0f };
+    float GravityScale = 1.0f;
+};
+
+// Static collider kinds
+enum class StaticType : uint8_t {
+    Solid,
+    OneWay,   // Platform that only stops bodies falling onto its top
+};
+
+// Fixed-step 2D physics for axis-aligned boxes.
+//
+// Dynamic bodies are kept SoA in dense arrays (a BodyId resolves through a
+// sparse table), so every phase of Step() is a straight loop over plain
+// float arrays, and the hot ones run through the SIMD PhysicsKernels.
+// Bodies sweep their whole displacement against static
+// geometry, so fast bodies cannot tunnel through thin platforms, and slide
+// along what they hit. Static colliders are bucketed into a uniform grid
+// whose cells keep their boxes SoA so the candidates a body can touch are
+// picked out with one overlap kernel call; adding or removing a collider
+// only refreshes the cells it covers.
+//
+// Step() runs in four phases: integrate velocities, sweep every body
+// (spread over the job system; each body only writes its own slot),
+// resolve, in one batch, the overlaps bodies started the step in, e.g.
+// after being teleported into a wall, and finally move every body's
+// broadphase proxy. The broadphase answers body-vs-body questions
+// (QueryRegion(), FindBodyPairs()) and can be swapped at runtime.
+class PhysicsWorld {
+public:
+    // Bodies touching or overlapping a surface by less than this count as in contact
+    static constexpr float ContactSkin = 0.01f;
+    static constexpr int MaxSweepIterations = 4;
+
+    struct Properties {
+        glm::vec2 Gravity{ 0.0f, -980.0f };
+        float MaxFallSpeed = 2000.0f;
+        float StaticCellSize = 128.0f;
+        size_t BodiesPerJob = 256;
+        BroadphaseType Broadphase = BroadphaseType::SpatialHash;
+    };
+
+    PhysicsWorld();
+    explicit PhysicsWorld(const Properties& props);
+    ~PhysicsWorld();
+
+    // Delete copy constructor and assignment operator
+    PhysicsWorld(const PhysicsWorld&) = delete;
+    PhysicsWorld& operator=(const PhysicsWorld&) = delete;
+
+    BodyId CreateBody(const BodyDesc& desc);
+    void DestroyBody(BodyId body);
+    bool IsValid(BodyId body) const;
+    size_t GetBodyCount() const { return m_BodyIds.size(); }
+
+    glm::vec2 GetPosition(BodyId body) const;
+    void SetPosition(BodyId body, const glm::vec2& position);
+    glm::vec2 GetVelocity(BodyId body) const;
+    void SetVelocity(BodyId body, const glm::vec2& velocity);
+    AABB GetBounds(BodyId body) const;
+
+    uint8_t GetContacts(BodyId body) const;
+    bool IsGrounded(BodyId body) const { return (GetContacts(body) & ContactGround) != 0; }
+
+    // Returns the collider's id; ids of removed colliders are reused
+    uint32_t AddStatic(const AABB& box, StaticType type = StaticType::Solid);
+    void RemoveStatic(uint32_t id);
+    void ClearStatics();
+    size_t GetStaticCount() const { return m_Statics.size() - m_FreeStatics.size(); }
+
+    void Step(float deltaTime);
+
+    // Rebuilds the broadphase from the current bodies if the type changes
+    void SetBroadphase(BroadphaseType type);
+    BroadphaseType GetBroadphaseType() const { return m_Broadphase->GetType(); }
+
+    // Calls fn(BodyId) for every body overlapping 'region'; fn may return
+    // false to stop early. Does not allocate.
+    template<typename Fn>
+    void QueryRegion(const AABB& region, Fn&& fn) const;
+
+    // Every pair of overlapping bodies, each once. The returned buffer is
+    // reused by the next call.
+    const std::vector<std::pair<BodyId, BodyId>>& FindBodyPairs();
+
+    const Properties& GetProperties() const { return m_Properties; }
+
+private:
+    struct StaticCollider {
+        AABB Box;
+        StaticType Type;
+        bool Alive;
+    };
+
+    // A grid cell's colliders, with their boxes SoA for PhysicsKernels: n
+    // MinX, then n MinY, n MaxX and n MaxY in one block
+    struct StaticCell {
+        std::vector<uint32_t> Colliders;
+        std::vector<float> Bounds;
+        bool Dirty = false;       // Bounds out of date with Colliders
+    };
+
+    struct BodySlot {
+        uint32_t Dense = 0;       // Index into the SoA arrays while alive
+        uint32_t Generation = 1;
+        bool Alive = false;
+    };
+
+    void IntegrateVelocities(float deltaTime);
+    void SweepBodies(size_t begin, size_t end, float deltaTime);
+    void ResolvePenetrations();
+    void UpdateBroadphase();
+
+    static std::unique_ptr<Broadphase> CreateBroadphase(BroadphaseType type);
+
+    void MarkStaticCellDirty(uint64_t key, StaticCell& cell);
+    void RefreshStaticCells();
+    template<typename Fn>
+    void ForEachStaticCandidate(const AABB& bounds, Fn&& fn) const;
+
+    uint32_t GetDense(BodyId body) const;
+
+    Properties m_Properties;
+
+    // Dynamic bodies, SoA
+    std::vector<float> m_PositionX;
+    std::vector<float> m_PositionY;
+    std::vector<float> m_VelocityX;
+    std::vector<float> m_VelocityY;
+    std::vector<float> m_HalfX;
+    std::vector<float> m_HalfY;
+    std::vector<float> m_GravityScale;
+    std::vector<float> m_CorrectionX;   // Depenetration found by the sweep, applied by ResolvePenetrations()
+    std::vector<float> m_CorrectionY;
+    std::vector<uint8_t> m_Contacts;
+    std::vector<uint32_t> m_BodyIds;    // Dense index -> slot index
+    std::vector<Broadphase::ProxyId> m_ProxyIds;
+
+    std::vector<BodySlot> m_Slots;
+    std::vector<uint32_t> m_FreeSlots;
+
+    // Static geometry and its grid, which is kept up to date as colliders
+    // come and go; only the touched cells' bounds are rebuilt
+    std::vector<StaticCollider> m_Statics;
+    std::vector<uint32_t> m_FreeStatics;
+    std::unordered_map<uint64_t, StaticCell> m_StaticGrid;
+    std::vector<uint64_t> m_DirtyStaticCells;
+
+    // Dynamic bodies' boxes; proxy user data is the body's slot index
+    std::unique_ptr<Broadphase> m_Broadphase;
+    std::vector<BroadphasePair> m_SlotPairs;
+    std::vector<std::pair<BodyId, BodyId>> m_BodyPairs;
+};
+
+template<typename Fn>
+void PhysicsWorld::QueryRegion(const AABB& region, Fn&& fn) const {
+    m_Broadphase->QueryRegion(region, [this, &fn](uint32_t slot) {
+        const BodyId body{ slot, m_Slots[slot].Generation };
+        if constexpr (std::is_same_v<decltype(fn(body)), bool>) {
+            return fn(body);
+        } else {
+            fn(body);
+            return true;
+        }
+    });
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Broadphase.hpp"
+#include <unordered_map>
+#include <vector>
+
+// Uniform grid hashed by cell coordinate. Best when boxes are similar in
+// size and no bigger than a cell or two, which is typical for platformer
+// actors. A box is listed in every cell it touches; results are
+// de-duplicated without scratch state by reporting a proxy (or pair) only
+// from the first cell it shares with the region (or with the other proxy).
+class SpatialHashBroadphase : public Broadphase {
+public:
+    static constexpr float DefaultCellSize = 64.0f;
+
+    explicit SpatialHashBroadphase(float cellSize = DefaultCellSize);
+
+    ProxyId CreateProxy(const AABB& bounds, uint32_t userData) override;
+    void DestroyProxy(ProxyId proxy) override;
+    void MoveProxy(ProxyId proxy, const AABB& bounds) override;
+    void Clear() override;
+
+    size_t GetProxyCount() const override { return m_ProxyCount; }
+    BroadphaseType GetType() const override { return BroadphaseType::SpatialHash; }
+
+    void Query(const AABB& region, QueryCallback callback, void* context) const override;
+    void FindPairs(std::vector<BroadphasePair>& pairs) const override;
+
+    float GetCellSize() const { return m_CellSize; }
+
+private:
+    struct CellRange {
+        int32_t MinX, MinY, MaxX, MaxY;
+
+        bool operator==(const CellRange& other) const {
+            return MinX == other.MinX && MinY == other.MinY && MaxX == other.MaxX && MaxY == other.MaxY;
+        }
+    };
+
+    struct Proxy {
+        AABB Bounds;
+        CellRange Cells;
+        uint32_t UserData;
+        bool Alive;
+    };
+
+    CellRange GetCellRange(const AABB& bounds) const;
+    void Insert(ProxyId proxy, const CellRange& cells);
+    void Remove(ProxyId proxy, const CellRange& cells);
+
+    float m_CellSize;
+    float m_InverseCellSize;
+    std::vector<Proxy> m_Proxies;
+    std::vector<ProxyId> m_FreeProxies;
+    size_t m_ProxyCount;
+
+    // Emptied cells keep their storage, so steady-state moves do not allocate
+    std::unordered_map<uint64_t, std::vector<ProxyId>> m_Cells;
+};
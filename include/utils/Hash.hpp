@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+// 64-bit FNV-1a. constexpr so literal names can be hashed at compile time.
+constexpr uint64_t HashString(const char* str, size_t length) {
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < length; ++i) {
+        hash ^= static_cast<uint8_t>(str[i]);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+constexpr uint64_t HashString(const char* str) {
+    size_t length = 0;
+    while (str[length] != '\0') {
+        ++length;
+    }
+    return HashString(str, length);
+}
+
+inline uint64_t HashString(const std::string& str) {
+    return HashString(str.data(), str.size());
+}
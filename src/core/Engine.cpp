@@ -1,19 +1,23 @@
 #include "core/Engine.hpp"
+#include "core/JobSystem.hpp"
 #include "core/Logger.hpp"
+#include "core/Profiler.hpp"
+#include "core/ResourceManager.hpp"
+#include "graphics/Camera2D.hpp"
+#include "graphics/RenderBackend.hpp"
+#include "graphics/AsyncTextureLoader.hpp"
+#include "ecs/Components.hpp"
+#include "ecs/World.hpp"
+#include "physics/PhysicsWorld.hpp"
 #include <GLFW/glfw3.h>
 
 Engine::Engine()
     : m_Running(false)
-    , m_Accumulator(0.0)
-    , m_PlayerX(100.0f)
-    , m_PlayerY(100.0f)
-    , m_PlayerSpeed(300.0f)
-    , m_IsJumping(false)
-    , m_JumpForce(500.0f)
-    , m_Gravity(980.0f)
-    , m_VerticalVelocity(0.0f) {
+    , m_Accumulator(0.0) {
     // Initialize logger
     Logger::Init();
+    Profiler::Init();
+    Profiler::SetThreadName("Main");
 }
 
 Engine::~Engine() {
@@ -21,21 +25,44 @@ Engine::~Engine() {
 }
 
 bool Engine::Init() {
+    return Init(Properties());
+}
+
+bool Engine::Init(const Properties& props) {
     LOG_INFO("Initializing engine...");
+    m_Properties = props;
     
     // Create window
+    const bool interactive = m_Properties.WindowMode == Window::Mode::Visible;
     m_Window = std::make_unique<Window>();
     if (!m_Window->Init({
         .Title = "Platform Game",
         .Width = 1280,
         .Height = 720,
-        .VSync = true,
-        .Fullscreen = false
+        .VSync = interactive,
+        .Fullscreen = false,
+        .WindowMode = m_Properties.WindowMode
     })) {
         LOG_ERROR("Failed to create window");
         return false;
     }
     
+    // Simulation-only runs have no GL context to render or upload with
+    if (m_Window->HasContext()) {
+        // Create render backend (takes over the GL context when threaded)
+        m_RenderBackend = std::make_unique<RenderBackend>();
+        if (!m_RenderBackend->Init(m_Window.get(), m_Properties.ThreadedRendering)) {
+            LOG_ERROR("Failed to initialize render backend");
+            return false;
+        }
+        
+        // Decode textures off the main thread; the backend uploads them between frames
+        AsyncTextureLoader::getInstance().Init();
+    }
+    
+    // Workers for ECS systems and other per-frame jobs
+    JobSystem::getInstance().Init();
+    
     // Create timer
     m_Timer = std::make_unique<Timer>();
     
@@ -57,6 +84,26 @@ bool Engine::Init() {
     LOG_INFO("- LEFT SHIFT: Run");
     LOG_INFO("- ESC: Exit");
     
+    // Scene: the ground and the player
+    m_World = std::make_unique<World>();
+    m_Physics = std::make_unique<PhysicsWorld>();
+    m_Camera = std::make_unique<Camera2D>();
+    m_Camera->SetPixelSnap(true);
+    
+    const float groundTop = 100.0f;
+    m_Physics->AddStatic({ { -100000.0f, -1000.0f }, { 100000.0f, groundTop } });
+    m_Ground = m_World->CreateEntity(
+        Transform{ { 0.0f, groundTop * 0.5f } },
+        Sprite{ { 0.0f, groundTop }, { 0.0f, 0.0f }, { 0.3f, 0.7f, 0.3f, 1.0f }, 0 });
+    
+    const glm::vec2 playerHalfExtents{ 16.0f, 24.0f };
+    const glm::vec2 playerStart{ 100.0f, groundTop + playerHalfExtents.y };
+    m_Player = m_World->CreateEntity(
+        Transform{ playerStart },
+        RigidBody{ m_Physics->CreateBody({ playerStart, playerHalfExtents }) },
+        Sprite{ playerHalfExtents * 2.0f, { 0.0f, 0.0f }, { 0.9f, 0.2f, 0.2f, 1.0f }, 1 },
+        PlayerController{});
+    
     m_Running = true;
     return true;
 }
@@ -66,116 +113,277 @@ void Engine::Run() {
     
     while (m_Running) {
         m_Timer->Update();
-        double deltaTime = m_Timer->GetDeltaTime();
+        RunFrame(m_Timer->GetDeltaTime());
+    }
+    
+    if (Profiler::IsCapturing()) {
+        ToggleProfileCapture();
+    }
+}
+
+uint32_t Engine::RunFrames(uint32_t frameCount) {
+    LOG_INFO("Running {} fixed-step frame(s)...", frameCount);
+    
+    // Simulated time advances exactly one step per frame, however long the
+    // frame took, so runs are reproducible and finish as fast as possible
+    uint32_t framesRun = 0;
+    while (m_Running && framesRun < frameCount) {
+        RunFrame(FIXED_TIME_STEP);
+        ++framesRun;
+    }
+    
+    // The render thread may still be on the last frame
+    if (m_RenderBackend) {
+        m_RenderBackend->WaitIdle();
+    }
+    return framesRun;
+}
+
+void Engine::RunFrame(double deltaTime) {
+    Profiler::BeginFrame();
+    {
+        PROFILE_SCOPE("Frame");
         
-        // Update input
-        m_Input->Update();
+        {
+            PROFILE_SCOPE("Input");
+            
+            // Update input
+            m_Input->Update();
+            
+            // Pick up textures that finished loading since last frame
+            ResourceManager::getInstance().updateAsyncLoads();
+        }
         
         // Handle escape key to close window
         if (m_Input->IsKeyPressed(GLFW_KEY_ESCAPE)) {
             m_Running = false;
         }
         
+        // F9 starts and stops a profile capture
+        if (m_Input->IsKeyPressed(GLFW_KEY_F9)) {
+            ToggleProfileCapture();
+        }
+        
         // Fixed timestep update
-        m_Accumulator += deltaTime;
-        while (m_Accumulator >= FIXED_TIME_STEP) {
-            FixedUpdate(FIXED_TIME_STEP);
-            m_Accumulator -= FIXED_TIME_STEP;
+        {
+            PROFILE_SCOPE("FixedUpdate");
+            m_Accumulator += deltaTime;
+            while (m_Accumulator >= FIXED_TIME_STEP) {
+                FixedUpdate(FIXED_TIME_STEP);
+                m_Accumulator -= FIXED_TIME_STEP;
+            }
         }
         
         // Variable timestep update
-        Update(deltaTime);
+        {
+            PROFILE_SCOPE("Update");
+            Update(deltaTime);
+        }
         
         // Render
-        Render();
+        {
+            PROFILE_SCOPE("Render");
+            Render();
+        }
         
         // Update window
-        m_Window->Update();
+        {
+            PROFILE_SCOPE("PollEvents");
+            m_Window->Update();
+        }
         
         // Check if window should close
         if (m_Window->ShouldClose()) {
             m_Running = false;
         }
     }
+    Profiler::EndFrame();
+}
+
+void Engine::ToggleProfileCapture() {
+    if (!Profiler::IsCapturing()) {
+        Profiler::BeginCapture();
+        LOG_INFO("Profile capture started (F9 to stop)");
+        return;
+    }
+    
+    Profiler::EndCapture();
+    // Let the render thread finish so its zones for the last frame are in the capture
+    if (m_RenderBackend) {
+        m_RenderBackend->WaitIdle();
+    }
+    Profiler::ExportChromeTrace(m_Properties.ProfileCapturePath);
+}
+
+float Engine::GetPlayerX() const {
+    const Transform* transform = m_World ? m_World->GetComponent<Transform>(m_Player) : nullptr;
+    return transform ? transform->Position.x : 0.0f;
+}
+
+float Engine::GetPlayerY() const {
+    const Transform* transform = m_World ? m_World->GetComponent<Transform>(m_Player) : nullptr;
+    return transform ? transform->Position.y : 0.0f;
 }
 
 void Engine::Update(float deltaTime) {
+    const bool inputChanged = UpdatePlayer();
+    
+    // Everything else that moves (enemies, pickups, particles) integrates here
+    {
+        PROFILE_SCOPE("Movement");
+        m_World->GetQuery<Transform, const Velocity>(MakeComponentMask<RigidBody>())
+            .ParallelForEachChunk([deltaTime](uint32_t count, const Entity*, Transform* transforms, const Velocity* velocities) {
+                for (uint32_t i = 0; i < count; ++i) {
+                    transforms[i].Position += velocities[i].Value * deltaTime;
+                }
+            });
+    }
+    
+    // Get mouse position (only log if significant movement and no keyboard input)
+    if (!inputChanged) {
+        double mouseX, mouseY;
+        m_Input->GetMousePosition(mouseX, mouseY);
+        
+        static double lastMouseX = mouseX;
+        static double lastMouseY = mouseY;
+        if (abs(mouseX - lastMouseX) > 10.0 || abs(mouseY - lastMouseY) > 10.0) {
+            LOG_INFO("Mouse position: X={:.1f}, Y={:.1f}", mouseX, mouseY);
+            lastMouseX = mouseX;
+            lastMouseY = mouseY;
+        }
+    }
+}
+
+bool Engine::UpdatePlayer() {
+    const RigidBody* body = m_World->GetComponent<RigidBody>(m_Player);
+    PlayerController* controller = m_World->GetComponent<PlayerController>(m_Player);
+    if (!body || !controller || !m_Physics->IsValid(body->Body)) return false;
+    
+    // Physics moves the player; input only sets its velocity
+    const glm::vec2 position = m_Physics->GetPosition(body->Body);
+    glm::vec2 velocity = m_Physics->GetVelocity(body->Body);
+    const bool grounded = m_Physics->IsGrounded(body->Body);
     bool inputChanged = false;
     
     // Handle horizontal movement
+    velocity.x = 0.0f;
     if (m_Input->IsActionActive("MoveLeft")) {
-        m_PlayerX -= m_PlayerSpeed * deltaTime;
-        LOG_INFO(">>> Moving LEFT  | Position: X={:.1f}, Y={:.1f}", m_PlayerX, m_PlayerY);
+        velocity.x = -controller->Speed;
+        LOG_INFO(">>> Moving LEFT  | Position: X={:.1f}, Y={:.1f}", position.x, position.y);
         inputChanged = true;
     }
     else if (m_Input->IsActionActive("MoveRight")) {
-        m_PlayerX += m_PlayerSpeed * deltaTime;
-        LOG_INFO(">>> Moving RIGHT | Position: X={:.1f}, Y={:.1f}", m_PlayerX, m_PlayerY);
+        velocity.x = controller->Speed;
+        LOG_INFO(">>> Moving RIGHT | Position: X={:.1f}, Y={:.1f}", position.x, position.y);
         inputChanged = true;
     }
     
+    // Landing ends a jump
+    if (controller->IsJumping && grounded && velocity.y <= 0.0f) {
+        LOG_INFO(">>> JUMP ended | Landing position: X={:.1f}, Y={:.1f}", position.x, position.y);
+        controller->IsJumping = false;
+    }
+    
     // Handle jumping
-    if (m_Input->IsActionActive("Jump") && !m_IsJumping) {
-        m_IsJumping = true;
-        m_VerticalVelocity = m_JumpForce;
-        LOG_INFO(">>> JUMP started! Initial velocity: {:.1f}", m_VerticalVelocity);
+    if (m_Input->IsActionActive("Jump") && grounded && !controller->IsJumping) {
+        controller->IsJumping = true;
+        velocity.y = controller->JumpForce;
+        LOG_INFO(">>> JUMP started! Initial velocity: {:.1f}", velocity.y);
         inputChanged = true;
     }
     
-    // Apply gravity
-    m_VerticalVelocity -= m_Gravity * deltaTime;
-    m_PlayerY += m_VerticalVelocity * deltaTime;
-    
-    // Simple ground collision
-    if (m_PlayerY <= 100.0f) {
-        m_PlayerY = 100.0f;
-        m_VerticalVelocity = 0.0f;
-        if (m_IsJumping) {
-            LOG_INFO(">>> JUMP ended | Landing position: X={:.1f}, Y={:.1f}", m_PlayerX, m_PlayerY);
-            m_IsJumping = false;
-        }
-    }
+    m_Physics->SetVelocity(body->Body, velocity);
     
     // Handle crouching
     if (m_Input->IsActionActive("Crouch")) {
-        LOG_INFO(">>> CROUCHING | Position: X={:.1f}, Y={:.1f}", m_PlayerX, m_PlayerY);
+        LOG_INFO(">>> CROUCHING | Position: X={:.1f}, Y={:.1f}", position.x, position.y);
         inputChanged = true;
     }
     
     // Handle running
     if (m_Input->IsActionActive("Run")) {
-        LOG_INFO(">>> RUNNING | Position: X={:.1f}, Y={:.1f}", m_PlayerX, m_PlayerY);
+        LOG_INFO(">>> RUNNING | Position: X={:.1f}, Y={:.1f}", position.x, position.y);
         inputChanged = true;
     }
     
-    // Get mouse position (only log if significant movement and no keyboard input)
-    if (!inputChanged) {
-        double mouseX, mouseY;
-        m_Input->GetMousePosition(mouseX, mouseY);
-        
-        static double lastMouseX = mouseX;
-        static double lastMouseY = mouseY;
-        if (abs(mouseX - lastMouseX) > 10.0 || abs(mouseY - lastMouseY) > 10.0) {
-            LOG_INFO("Mouse position: X={:.1f}, Y={:.1f}", mouseX, mouseY);
-            lastMouseX = mouseX;
-            lastMouseY = mouseY;
-        }
-    }
+    return inputChanged;
 }
 
 void Engine::FixedUpdate(float fixedDeltaTime) {
-    // Fixed timestep physics update will go here
+    m_Physics->Step(fixedDeltaTime);
+    
+    // Bodies own their position; mirror it for rendering and gameplay
+    m_World->GetQuery<Transform, const RigidBody>().ForEachChunk(
+        [this](uint32_t count, const Entity*, Transform* transforms, const RigidBody* bodies) {
+            for (uint32_t i = 0; i < count; ++i) {
+                transforms[i].Position = m_Physics->GetPosition(bodies[i].Body);
+            }
+        });
 }
 
 void Engine::Render() {
+    if (!m_RenderBackend) return;
+    
+    // Record this frame's draws; the backend sorts, executes and presents them
+    RenderQueue& queue = m_RenderBackend->GetSubmissionQueue();
+    
     // Clear with a nice sky blue color
-    m_Window->Clear(0.4f, 0.6f, 1.0f, 1.0f);
-    m_Window->SwapBuffers();
+    queue.SetClearColor({ 0.4f, 0.6f, 1.0f, 1.0f });
+    
+    // One world unit per pixel with (0, 0) at the bottom-left of the window
+    const float width = static_cast<float>(m_Window->GetWidth());
+    const float height = static_cast<float>(m_Window->GetHeight());
+    m_Camera->SetViewportSize(width, height);
+    m_Camera->SetPosition(glm::floor(m_Camera->GetViewportSize() * 0.5f));
+    queue.SetCamera(*m_Camera);
+    
+    // The ground spans the window, whatever its current size
+    if (Transform* ground = m_World->GetComponent<Transform>(m_Ground)) {
+        ground->Position.x = width * 0.5f;
+        m_World->GetComponent<Sprite>(m_Ground)->Size.x = width;
+    }
+    
+    // Cull a chunk of sprites at a time and submit only what is on screen
+    m_World->GetQuery<const Transform, const Sprite>().ForEachChunk(
+        [this, &queue](uint32_t count, const Entity*, const Transform* transforms, const Sprite* sprites) {
+            m_CullMinX.resize(count);
+            m_CullMinY.resize(count);
+            m_CullMaxX.resize(count);
+            m_CullMaxY.resize(count);
+            m_CullMask.resize(Camera2D::GetMaskWordCount(count));
+            for (uint32_t i = 0; i < count; ++i) {
+                const glm::vec2 center = transforms[i].Position + sprites[i].Offset;
+                const glm::vec2 halfSize = sprites[i].Size * 0.5f;
+                m_CullMinX[i] = center.x - halfSize.x;
+                m_CullMinY[i] = center.y - halfSize.y;
+                m_CullMaxX[i] = center.x + halfSize.x;
+                m_CullMaxY[i] = center.y + halfSize.y;
+            }
+            
+            if (m_Camera->Cull(m_CullMinX.data(), m_CullMinY.data(), m_CullMaxX.data(), m_CullMaxY.data(),
+                               count, m_CullMask.data()) == 0) {
+                return;
+            }
+            for (uint32_t i = 0; i < count; ++i) {
+                if ((m_CullMask[i / 32] >> (i % 32)) & 1u) {
+                    const Sprite& sprite = sprites[i];
+                    queue.SubmitQuad(sprite.Layer, 0.0f, transforms[i].Position + sprite.Offset, sprite.Size, sprite.Color);
+                }
+            }
+        });
+    
+    m_RenderBackend->SubmitFrame();
 }
 
 void Engine::Shutdown() {
     LOG_INFO("Shutting down engine...");
+    m_World.reset();
+    m_Physics.reset();
+    JobSystem::getInstance().Shutdown();
     m_Input.reset();
+    AsyncTextureLoader::getInstance().Shutdown();
+    m_RenderBackend.reset();
     m_Window.reset();
+    Profiler::Shutdown();
     Logger::Shutdown();
 }
@@ -22,8 +22,14 @@ Input::Input(Window* window)
     std::fill(m_KeyStates.begin(), m_KeyStates.end(), KeyState::Released);
     std::fill(m_MouseButtonStates.begin(), m_MouseButtonStates.end(), KeyState::Released);
     
-    // Set callbacks
+    // Headless windows have no events to listen to
     GLFWwindow* glfwWindow = window->GetNativeWindow();
+    if (!glfwWindow) {
+        LOG_INFO("Input system initialized without a window");
+        return;
+    }
+    
+    // Set callbacks
     glfwSetKeyCallback(glfwWindow, KeyCallback);
     glfwSetMouseButtonCallback(glfwWindow, MouseButtonCallback);
     glfwSetCursorPosCallback(glfwWindow, CursorPosCallback);
@@ -32,6 +38,12 @@ Input::Input(Window* window)
     LOG_INFO("Input system initialized");
 }
 
+Input::~Input() {
+    if (s_Instance == this) {
+        s_Instance = nullptr;
+    }
+}
+
 void Input::Update() {
     UpdateKeyStates();
     UpdateMouseButtonStates();
@@ -198,6 +210,7 @@ bool Input::IsActionActive(const std::string& name) const {
 }
 
 void Input::SetCursorMode(int mode) {
+    if (!m_Window->GetNativeWindow()) return;
     glfwSetInputMode(m_Window->GetNativeWindow(), GLFW_CURSOR, mode);
 }
 
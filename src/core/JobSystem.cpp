@@ -0,0 +1,259 @@
+#include "core/JobSystem.hpp"
+#include "core/Logger.hpp"
+#include "core/Profiler.hpp"
+#include <string>
+
+thread_local JobSystem::ThreadState* JobSystem::s_ThreadState = nullptr;
+
+namespace {
+
+// Rounds spent yielding for new work before a worker goes to sleep
+constexpr int IdleSpinCount = 64;
+
+uint32_t NextRandom(uint32_t& state) {
+    // xorshift32
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+} // namespace
+
+JobSystem::JobSystem()
+    : m_QueuedJobs(0)
+    , m_Sleepers(0)
+    , m_StopRequested(false) {
+}
+
+JobSystem::~JobSystem() {
+    Shutdown();
+}
+
+bool JobSystem::Init(size_t workerCount) {
+    if (IsRunning()) {
+        Logger::Warn("JobSystem already initialized");
+        return true;
+    }
+
+    if (workerCount == 0) {
+        const unsigned int hardware = std::thread::hardware_concurrency();
+        workerCount = hardware > 1 ? hardware - 1 : 1;
+    }
+
+    for (size_t i = 0; i <= workerCount; ++i) {
+        m_Threads.push_back(std::make_unique<ThreadState>());
+        m_Threads.back()->RandomState = static_cast<uint32_t>(i) * 2654435761u + 1;
+    }
+    s_ThreadState = m_Threads[0].get();
+
+    m_StopRequested.store(false);
+    m_Workers.reserve(workerCount);
+    for (size_t i = 1; i <= workerCount; ++i) {
+        m_Workers.emplace_back(&JobSystem::WorkerMain, this, i);
+    }
+
+    LOG_INFO("Job system started with {} worker(s)", workerCount);
+    return true;
+}
+
+void JobSystem::Shutdown() {
+    if (!IsRunning()) return;
+
+    // Workers also keep going until they find nothing left
+    while (RunOneJob()) {}
+
+    {
+        std::lock_guard<std::mutex> lock(m_SleepMutex);
+        m_StopRequested.store(true);
+    }
+    m_WorkAvailable.notify_all();
+
+    for (std::thread& worker : m_Workers) {
+        worker.join();
+    }
+    m_Workers.clear();
+    m_Threads.clear();
+    s_ThreadState = nullptr;
+}
+
+void JobSystem::Wait(const JobCounter& counter) {
+    while (!counter.IsDone()) {
+        if (!RunOneJob()) {
+            std::this_thread::yield();
+        }
+    }
+
+    // The thread that made the count zero may still hold the mutex; once we
+    // get it, nothing touches the counter any more and it can be destroyed
+    std::lock_guard<std::mutex> lock(counter.m_Mutex);
+}
+
+Job* JobSystem::AllocateJob() {
+    ThreadState* state = s_ThreadState;
+    if (!state) {
+        Job* job = new Job;
+        job->HeapAllocated = true;
+        job->InUse.store(true, std::memory_order_relaxed);
+        return job;
+    }
+
+    Job* job = &state->Jobs[state->NextJob++ & (MaxJobsPerThread - 1)];
+
+    // Every slot is still queued or waiting on a dependency: help until this one is free
+    while (job->InUse.load(std::memory_order_acquire)) {
+        if (!RunOneJob()) {
+            std::this_thread::yield();
+        }
+    }
+
+    job->InUse.store(true, std::memory_order_relaxed);
+    job->HeapAllocated = false;
+    return job;
+}
+
+void JobSystem::Submit(Job* job, JobCounter* dependency) {
+    if (dependency) {
+        std::lock_guard<std::mutex> lock(dependency->m_Mutex);
+        if (!dependency->IsDone()) {
+            dependency->m_Continuations.push_back(job);
+            return;
+        }
+    }
+    Push(job);
+}
+
+void JobSystem::Push(Job* job) {
+    m_QueuedJobs.fetch_add(1);
+
+    if (ThreadState* state = s_ThreadState) {
+        if (!state->Queue.Push(job)) {
+            // Queue full: run it here rather than fail
+            m_QueuedJobs.fetch_sub(1);
+            Execute(job);
+            return;
+        }
+    } else {
+        std::lock_guard<std::mutex> lock(m_InjectedMutex);
+        m_Injected.push_back(job);
+    }
+
+    if (m_Sleepers.load() > 0) {
+        std::lock_guard<std::mutex> lock(m_SleepMutex);
+        m_WorkAvailable.notify_one();
+    }
+}
+
+bool JobSystem::RunOneJob() {
+    Job* job = nullptr;
+    if (!FindJob(job)) {
+        return false;
+    }
+
+    m_QueuedJobs.fetch_sub(1);
+    Execute(job);
+    return true;
+}
+
+bool JobSystem::FindJob(Job*& job) {
+    ThreadState* state = s_ThreadState;
+    if (state && state->Queue.Pop(job)) {
+        return true;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(m_InjectedMutex, std::try_to_lock);
+        if (lock.owns_lock() && !m_Injected.empty()) {
+            job = m_Injected.back();
+            m_Injected.pop_back();
+            return true;
+        }
+    }
+
+    // Steal, starting from a random victim so thieves spread out
+    const size_t threadCount = m_Threads.size();
+    if (threadCount == 0) {
+        return false;
+    }
+    uint32_t fallbackRandom = 0x9e3779b9u;
+    const size_t start = NextRandom(state ? state->RandomState : fallbackRandom) % threadCount;
+    for (size_t i = 0; i < threadCount; ++i) {
+        ThreadState* victim = m_Threads[(start + i) % threadCount].get();
+        if (victim != state && victim->Queue.Steal(job)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void JobSystem::Execute(Job* job) {
+    job->Invoke(job->Storage);
+
+    JobCounter* counter = job->Counter;
+    if (job->HeapAllocated) {
+        delete job;
+    } else {
+        job->InUse.store(false, std::memory_order_release);
+    }
+
+    if (counter) {
+        Release(*counter);
+    }
+}
+
+void JobSystem::Release(JobCounter& counter) {
+    // Only the 1 -> 0 transition runs under the mutex: it hands off the
+    // continuations, and Wait() relies on it to know when the counter is free
+    uint32_t pending = counter.m_Pending.load(std::memory_order_relaxed);
+    while (pending != 1) {
+        if (counter.m_Pending.compare_exchange_weak(pending, pending - 1, std::memory_order_acq_rel,
+                                                    std::memory_order_relaxed)) {
+            return;
+        }
+    }
+
+    std::vector<Job*> continuations;
+    {
+        std::lock_guard<std::mutex> lock(counter.m_Mutex);
+        if (counter.m_Pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            continuations.swap(counter.m_Continuations);
+        }
+    }
+
+    for (Job* job : continuations) {
+        Push(job);
+    }
+}
+
+void JobSystem::WorkerMain(size_t index) {
+    s_ThreadState = m_Threads[index].get();
+    Profiler::SetThreadName(("Job Worker " + std::to_string(index)).c_str());
+
+    while (true) {
+        if (RunOneJob()) continue;
+        if (m_StopRequested.load()) break;
+
+        // Jobs tend to arrive in bursts each frame; spin briefly before sleeping
+        bool found = false;
+        for (int i = 0; i < IdleSpinCount && !found; ++i) {
+            std::this_thread::yield();
+            found = RunOneJob();
+        }
+        if (found) continue;
+
+        std::unique_lock<std::mutex> lock(m_SleepMutex);
+        m_Sleepers.fetch_add(1);
+        m_WorkAvailable.wait(lock, [this] { return m_StopRequested.load() || m_QueuedJobs.load() > 0; });
+        m_Sleepers.fetch_sub(1);
+    }
+
+    s_ThreadState = nullptr;
+}
+
+size_t JobSystem::ResolveBatchSize(size_t count, size_t batchSize) const {
+    if (batchSize > 0) {
+        return batchSize;
+    }
+    const size_t threadCount = m_Workers.size() + 1;
+    return std::max<size_t>(1, count / (threadCount * 4));
+}
@@ -0,0 +1,21 @@
+#include "core/LinearAllocator.hpp"
+
+LinearAllocator::LinearAllocator(size_t capacity)
+    : m_Buffer(new uint8_t[capacity])
+    , m_Capacity(capacity)
+    , m_Offset(0) {
+}
+
+void* LinearAllocator::Allocate(size_t size, size_t alignment) {
+    const uintptr_t base = reinterpret_cast<uintptr_t>(m_Buffer.get());
+    const uintptr_t current = base + m_Offset;
+    const uintptr_t aligned = (current + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+    const size_t newOffset = static_cast<size_t>(aligned - base) + size;
+
+    if (newOffset > m_Capacity) {
+        return nullptr;
+    }
+
+    m_Offset = newOffset;
+    return reinterpret_cast<void*>(aligned);
+}
@@ -1,37 +1,122 @@
 #include "core/Logger.hpp"
-#include <iostream>
-#include <chrono>
+#include <algorithm>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <ctime>
-#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
-bool Logger::s_Initialized = false;
+std::atomic<bool> Logger::s_Initialized{ false };
 
-void Logger::Init() {
-    s_Initialized = true;
+namespace {
+
+// Single-producer single-consumer byte ring. Head and Tail are running byte
+// counts; only the owning thread advances Head, only the drainer advances Tail.
+struct LogRing {
+    explicit LogRing(size_t capacity)
+        : Buffer(new uint8_t[capacity]), Capacity(capacity), Mask(capacity - 1) {
+    }
+
+    std::unique_ptr<uint8_t[]> Buffer;
+    size_t Capacity;
+    size_t Mask;
+    alignas(64) std::atomic<uint64_t> Head{ 0 };
+    alignas(64) std::atomic<uint64_t> Tail{ 0 };
+    std::atomic<uint64_t> Dropped{ 0 };
+    std::atomic<bool> Retired{ false };
+};
+
+struct PendingRecord {
+    uint64_t Timestamp;
+    const uint8_t* Data;  // Still in its ring until the batch is written
+};
+
+struct LoggerBackend {
+    ~LoggerBackend() { StopThread(); }
+
+    void StopThread() {
+        if (!Thread.joinable()) return;
+        {
+            std::lock_guard<std::mutex> lock(WakeMutex);
+            StopRequested = true;
+        }
+        Wake.notify_all();
+        Thread.join();
+    }
+
+    Logger::Config Settings;
+
+    // Rings outlive their threads until drained; registration is the only locked producer step
+    std::mutex RegistryMutex;
+    std::vector<std::unique_ptr<LogRing>> Rings;
+    std::atomic<uint32_t> Epoch{ 0 };
+
+    // Held while draining so there is only ever one consumer
+    std::mutex DrainMutex;
+    std::vector<PendingRecord> Batch;
+    std::vector<uint64_t> Tails;
+    std::string Output;
+    std::atomic<uint64_t> TotalDropped{ 0 };
+
+    // Wall clock at Init, for turning steady timestamps into dates
+    std::chrono::system_clock::time_point WallBase;
+    std::chrono::steady_clock::time_point SteadyBase;
+
+    std::thread Thread;
+    std::mutex WakeMutex;
+    std::condition_variable Wake;
+    bool StopRequested = false;
+};
+
+LoggerBackend& GetBackend() {
+    static LoggerBackend backend;
+    return backend;
 }
 
-void Logger::Shutdown() {
-    s_Initialized = false;
-}
-
-void Logger::LogMessage(LogLevel level, const std::string& message) {
-    if (!s_Initialized) return;
-    
-    // Get current time
-    auto now = std::chrono::system_clock::now();
-    auto time = std::chrono::system_clock::to_time_t(now);
-    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
-    
-    // Format timestamp
-    std::stringstream ss;
-    ss << std::put_time(std::localtime(&time), "%Y-%m-%d %H:%M:%S");
-    ss << '.' << std::setfill('0') << std::setw(3) << ms.count();
-    
-    // Output log message
-    std::cout << "[" << ss.str() << "] [" << GetLevelString(level) << "] " << message << std::endl;
-}
-
-const char* Logger::GetLevelString(LogLevel level) {
+// Marks the thread's ring retired on thread exit so the drainer can free it
+struct ThreadRing {
+    LogRing* Ring = nullptr;
+    uint32_t Epoch = 0;
+
+    ~ThreadRing() {
+        if (Ring) Ring->Retired.store(true, std::memory_order_release);
+    }
+};
+
+thread_local ThreadRing t_Ring;
+
+LogRing* GetThreadRing() {
+    LoggerBackend& backend = GetBackend();
+    if (t_Ring.Ring && t_Ring.Epoch == backend.Epoch.load(std::memory_order_acquire)) {
+        return t_Ring.Ring;
+    }
+
+    // First message from this thread, or the logger was re-initialized
+    std::lock_guard<std::mutex> lock(backend.RegistryMutex);
+    if (t_Ring.Ring) {
+        t_Ring.Ring->Retired.store(true, std::memory_order_release);
+    }
+
+    size_t capacity = 4096;
+    while (capacity < backend.Settings.RingSize) {
+        capacity *= 2;
+    }
+
+    backend.Rings.push_back(std::make_unique<LogRing>(capacity));
+    t_Ring.Ring = backend.Rings.back().get();
+    t_Ring.Epoch = backend.Epoch.load(std::memory_order_relaxed);
+    return t_Ring.Ring;
+}
+
+std::FILE* GetStream(const LoggerBackend& backend) {
+    return backend.Settings.Output ? backend.Settings.Output : stdout;
+}
+
+const char* GetLevelString(LogLevel level) {
     switch (level) {
         case LogLevel::Trace:    return "TRACE";
         case LogLevel::Info:     return "INFO";
@@ -41,3 +126,386 @@ const char* Logger::GetLevelString(LogLevel level) {
         default:                 return "UNKNOWN";
     }
 }
+
+template<typename T>
+T Read(const uint8_t*& cursor) {
+    T value;
+    std::memcpy(&value, cursor, sizeof(T));
+    cursor += sizeof(T);
+    return value;
+}
+
+// Appends into a fixed buffer; anything past the end is cut off
+class LineWriter {
+public:
+    LineWriter(char* data, size_t capacity)
+        : m_Data(data), m_Capacity(capacity), m_Size(0) {
+    }
+
+    void Append(const char* text, size_t length) {
+        const size_t count = std::min(length, m_Capacity - m_Size);
+        std::memcpy(m_Data + m_Size, text, count);
+        m_Size += count;
+    }
+
+    void Append(char c) {
+        if (m_Size < m_Capacity) m_Data[m_Size++] = c;
+    }
+
+    void Fill(char c, size_t count) {
+        while (count-- > 0) Append(c);
+    }
+
+    // Reserves the last byte so a newline always fits
+    void FinishLine() {
+        if (m_Size == m_Capacity) --m_Size;
+        m_Data[m_Size++] = '\n';
+    }
+
+    const char* GetData() const { return m_Data; }
+    size_t GetSize() const { return m_Size; }
+
+private:
+    char* m_Data;
+    size_t m_Capacity;
+    size_t m_Size;
+};
+
+constexpr size_t LineCapacity = 4096;
+
+// Decodes the next argument and writes it with the field's width, fill,
+// alignment, precision and type applied
+void AppendArg(LineWriter& out, const uint8_t*& cursor, const LogFormatSpec& spec) {
+    char buffer[128];
+    const char* text = buffer;
+    int length = 0;
+    bool numeric = true;
+
+    auto formatDouble = [&](double value) {
+        const char type = (spec.Type == 'e' || spec.Type == 'g') ? spec.Type : (spec.Type == 'f' ? 'f' : 'g');
+        char pattern[] = { '%', '.', '*', type, '\0' };
+        return std::snprintf(buffer, sizeof(buffer), pattern, spec.Precision >= 0 ? spec.Precision : 6, value);
+    };
+
+    switch (static_cast<LogArgType>(*cursor++)) {
+        case LogArgType::Bool:
+            buffer[0] = Read<uint8_t>(cursor) ? '1' : '0';
+            length = 1;
+            break;
+        case LogArgType::Char:
+            buffer[0] = Read<char>(cursor);
+            length = 1;
+            numeric = false;
+            break;
+        case LogArgType::Int: {
+            const int64_t value = Read<int64_t>(cursor);
+            if (spec.Type == 'f' || spec.Type == 'e' || spec.Type == 'g') {
+                length = formatDouble(static_cast<double>(value));
+            } else if (spec.Type == 'x' || spec.Type == 'X') {
+                length = std::snprintf(buffer, sizeof(buffer), spec.Type == 'x' ? "%llx" : "%llX",
+                                       static_cast<unsigned long long>(value));
+            } else {
+                length = std::snprintf(buffer, sizeof(buffer), "%lld", static_cast<long long>(value));
+            }
+            break;
+        }
+        case LogArgType::UInt: {
+            const uint64_t value = Read<uint64_t>(cursor);
+            if (spec.Type == 'f' || spec.Type == 'e' || spec.Type == 'g') {
+                length = formatDouble(static_cast<double>(value));
+            } else if (spec.Type == 'x' || spec.Type == 'X') {
+                length = std::snprintf(buffer, sizeof(buffer), spec.Type == 'x' ? "%llx" : "%llX",
+                                       static_cast<unsigned long long>(value));
+            } else {
+                length = std::snprintf(buffer, sizeof(buffer), "%llu", static_cast<unsigned long long>(value));
+            }
+            break;
+        }
+        case LogArgType::Double: {
+            const double value = Read<double>(cursor);
+            // Without a type or precision, print the shortest form like a stream would
+            length = (spec.Type == 0 && spec.Precision < 0) ? std::snprintf(buffer, sizeof(buffer), "%g", value)
+                                                              : formatDouble(value);
+            break;
+        }
+        case LogArgType::String: {
+            const uint32_t stored = Read<uint32_t>(cursor);
+            text = reinterpret_cast<const char*>(cursor);
+            cursor += stored;
+            // Precision on a string is a maximum length
+            length = static_cast<int>(spec.Precision >= 0 ? std::min<uint32_t>(stored, spec.Precision) : stored);
+            numeric = false;
+            break;
+        }
+        case LogArgType::Pointer:
+            length = std::snprintf(buffer, sizeof(buffer), "0x%llx", static_cast<unsigned long long>(Read<uint64_t>(cursor)));
+            break;
+    }
+
+    // snprintf reports the untruncated length
+    if (text == buffer) {
+        length = std::max(0, std::min(length, static_cast<int>(sizeof(buffer)) - 1));
+    }
+    const size_t padding = spec.Width > length ? spec.Width - static_cast<size_t>(length) : 0;
+    const char align = spec.Align ? spec.Align : (numeric ? '>' : '<');
+
+    const size_t before = align == '>' ? padding : (align == '^' ? padding / 2 : 0);
+    out.Fill(spec.Fill, before);
+    out.Append(text, static_cast<size_t>(length));
+    out.Fill(spec.Fill, padding - before);
+}
+
+void AppendTimestamp(LineWriter& out, uint64_t timestamp) {
+    LoggerBackend& backend = GetBackend();
+    const auto steady = std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(timestamp));
+    const auto wall = backend.WallBase + std::chrono::duration_cast<std::chrono::system_clock::duration>(steady - backend.SteadyBase);
+    const auto time = std::chrono::system_clock::to_time_t(wall);
+    const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(wall.time_since_epoch()).count() % 1000;
+
+    // Only ever called with DrainMutex held, so localtime's static buffer is safe
+    char buffer[32];
+    const size_t length = std::strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S", std::localtime(&time));
+    out.Append(buffer, length);
+    const int msLength = std::snprintf(buffer, sizeof(buffer), ".%03d", static_cast<int>(ms));
+    out.Append(buffer, static_cast<size_t>(msLength));
+}
+
+// Writes one binary record as "[time] [LEVEL] message\n"
+void FormatRecord(const uint8_t* data, LineWriter& out) {
+    LogRecordHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    const uint8_t* cursor = data + sizeof(header);
+
+    const char* inlineText = nullptr;
+    uint32_t inlineLength = 0;
+    if (header.Flags & LogRecordHeader::InlineFormat) {
+        inlineLength = Read<uint32_t>(cursor);
+        inlineText = reinterpret_cast<const char*>(cursor);
+        cursor += inlineLength;
+    }
+
+    out.Append('[');
+    AppendTimestamp(out, header.Timestamp);
+    out.Append("] [", 3);
+    const char* level = GetLevelString(static_cast<LogLevel>(header.Level));
+    out.Append(level, std::strlen(level));
+    out.Append("] ", 2);
+
+    if (inlineText && header.ArgCount == 0) {
+        // Plain runtime messages are printed verbatim, braces and all
+        out.Append(inlineText, inlineLength);
+    } else {
+        // Runtime formats are parsed here, with the same parser the macros run at compile time
+        const LogFormat parsed = inlineText ? LogFormat(inlineText, inlineLength) : LogFormat("");
+        const LogFormat& format = inlineText ? parsed : *header.Format;
+
+        if (!format.IsValid()) {
+            out.Append(format.GetText(), format.GetLength());
+        } else {
+            uint32_t argsLeft = header.ArgCount;
+            for (size_t i = 0; i < format.GetSegmentCount(); ++i) {
+                const LogFormatSegment& segment = format.GetSegment(i);
+                if (segment.IsArg && argsLeft > 0) {
+                    AppendArg(out, cursor, segment.Spec);
+                    --argsLeft;
+                } else {
+                    // Literal text, or a field whose argument was truncated away
+                    out.Append(format.GetText() + segment.Begin, segment.Length);
+                }
+            }
+        }
+    }
+
+    if (header.Flags & LogRecordHeader::Truncated) {
+        out.Append(" [truncated]", 12);
+    }
+    out.FinishLine();
+}
+
+// Caller holds DrainMutex. Returns the number of records written.
+size_t DrainRings(LoggerBackend& backend) {
+    backend.Batch.clear();
+    backend.Tails.clear();
+
+    // Producers only take this lock to register, so holding it while formatting is cheap
+    std::lock_guard<std::mutex> lock(backend.RegistryMutex);
+
+    uint64_t dropped = 0;
+    for (const std::unique_ptr<LogRing>& ring : backend.Rings) {
+        uint64_t tail = ring->Tail.load(std::memory_order_relaxed);
+        const uint64_t head = ring->Head.load(std::memory_order_acquire);
+
+        while (tail < head) {
+            const uint8_t* data = ring->Buffer.get() + (tail & ring->Mask);
+            LogRecordHeader header;
+            std::memcpy(&header, data, sizeof(uint32_t) + sizeof(uint8_t));
+            if (header.Level != LogRecordHeader::SkipLevel) {
+                std::memcpy(&header, data, sizeof(header));
+                backend.Batch.push_back({ header.Timestamp, data });
+            }
+            tail += header.Size;
+        }
+        backend.Tails.push_back(tail);
+        dropped += ring->Dropped.exchange(0, std::memory_order_relaxed);
+    }
+
+    const size_t written = backend.Batch.size();
+    if (written > 0 || dropped > 0) {
+        // Rings are drained one after another; restore global order
+        std::stable_sort(backend.Batch.begin(), backend.Batch.end(),
+                         [](const PendingRecord& a, const PendingRecord& b) { return a.Timestamp < b.Timestamp; });
+
+        // Output keeps its capacity between batches, so steady-state draining does not allocate
+        backend.Output.clear();
+        char line[LineCapacity];
+        for (const PendingRecord& record : backend.Batch) {
+            LineWriter writer(line, sizeof(line));
+            FormatRecord(record.Data, writer);
+            backend.Output.append(writer.GetData(), writer.GetSize());
+        }
+        if (dropped > 0) {
+            backend.TotalDropped.fetch_add(dropped, std::memory_order_relaxed);
+            const int length = std::snprintf(line, sizeof(line), "[WARN] Logger ring full, dropped %llu message(s)\n",
+                                             static_cast<unsigned long long>(dropped));
+            backend.Output.append(line, static_cast<size_t>(length));
+        }
+
+        std::FILE* stream = GetStream(backend);
+        std::fwrite(backend.Output.data(), 1, backend.Output.size(), stream);
+        std::fflush(stream);
+    }
+
+    // Only now may producers reuse the space; retired rings are freed once drained
+    for (size_t i = 0, ringIndex = 0; ringIndex < backend.Rings.size(); ++i) {
+        LogRing& ring = *backend.Rings[ringIndex];
+        // Retired was set after the producer's last record, which this drain already saw
+        const bool retired = ring.Retired.load(std::memory_order_acquire) &&
+                             ring.Head.load(std::memory_order_acquire) == backend.Tails[i];
+        ring.Tail.store(backend.Tails[i], std::memory_order_release);
+        if (retired) {
+            backend.Rings.erase(backend.Rings.begin() + static_cast<std::ptrdiff_t>(ringIndex));
+        } else {
+            ++ringIndex;
+        }
+    }
+
+    return written;
+}
+
+void LoggerThreadMain() {
+    LoggerBackend& backend = GetBackend();
+    while (true) {
+        size_t written;
+        {
+            std::lock_guard<std::mutex> lock(backend.DrainMutex);
+            written = DrainRings(backend);
+        }
+
+        std::unique_lock<std::mutex> lock(backend.WakeMutex);
+        if (backend.StopRequested) break;
+        if (written == 0) {
+            // Producers never signal; idle polling keeps the hot path free of syscalls
+            backend.Wake.wait_for(lock, std::chrono::milliseconds(5));
+        }
+    }
+}
+
+bool PushRecord(LogRing& ring, const uint8_t* data, size_t size, LogOverflowPolicy policy) {
+    uint64_t head = ring.Head.load(std::memory_order_relaxed);
+    const size_t offset = head & ring.Mask;
+    const size_t toEnd = ring.Capacity - offset;
+    // Records never straddle the end; pad to the start instead
+    const size_t needed = size + (toEnd < size ? toEnd : 0);
+
+    while (head + needed - ring.Tail.load(std::memory_order_acquire) > ring.Capacity) {
+        if (policy == LogOverflowPolicy::Drop) {
+            ring.Dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        std::this_thread::yield();
+    }
+
+    if (toEnd < size) {
+        LogRecordHeader skip{};
+        skip.Size = static_cast<uint32_t>(toEnd);
+        skip.Level = LogRecordHeader::SkipLevel;
+        std::memcpy(ring.Buffer.get() + offset, &skip, sizeof(uint32_t) + sizeof(uint8_t));
+        head += toEnd;
+    }
+
+    std::memcpy(ring.Buffer.get() + (head & ring.Mask), data, size);
+    ring.Head.store(head + size, std::memory_order_release);
+    return true;
+}
+
+} // namespace
+
+void Logger::Init() {
+    Init(Config());
+}
+
+void Logger::Init(const Config& config) {
+    if (s_Initialized.load()) return;
+
+    LoggerBackend& backend = GetBackend();
+    {
+        std::lock_guard<std::mutex> lock(backend.RegistryMutex);
+        backend.Settings = config;
+        // Existing threads retire their old rings and pick up ones sized for the new config
+        backend.Epoch.fetch_add(1, std::memory_order_release);
+    }
+    backend.WallBase = std::chrono::system_clock::now();
+    backend.SteadyBase = std::chrono::steady_clock::now();
+    backend.TotalDropped = 0;
+
+    if (config.Async) {
+        backend.StopRequested = false;
+        backend.Thread = std::thread(LoggerThreadMain);
+    }
+    s_Initialized = true;
+}
+
+void Logger::Shutdown() {
+    if (!s_Initialized.exchange(false)) return;
+
+    LoggerBackend& backend = GetBackend();
+    backend.StopThread();
+    Flush();
+}
+
+void Logger::Flush() {
+    LoggerBackend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.DrainMutex);
+    while (DrainRings(backend) > 0) {
+    }
+}
+
+uint64_t Logger::GetDroppedCount() {
+    return GetBackend().TotalDropped.load(std::memory_order_relaxed);
+}
+
+void Logger::Submit(LogRecordBuilder& record) {
+    LoggerBackend& backend = GetBackend();
+    const uint8_t* data = record.Finish();
+
+    if (!backend.Settings.Async) {
+        // Format right here, with the same formatter the logger thread uses
+        std::lock_guard<std::mutex> lock(backend.DrainMutex);
+        char line[LineCapacity];
+        LineWriter writer(line, sizeof(line));
+        FormatRecord(data, writer);
+        std::FILE* stream = GetStream(backend);
+        std::fwrite(writer.GetData(), 1, writer.GetSize(), stream);
+        std::fflush(stream);
+        return;
+    }
+
+    LogRing* ring = GetThreadRing();
+    PushRecord(*ring, data, record.GetSize(), backend.Settings.Overflow);
+
+    LogRecordHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (static_cast<LogLevel>(header.Level) == LogLevel::Critical) {
+        Flush();
+    }
+}
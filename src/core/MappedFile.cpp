@@ -0,0 +1,177 @@
+#include "core/MappedFile.hpp"
+#include "core/Logger.hpp"
+#include <algorithm>
+#include <utility>
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+MappedFile::MappedFile()
+    : m_Data(nullptr)
+    , m_Size(0)
+#ifdef _WIN32
+    , m_File(nullptr)
+    , m_Mapping(nullptr)
+#endif
+{
+}
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : MappedFile() {
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        Close();
+        std::swap(m_Data, other.m_Data);
+        std::swap(m_Size, other.m_Size);
+#ifdef _WIN32
+        std::swap(m_File, other.m_File);
+        std::swap(m_Mapping, other.m_Mapping);
+#endif
+    }
+    return *this;
+}
+
+#ifdef _WIN32
+
+bool MappedFile::Open(const std::string& path, bool randomAccess) {
+    Close();
+
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        LOG_ERROR("Failed to open file for mapping: {}", path);
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        LOG_ERROR("Cannot map empty file: {}", path);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!view) {
+        if (mapping) CloseHandle(mapping);
+        CloseHandle(file);
+        LOG_ERROR("Failed to map file: {}", path);
+        return false;
+    }
+
+    // No per-mapping read-ahead control here; Prefetch still works
+    (void)randomAccess;
+    m_File = file;
+    m_Mapping = mapping;
+    m_Data = static_cast<const uint8_t*>(view);
+    m_Size = static_cast<size_t>(size.QuadPart);
+    return true;
+}
+
+void MappedFile::Prefetch(size_t offset, size_t size) const {
+    if (!m_Data || offset >= m_Size) return;
+
+    WIN32_MEMORY_RANGE_ENTRY range;
+    range.VirtualAddress = const_cast<uint8_t*>(m_Data + offset);
+    range.NumberOfBytes = std::min(size, m_Size - offset);
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+}
+
+void MappedFile::Release(size_t offset, size_t size) const {
+    if (!m_Data || offset >= m_Size) return;
+
+    // Unlocking pages that are not locked trims them from the working set
+    VirtualUnlock(const_cast<uint8_t*>(m_Data + offset), std::min(size, m_Size - offset));
+}
+
+void MappedFile::Close() {
+    if (m_Data) {
+        UnmapViewOfFile(m_Data);
+        CloseHandle(static_cast<HANDLE>(m_Mapping));
+        CloseHandle(static_cast<HANDLE>(m_File));
+    }
+    m_Data = nullptr;
+    m_Size = 0;
+    m_File = nullptr;
+    m_Mapping = nullptr;
+}
+
+#else
+
+bool MappedFile::Open(const std::string& path, bool randomAccess) {
+    Close();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        LOG_ERROR("Failed to open file for mapping: {}", path);
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        ::close(fd);
+        LOG_ERROR("Cannot map empty file: {}", path);
+        return false;
+    }
+
+    void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps its own reference to the file
+    ::close(fd);
+    if (view == MAP_FAILED) {
+        LOG_ERROR("Failed to map file: {}", path);
+        return false;
+    }
+
+    if (randomAccess) {
+        madvise(view, static_cast<size_t>(info.st_size), MADV_RANDOM);
+    }
+
+    m_Data = static_cast<const uint8_t*>(view);
+    m_Size = static_cast<size_t>(info.st_size);
+    return true;
+}
+
+namespace {
+    // madvise wants a page-aligned start; widen the range to whole pages
+    void AdviseRange(const uint8_t* data, size_t mappedSize, size_t offset, size_t size, int advice) {
+        if (!data || offset >= mappedSize) return;
+
+        static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        const size_t begin = offset & ~(pageSize - 1);
+        const size_t end = std::min(offset + size, mappedSize);
+        madvise(const_cast<uint8_t*>(data + begin), end - begin, advice);
+    }
+}
+
+void MappedFile::Prefetch(size_t offset, size_t size) const {
+    AdviseRange(m_Data, m_Size, offset, size, MADV_WILLNEED);
+}
+
+void MappedFile::Release(size_t offset, size_t size) const {
+    AdviseRange(m_Data, m_Size, offset, size, MADV_DONTNEED);
+}
+
+void MappedFile::Close() {
+    if (m_Data) {
+        munmap(const_cast<uint8_t*>(m_Data), m_Size);
+    }
+    m_Data = nullptr;
+    m_Size = 0;
+}
+
+#endif
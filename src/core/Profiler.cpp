@@ -0,0 +1,470 @@
+#include "core/Profiler.hpp"
+#include "core/Logger.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+std::atomic<bool> Profiler::s_Enabled{ false };
+
+namespace {
+
+// Events recorded by one thread since the last EndFrame(). Only the owner
+// appends; EndFrame() swaps the vector out under the same lock.
+struct ThreadBuffer {
+    uint32_t ThreadId = 0;
+    uint32_t Depth = 0;  // Owner thread only
+    std::mutex Mutex;
+    std::vector<ProfileEvent> Events;
+    uint64_t Dropped = 0;
+    std::atomic<bool> Retired{ false };
+};
+
+// Scratch node used while merging a frame's events into a tree
+struct ZoneNode {
+    const char* Name;
+    uint32_t ThreadId;
+    uint32_t FirstChild;
+    uint32_t LastChild;
+    uint32_t NextSibling;
+    uint32_t CallCount;
+    uint64_t Ticks;
+    uint64_t ChildTicks;
+};
+
+constexpr uint32_t NoNode = ~0u;
+
+struct ProfilerBackend {
+    std::mutex RegistryMutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> Buffers;
+    std::vector<std::pair<uint32_t, std::string>> ThreadNames;
+    std::atomic<uint32_t> Epoch{ 0 };
+    std::atomic<uint32_t> NextThreadId{ 0 };
+
+    double MsPerTick = 1e-6;
+    uint64_t TickBase = 0;
+
+    // Frame thread only
+    uint64_t FrameIndex = 0;
+    uint64_t FrameBegin = 0;
+    ProfileFrame LastFrame;
+    std::vector<ProfileEvent> Collected;
+    std::vector<ProfileEvent> Swap;
+    std::vector<ZoneNode> Nodes;
+    std::vector<std::pair<uint32_t, uint32_t>> Stack;
+
+    std::mutex CaptureMutex;
+    bool Capturing = false;
+    std::vector<ProfileEvent> Captured;
+
+    std::atomic<uint64_t> TotalDropped{ 0 };
+};
+
+ProfilerBackend& GetBackend() {
+    static ProfilerBackend backend;
+    return backend;
+}
+
+// Marks the thread's buffer retired on thread exit so EndFrame() can free it
+struct ThreadSlot {
+    std::shared_ptr<ThreadBuffer> Buffer;
+    uint32_t Epoch = 0;
+    uint32_t ThreadId = NoNode;
+
+    ~ThreadSlot() {
+        if (Buffer) Buffer->Retired.store(true, std::memory_order_release);
+    }
+};
+
+thread_local ThreadSlot t_Slot;
+
+ThreadBuffer& GetThreadBuffer() {
+    ProfilerBackend& backend = GetBackend();
+    if (t_Slot.Buffer && t_Slot.Epoch == backend.Epoch.load(std::memory_order_acquire)) {
+        return *t_Slot.Buffer;
+    }
+
+    // First zone on this thread, or the profiler was re-initialized
+    if (t_Slot.ThreadId == NoNode) {
+        t_Slot.ThreadId = backend.NextThreadId.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::lock_guard<std::mutex> lock(backend.RegistryMutex);
+    if (t_Slot.Buffer) {
+        t_Slot.Buffer->Retired.store(true, std::memory_order_release);
+    }
+    auto buffer = std::make_shared<ThreadBuffer>();
+    buffer->ThreadId = t_Slot.ThreadId;
+    buffer->Events.reserve(1024);
+    backend.Buffers.push_back(buffer);
+    t_Slot.Buffer = std::move(buffer);
+    t_Slot.Epoch = backend.Epoch.load(std::memory_order_relaxed);
+    return *t_Slot.Buffer;
+}
+
+// Gathers every thread's events into backend.Collected
+void CollectEvents(ProfilerBackend& backend) {
+    backend.Collected.clear();
+
+    std::lock_guard<std::mutex> lock(backend.RegistryMutex);
+    for (auto it = backend.Buffers.begin(); it != backend.Buffers.end();) {
+        ThreadBuffer& buffer = **it;
+        // Read Retired first: once set, the owner has recorded its last zone
+        const bool retired = buffer.Retired.load(std::memory_order_acquire);
+        {
+            std::lock_guard<std::mutex> bufferLock(buffer.Mutex);
+            backend.Swap.swap(buffer.Events);
+            if (buffer.Dropped > 0) {
+                backend.TotalDropped.fetch_add(buffer.Dropped, std::memory_order_relaxed);
+                buffer.Dropped = 0;
+            }
+        }
+        backend.Collected.insert(backend.Collected.end(), backend.Swap.begin(), backend.Swap.end());
+        backend.Swap.clear();
+
+        if (retired) {
+            it = backend.Buffers.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+uint32_t FindOrAddChild(std::vector<ZoneNode>& nodes, uint32_t parent, const char* name, uint32_t threadId) {
+    for (uint32_t child = nodes[parent].FirstChild; child != NoNode; child = nodes[child].NextSibling) {
+        const char* existing = nodes[child].Name;
+        // Identical literals in different translation units may not share an address
+        if (existing == name || std::strcmp(existing, name) == 0) {
+            return child;
+        }
+    }
+
+    const auto index = static_cast<uint32_t>(nodes.size());
+    nodes.push_back({ name, threadId, NoNode, NoNode, NoNode, 0, 0, 0 });
+    ZoneNode& parentNode = nodes[parent];
+    if (parentNode.LastChild == NoNode) {
+        parentNode.FirstChild = index;
+    } else {
+        nodes[parentNode.LastChild].NextSibling = index;
+    }
+    parentNode.LastChild = index;
+    return index;
+}
+
+// Merges backend.Collected into a zone tree. Each thread gets a nameless
+// root node; nesting is recovered from the recorded depths.
+void BuildZoneTree(ProfilerBackend& backend, ProfileFrame& frame) {
+    std::vector<ProfileEvent>& events = backend.Collected;
+    std::sort(events.begin(), events.end(), [](const ProfileEvent& a, const ProfileEvent& b) {
+        if (a.ThreadId != b.ThreadId) return a.ThreadId < b.ThreadId;
+        if (a.Begin != b.Begin) return a.Begin < b.Begin;
+        return a.Depth < b.Depth;
+    });
+
+    std::vector<ZoneNode>& nodes = backend.Nodes;
+    std::vector<std::pair<uint32_t, uint32_t>>& stack = backend.Stack;  // (event depth + 1, node)
+    nodes.clear();
+
+    for (size_t i = 0; i < events.size(); ++i) {
+        const ProfileEvent& event = events[i];
+        if (i == 0 || event.ThreadId != events[i - 1].ThreadId) {
+            stack.clear();
+            stack.emplace_back(0, static_cast<uint32_t>(nodes.size()));
+            nodes.push_back({ nullptr, event.ThreadId, NoNode, NoNode, NoNode, 0, 0, 0 });
+        }
+
+        while (stack.size() > 1 && stack.back().first > event.Depth) {
+            stack.pop_back();
+        }
+
+        const uint32_t parent = stack.back().second;
+        const uint32_t node = FindOrAddChild(nodes, parent, event.Name, event.ThreadId);
+        const uint64_t ticks = event.End - event.Begin;
+        nodes[node].CallCount++;
+        nodes[node].Ticks += ticks;
+        nodes[parent].ChildTicks += ticks;
+        stack.emplace_back(event.Depth + 1, node);
+    }
+
+    // Flatten in pre-order, skipping the per-thread roots
+    frame.Zones.clear();
+    stack.clear();
+    for (size_t root = 0; root < nodes.size(); ++root) {
+        if (nodes[root].Name != nullptr) continue;
+
+        // (node, index of its parent in frame.Zones)
+        for (uint32_t child = nodes[root].FirstChild; child != NoNode; child = nodes[child].NextSibling) {
+            stack.emplace_back(child, ProfileZone::NoParent);
+        }
+        std::reverse(stack.begin(), stack.end());
+
+        while (!stack.empty()) {
+            const auto [nodeIndex, parent] = stack.back();
+            stack.pop_back();
+
+            const ZoneNode& node = nodes[nodeIndex];
+            const auto zoneIndex = static_cast<uint32_t>(frame.Zones.size());
+            ProfileZone zone;
+            zone.Name = node.Name;
+            zone.Parent = parent;
+            zone.Depth = parent == ProfileZone::NoParent ? 0 : frame.Zones[parent].Depth + 1;
+            zone.ThreadId = node.ThreadId;
+            zone.CallCount = node.CallCount;
+            zone.TotalMs = node.Ticks * backend.MsPerTick;
+            zone.SelfMs = (node.Ticks > node.ChildTicks ? node.Ticks - node.ChildTicks : 0) * backend.MsPerTick;
+            frame.Zones.push_back(zone);
+
+            const size_t mark = stack.size();
+            for (uint32_t child = node.FirstChild; child != NoNode; child = nodes[child].NextSibling) {
+                stack.emplace_back(child, zoneIndex);
+            }
+            std::reverse(stack.begin() + static_cast<std::ptrdiff_t>(mark), stack.end());
+        }
+    }
+}
+
+void WriteJsonString(std::ostream& out, const char* text) {
+    out << '"';
+    for (const char* c = text; *c; ++c) {
+        switch (*c) {
+            case '"':  out << "\\\""; break;
+            case '\\': out << "\\\\"; break;
+            case '\n': out << "\\n"; break;
+            case '\t': out << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(*c) < 0x20) {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", *c);
+                    out << escaped;
+                } else {
+                    out << *c;
+                }
+        }
+    }
+    out << '"';
+}
+
+} // namespace
+
+void Profiler::Init() {
+    if (s_Enabled.load()) return;
+
+    ProfilerBackend& backend = GetBackend();
+    {
+        std::lock_guard<std::mutex> lock(backend.RegistryMutex);
+        // Existing threads drop their old buffers and register fresh ones
+        backend.Buffers.clear();
+        backend.Epoch.fetch_add(1, std::memory_order_release);
+    }
+
+#if PROFILER_USE_RDTSC
+    // The TSC rate is constant on anything we ship on; measure it against steady_clock
+    const auto steadyStart = std::chrono::steady_clock::now();
+    const uint64_t tscStart = Now();
+    while (std::chrono::steady_clock::now() - steadyStart < std::chrono::milliseconds(10)) {
+    }
+    const uint64_t tscEnd = Now();
+    const double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - steadyStart).count();
+    backend.MsPerTick = elapsedMs / static_cast<double>(tscEnd - tscStart);
+#else
+    backend.MsPerTick = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::duration(1)).count();
+#endif
+
+    backend.TickBase = Now();
+    backend.FrameIndex = 0;
+    backend.FrameBegin = backend.TickBase;
+    backend.LastFrame = ProfileFrame();
+    backend.TotalDropped = 0;
+    {
+        std::lock_guard<std::mutex> lock(backend.CaptureMutex);
+        backend.Capturing = false;
+        backend.Captured.clear();
+    }
+
+    s_Enabled = true;
+    LOG_INFO("Profiler initialized ({:.3f} ns per tick)", backend.MsPerTick * 1e6);
+}
+
+void Profiler::Shutdown() {
+    if (!s_Enabled.exchange(false)) return;
+
+    ProfilerBackend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.RegistryMutex);
+    backend.Buffers.clear();
+    backend.Epoch.fetch_add(1, std::memory_order_release);
+}
+
+void Profiler::SetThreadName(const char* name) {
+    ProfilerBackend& backend = GetBackend();
+    const uint32_t threadId = GetThreadBuffer().ThreadId;
+
+    std::lock_guard<std::mutex> lock(backend.RegistryMutex);
+    for (auto& [id, existing] : backend.ThreadNames) {
+        if (id == threadId) {
+            existing = name;
+            return;
+        }
+    }
+    backend.ThreadNames.emplace_back(threadId, name);
+}
+
+uint32_t Profiler::RegisterTrack(const char* name) {
+    ProfilerBackend& backend = GetBackend();
+    const uint32_t trackId = backend.NextThreadId.fetch_add(1, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(backend.RegistryMutex);
+    backend.ThreadNames.emplace_back(trackId, name);
+    return trackId;
+}
+
+void Profiler::RecordEvent(const ProfileEvent& event) {
+    if (!IsEnabled()) return;
+
+    ThreadBuffer& buffer = GetThreadBuffer();
+    std::lock_guard<std::mutex> lock(buffer.Mutex);
+    if (buffer.Events.size() >= MaxEventsPerThread) {
+        ++buffer.Dropped;
+        return;
+    }
+    buffer.Events.push_back(event);
+}
+
+void Profiler::BeginFrame() {
+    GetBackend().FrameBegin = Now();
+}
+
+void Profiler::EndFrame() {
+    if (!IsEnabled()) return;
+
+    ProfilerBackend& backend = GetBackend();
+    const uint64_t frameEnd = Now();
+
+    CollectEvents(backend);
+
+    {
+        std::lock_guard<std::mutex> lock(backend.CaptureMutex);
+        if (backend.Capturing) {
+            const size_t room = MaxCapturedEvents - std::min(MaxCapturedEvents, backend.Captured.size());
+            const size_t count = std::min(room, backend.Collected.size());
+            backend.Captured.insert(backend.Captured.end(), backend.Collected.begin(),
+                                    backend.Collected.begin() + static_cast<std::ptrdiff_t>(count));
+            backend.TotalDropped.fetch_add(backend.Collected.size() - count, std::memory_order_relaxed);
+        }
+    }
+
+    ProfileFrame& frame = backend.LastFrame;
+    frame.Index = backend.FrameIndex++;
+    frame.DurationMs = (frameEnd - backend.FrameBegin) * backend.MsPerTick;
+    BuildZoneTree(backend, frame);
+}
+
+const ProfileFrame& Profiler::GetLastFrame() {
+    return GetBackend().LastFrame;
+}
+
+void Profiler::BeginCapture() {
+    ProfilerBackend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.CaptureMutex);
+    backend.Captured.clear();
+    backend.Capturing = true;
+}
+
+void Profiler::EndCapture() {
+    ProfilerBackend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.CaptureMutex);
+    backend.Capturing = false;
+}
+
+bool Profiler::IsCapturing() {
+    ProfilerBackend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.CaptureMutex);
+    return backend.Capturing;
+}
+
+size_t Profiler::GetCapturedEventCount() {
+    ProfilerBackend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.CaptureMutex);
+    return backend.Captured.size();
+}
+
+bool Profiler::ExportChromeTrace(const std::string& path) {
+    ProfilerBackend& backend = GetBackend();
+
+    std::ofstream file(path);
+    if (!file) {
+        Logger::Error("Failed to open profile capture for writing: " + path);
+        return false;
+    }
+
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    {
+        std::lock_guard<std::mutex> lock(backend.RegistryMutex);
+        for (const auto& [id, name] : backend.ThreadNames) {
+            file << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << id
+                 << ",\"args\":{\"name\":";
+            WriteJsonString(file, name.c_str());
+            file << "}}";
+            first = false;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(backend.CaptureMutex);
+    char times[64];
+    for (const ProfileEvent& event : backend.Captured) {
+        // Complete ("X") events in microseconds since Init()
+        const double begin = (event.Begin - std::min(event.Begin, backend.TickBase)) * backend.MsPerTick * 1000.0;
+        const double duration = (event.End - event.Begin) * backend.MsPerTick * 1000.0;
+        std::snprintf(times, sizeof(times), "\"ts\":%.3f,\"dur\":%.3f", begin, duration);
+
+        file << (first ? "" : ",\n") << "{\"name\":";
+        WriteJsonString(file, event.Name);
+        file << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.ThreadId << ',' << times << '}';
+        first = false;
+    }
+    file << "\n]}\n";
+
+    if (!file) {
+        Logger::Error("Failed to write profile capture: " + path);
+        return false;
+    }
+    LOG_INFO("Wrote {} profile event(s) to {}", backend.Captured.size(), path);
+    return true;
+}
+
+uint64_t Profiler::GetDroppedCount() {
+    return GetBackend().TotalDropped.load(std::memory_order_relaxed);
+}
+
+double Profiler::TicksToMilliseconds(uint64_t ticks) {
+    return ticks * GetBackend().MsPerTick;
+}
+
+double Profiler::GetMillisecondsPerTick() {
+    return GetBackend().MsPerTick;
+}
+
+uint64_t Profiler::EnterZone() {
+    ++GetThreadBuffer().Depth;
+    return Now();
+}
+
+void Profiler::LeaveZone(const char* name, uint64_t begin) {
+    const uint64_t end = Now();
+    if (!IsEnabled()) return;
+
+    ThreadBuffer& buffer = GetThreadBuffer();
+    // Zones opened before a re-Init land in a fresh buffer at depth 0
+    if (buffer.Depth > 0) --buffer.Depth;
+
+    std::lock_guard<std::mutex> lock(buffer.Mutex);
+    if (buffer.Events.size() >= MaxEventsPerThread) {
+        ++buffer.Dropped;
+        return;
+    }
+    buffer.Events.push_back({ name, begin, end, buffer.Depth, buffer.ThreadId });
+}
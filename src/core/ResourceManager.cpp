@@ -1,4 +1,42 @@
 #include "core/ResourceManager.hpp"
+#include "graphics/AsyncTextureLoader.hpp"
+#include "graphics/Texture.hpp"
+#include <chrono>
 
-// Currently empty as all implementations are in the header
-// Will be expanded as we add specific resource types
+std::shared_future<std::shared_ptr<Texture>> ResourceManager::loadTextureAsync(const std::string& name, const std::string& path) {
+    // Already resident, or already on its way
+    if (Handle<Texture> handle = getHandle<Texture>(name); handle.IsValid()) {
+        std::promise<std::shared_ptr<Texture>> ready;
+        ready.set_value(resources<Texture>.GetShared(handle));
+        return ready.get_future().share();
+    }
+    for (const PendingTexture& pending : pendingTextures) {
+        if (pending.name == name) {
+            return pending.future;
+        }
+    }
+
+    auto future = AsyncTextureLoader::getInstance().Load(path);
+    pendingTextures.push_back({ name, future });
+    return future;
+}
+
+void ResourceManager::updateAsyncLoads() {
+    for (size_t i = 0; i < pendingTextures.size();) {
+        PendingTexture& pending = pendingTextures[i];
+        if (pending.future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            ++i;
+            continue;
+        }
+
+        if (std::shared_ptr<Texture> texture = pending.future.get()) {
+            addResource<Texture>(pending.name, std::move(texture));
+            Logger::Info("Successfully loaded resource: " + pending.name);
+        } else {
+            Logger::Error("Failed to load resource: " + pending.name);
+        }
+
+        pendingTextures[i] = std::move(pendingTextures.back());
+        pendingTextures.pop_back();
+    }
+}
@@ -0,0 +1,91 @@
+#include "core/ThreadPool.hpp"
+#include "core/Logger.hpp"
+
+ThreadPool::ThreadPool()
+    : m_ActiveTasks(0)
+    , m_StopRequested(false) {
+}
+
+ThreadPool::~ThreadPool() {
+    Shutdown();
+}
+
+bool ThreadPool::Init(size_t threadCount) {
+    if (IsRunning()) {
+        Logger::Warn("ThreadPool already initialized");
+        return true;
+    }
+
+    if (threadCount == 0) {
+        const unsigned int hardware = std::thread::hardware_concurrency();
+        threadCount = hardware > 1 ? hardware - 1 : 1;
+    }
+
+    m_StopRequested = false;
+    m_Workers.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i) {
+        m_Workers.emplace_back(&ThreadPool::WorkerMain, this);
+    }
+
+    LOG_INFO("Thread pool started with {} worker(s)", threadCount);
+    return true;
+}
+
+void ThreadPool::Shutdown() {
+    if (!IsRunning()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_StopRequested = true;
+    }
+    m_TaskAvailable.notify_all();
+
+    for (std::thread& worker : m_Workers) {
+        worker.join();
+    }
+    m_Workers.clear();
+}
+
+bool ThreadPool::Enqueue(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_Workers.empty() || m_StopRequested) {
+            return false;
+        }
+        m_Tasks.push_back(std::move(task));
+    }
+    m_TaskAvailable.notify_one();
+    return true;
+}
+
+void ThreadPool::WaitIdle() {
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_Idle.wait(lock, [this] { return m_Tasks.empty() && m_ActiveTasks == 0; });
+}
+
+void ThreadPool::WorkerMain() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_TaskAvailable.wait(lock, [this] { return m_StopRequested || !m_Tasks.empty(); });
+            if (m_Tasks.empty()) {
+                // Stop requested and nothing left to drain
+                return;
+            }
+            task = std::move(m_Tasks.front());
+            m_Tasks.pop_front();
+            ++m_ActiveTasks;
+        }
+
+        task();
+
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            --m_ActiveTasks;
+            if (m_Tasks.empty() && m_ActiveTasks == 0) {
+                m_Idle.notify_all();
+            }
+        }
+    }
+}
@@ -1,8 +1,20 @@
 #include "core/Window.hpp"
 #include "core/Logger.hpp"
 
+#ifdef PLATFORMER_WITH_EGL
+    // Keep X11's macros (None, Status, ...) out of this file
+    #define EGL_NO_X11
+    #include <EGL/egl.h>
+    #include <EGL/eglext.h>
+#endif
+
 Window::Window()
-    : m_Window(nullptr) {
+    : m_Window(nullptr)
+    , m_EglDisplay(nullptr)
+    , m_EglContext(nullptr)
+    , m_Framebuffer(0)
+    , m_ColorBuffer(0)
+    , m_DepthBuffer(0) {
 }
 
 Window::~Window() {
@@ -12,6 +24,18 @@ Window::~Window() {
 bool Window::Init(const Properties& props) {
     m_Properties = props;
     
+    switch (m_Properties.WindowMode) {
+        case Mode::None:
+            LOG_INFO("Running without a window or GL context");
+            return true;
+        case Mode::Surfaceless:
+            return InitSurfaceless();
+        default:
+            return InitGLFW();
+    }
+}
+
+bool Window::InitGLFW() {
     // Initialize GLFW
     if (!glfwInit()) {
         LOG_ERROR("Failed to initialize GLFW");
@@ -28,6 +52,7 @@ bool Window::Init(const Properties& props) {
     #ifdef __APPLE__
         glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
     #endif
+    glfwWindowHint(GLFW_VISIBLE, m_Properties.WindowMode == Mode::Hidden ? GLFW_FALSE : GLFW_TRUE);
     
     // Create window
     m_Window = glfwCreateWindow(
@@ -51,6 +76,7 @@ bool Window::Init(const Properties& props) {
     if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
         LOG_ERROR("Failed to initialize GLAD");
         glfwDestroyWindow(m_Window);
+        m_Window = nullptr;
         glfwTerminate();
         return false;
     }
@@ -62,16 +88,136 @@ bool Window::Init(const Properties& props) {
     return true;
 }
 
+#ifdef PLATFORMER_WITH_EGL
+
+bool Window::InitSurfaceless() {
+    // Prefer the Mesa surfaceless platform: no display server and, with llvmpipe, no GPU
+    EGLDisplay display = EGL_NO_DISPLAY;
+    auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+        eglGetProcAddress("eglGetPlatformDisplayEXT"));
+    if (getPlatformDisplay) {
+        display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+    }
+    if (display == EGL_NO_DISPLAY) {
+        display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    }
+    
+    EGLint major = 0;
+    EGLint minor = 0;
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor)) {
+        LOG_ERROR("Failed to initialize EGL");
+        return false;
+    }
+    m_EglDisplay = display;
+    
+    if (!eglBindAPI(EGL_OPENGL_API)) {
+        LOG_ERROR("EGL does not support desktop OpenGL");
+        Shutdown();
+        return false;
+    }
+    
+    const EGLint contextAttributes[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 4,
+        EGL_CONTEXT_MINOR_VERSION, 1,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+    // No config: the context only ever renders into our own framebuffer
+    EGLContext context = eglCreateContext(display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, contextAttributes);
+    if (context == EGL_NO_CONTEXT) {
+        LOG_ERROR("Failed to create EGL context (error {:X})", static_cast<unsigned int>(eglGetError()));
+        Shutdown();
+        return false;
+    }
+    m_EglContext = context;
+    
+    if (!eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context)) {
+        LOG_ERROR("Failed to make EGL context current");
+        Shutdown();
+        return false;
+    }
+    
+    if (!gladLoadGLLoader(reinterpret_cast<GLADloadproc>(eglGetProcAddress))) {
+        LOG_ERROR("Failed to initialize GLAD");
+        Shutdown();
+        return false;
+    }
+    
+    if (!CreateOffscreenFramebuffer()) {
+        Shutdown();
+        return false;
+    }
+    
+    LOG_INFO("Surfaceless EGL {}.{} context created: {}x{} offscreen ({})", major, minor,
+             m_Properties.Width, m_Properties.Height, reinterpret_cast<const char*>(glGetString(GL_RENDERER)));
+    return true;
+}
+
+#else
+
+bool Window::InitSurfaceless() {
+    LOG_ERROR("Surfaceless mode needs EGL, which this build was configured without");
+    return false;
+}
+
+#endif
+
+bool Window::CreateOffscreenFramebuffer() {
+    glGenRenderbuffers(1, &m_ColorBuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, m_ColorBuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, m_Properties.Width, m_Properties.Height);
+    
+    glGenRenderbuffers(1, &m_DepthBuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, m_DepthBuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, m_Properties.Width, m_Properties.Height);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    
+    // Stays bound for the context's lifetime and stands in for the default framebuffer
+    glGenFramebuffers(1, &m_Framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, m_Framebuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, m_ColorBuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, m_DepthBuffer);
+    
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        LOG_ERROR("Offscreen framebuffer is incomplete");
+        return false;
+    }
+    
+    glViewport(0, 0, m_Properties.Width, m_Properties.Height);
+    return true;
+}
+
 void Window::Shutdown() {
     if (m_Window) {
         glfwDestroyWindow(m_Window);
         m_Window = nullptr;
+        glfwTerminate();
+    }
+    
+#ifdef PLATFORMER_WITH_EGL
+    if (m_EglContext) {
+        // The framebuffer belongs to the context; make it current to free it
+        eglMakeCurrent(m_EglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, m_EglContext);
+        glDeleteFramebuffers(1, &m_Framebuffer);
+        glDeleteRenderbuffers(1, &m_ColorBuffer);
+        glDeleteRenderbuffers(1, &m_DepthBuffer);
+        m_Framebuffer = m_ColorBuffer = m_DepthBuffer = 0;
+        
+        eglMakeCurrent(m_EglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        eglDestroyContext(m_EglDisplay, m_EglContext);
+        m_EglContext = nullptr;
+    }
+    if (m_EglDisplay) {
+        eglTerminate(m_EglDisplay);
+        m_EglDisplay = nullptr;
     }
-    glfwTerminate();
+#endif
 }
 
 void Window::Update() {
-    glfwPollEvents();
+    if (m_Window) {
+        glfwPollEvents();
+    }
 }
 
 void Window::Clear(float r, float g, float b, float a) {
@@ -80,30 +226,71 @@ void Window::Clear(float r, float g, float b, float a) {
 }
 
 void Window::SwapBuffers() {
-    glfwSwapBuffers(m_Window);
+    if (m_Window) {
+        glfwSwapBuffers(m_Window);
+    } else if (m_EglContext) {
+        // Nothing to present; keep the driver from queueing frames without bound
+        glFlush();
+    }
+}
+
+void Window::MakeContextCurrent() {
+    if (m_Window) {
+        glfwMakeContextCurrent(m_Window);
+    }
+#ifdef PLATFORMER_WITH_EGL
+    if (m_EglContext) {
+        eglMakeCurrent(m_EglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, m_EglContext);
+    }
+#endif
+}
+
+void Window::DetachContext() {
+    if (m_Window && glfwGetCurrentContext() == m_Window) {
+        glfwMakeContextCurrent(nullptr);
+    }
+#ifdef PLATFORMER_WITH_EGL
+    if (m_EglContext && eglGetCurrentContext() == m_EglContext) {
+        eglMakeCurrent(m_EglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    }
+#endif
 }
 
 bool Window::ShouldClose() const {
-    return glfwWindowShouldClose(m_Window);
+    return m_Window && glfwWindowShouldClose(m_Window);
+}
+
+bool Window::ReadPixels(std::vector<uint8_t>& pixels) const {
+    if (!HasContext()) return false;
+    
+    pixels.resize(static_cast<size_t>(m_Properties.Width) * m_Properties.Height * 4);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, m_Properties.Width, m_Properties.Height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    return glGetError() == GL_NO_ERROR;
 }
 
 void Window::SetResizeCallback(GLFWwindowsizefun callback) {
+    if (!m_Window) return;
     glfwSetWindowSizeCallback(m_Window, callback);
 }
 
 void Window::SetKeyCallback(GLFWkeyfun callback) {
+    if (!m_Window) return;
     glfwSetKeyCallback(m_Window, callback);
 }
 
 void Window::SetMouseButtonCallback(GLFWmousebuttonfun callback) {
+    if (!m_Window) return;
     glfwSetMouseButtonCallback(m_Window, callback);
 }
 
 void Window::SetCursorPosCallback(GLFWcursorposfun callback) {
+    if (!m_Window) return;
     glfwSetCursorPosCallback(m_Window, callback);
 }
 
 void Window::SetScrollCallback(GLFWscrollfun callback) {
+    if (!m_Window) return;
     glfwSetScrollCallback(m_Window, callback);
 }
 
@@ -0,0 +1,121 @@
+#include "ecs/Archetype.hpp"
+#include "core/Logger.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace {
+
+size_t AlignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+uint8_t* AllocateChunk() {
+    return static_cast<uint8_t*>(::operator new(Archetype::ChunkSize, std::align_val_t(Archetype::ColumnAlignment)));
+}
+
+void FreeChunk(uint8_t* data) {
+    ::operator delete(data, std::align_val_t(Archetype::ColumnAlignment));
+}
+
+} // namespace
+
+Archetype::Archetype(ComponentMask mask)
+    : m_Mask(mask)
+    , m_ChunkCapacity(0)
+    , m_EntityCount(0) {
+    std::fill(std::begin(m_ColumnOf), std::end(m_ColumnOf), NoColumn);
+
+    size_t rowSize = sizeof(Entity);
+    for (ComponentId id = 0; id < ComponentRegistry::MaxComponentTypes; ++id) {
+        if (mask & (ComponentMask(1) << id)) {
+            const ComponentInfo& info = ComponentRegistry::GetInfo(id);
+            m_ColumnOf[id] = static_cast<int>(m_Columns.size());
+            m_Columns.push_back({ id, info.Size, 0 });
+            rowSize += info.Size;
+        }
+    }
+
+    // Start from the unpadded estimate and shrink until the padded layout fits
+    auto layout = [this](uint32_t capacity) {
+        size_t offset = sizeof(Entity) * capacity;
+        for (Column& column : m_Columns) {
+            const size_t alignment = std::max(ColumnAlignment, ComponentRegistry::GetInfo(column.Id).Alignment);
+            offset = AlignUp(offset, alignment);
+            column.Offset = offset;
+            offset += column.Size * capacity;
+        }
+        return offset;
+    };
+
+    uint32_t capacity = static_cast<uint32_t>(ChunkSize / rowSize);
+    while (capacity > 1 && layout(capacity) > ChunkSize) {
+        --capacity;
+    }
+
+    // Every component fits a chunk on its own, but several large ones in
+    // one signature may not. Append() would then write past the chunk, so
+    // such a signature is fatal in every build, not just under ASSERT.
+    const size_t used = layout(capacity);
+    if (capacity == 0 || used > ChunkSize) {
+        LOG_CRITICAL("Archetype row of {} bytes does not fit in a {} byte chunk", rowSize, ChunkSize);
+        std::abort();
+    }
+    m_ChunkCapacity = capacity;
+}
+
+Archetype::~Archetype() {
+    for (Chunk& chunk : m_Chunks) {
+        FreeChunk(chunk.Data);
+    }
+}
+
+void Archetype::Append(Entity entity, uint32_t& chunkIndex, uint32_t& row) {
+    if (m_Chunks.empty() || m_Chunks.back().Count == m_ChunkCapacity) {
+        m_Chunks.push_back({ AllocateChunk(), 0 });
+    }
+
+    Chunk& chunk = m_Chunks.back();
+    chunkIndex = static_cast<uint32_t>(m_Chunks.size() - 1);
+    row = chunk.Count++;
+    GetEntities(chunk)[row] = entity;
+    m_EntityCount++;
+}
+
+Entity Archetype::Remove(uint32_t chunkIndex, uint32_t row) {
+    Chunk& last = m_Chunks.back();
+    const uint32_t lastChunkIndex = static_cast<uint32_t>(m_Chunks.size() - 1);
+    const uint32_t lastRow = last.Count - 1;
+
+    Entity moved;
+    if (chunkIndex != lastChunkIndex || row != lastRow) {
+        Chunk& chunk = m_Chunks[chunkIndex];
+        for (const Column& column : m_Columns) {
+            std::memcpy(chunk.Data + column.Offset + column.Size * row,
+                        last.Data + column.Offset + column.Size * lastRow, column.Size);
+        }
+        moved = GetEntities(last)[lastRow];
+        GetEntities(chunk)[row] = moved;
+    }
+
+    if (--last.Count == 0) {
+        FreeChunk(last.Data);
+        m_Chunks.pop_back();
+    }
+    m_EntityCount--;
+    return moved;
+}
+
+void Archetype::CopyShared(const Archetype& from, uint32_t fromChunk, uint32_t fromRow,
+                           Archetype& to, uint32_t toChunk, uint32_t toRow) {
+    const Chunk& source = from.m_Chunks[fromChunk];
+    Chunk& destination = to.m_Chunks[toChunk];
+    for (const Column& column : from.m_Columns) {
+        const int target = to.FindColumn(column.Id);
+        if (target == NoColumn) continue;
+
+        std::memcpy(destination.Data + to.m_Columns[target].Offset + column.Size * toRow,
+                    source.Data + column.Offset + column.Size * fromRow, column.Size);
+    }
+}
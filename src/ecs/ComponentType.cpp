@@ -0,0 +1,38 @@
+#include "ecs/ComponentType.hpp"
+#include "utils/Debug.hpp"
+#include <mutex>
+
+namespace {
+
+struct RegistryState {
+    std::mutex Mutex;
+    ComponentInfo Infos[ComponentRegistry::MaxComponentTypes];
+    size_t Count = 0;
+};
+
+RegistryState& GetState() {
+    static RegistryState state;
+    return state;
+}
+
+} // namespace
+
+ComponentId ComponentRegistry::Register(size_t size, size_t alignment) {
+    RegistryState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.Mutex);
+    ASSERT(state.Count < MaxComponentTypes, "Too many component types");
+
+    state.Infos[state.Count] = { size, alignment };
+    return static_cast<ComponentId>(state.Count++);
+}
+
+const ComponentInfo& ComponentRegistry::GetInfo(ComponentId id) {
+    // Entries are written once, before their ID is handed out
+    return GetState().Infos[id];
+}
+
+size_t ComponentRegistry::GetCount() {
+    RegistryState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.Mutex);
+    return state.Count;
+}
@@ -0,0 +1,154 @@
+#include "ecs/World.hpp"
+
+World::World()
+    : m_EntityCount(0) {
+    // Entities without components live in the empty archetype
+    GetOrCreateArchetype(0);
+}
+
+World::~World() = default;
+
+Entity World::CreateEntity() {
+    return AllocateEntity(GetOrCreateArchetype(0));
+}
+
+Entity World::AllocateEntity(Archetype* archetype) {
+    uint32_t index;
+    if (!m_FreeList.empty()) {
+        index = m_FreeList.back();
+        m_FreeList.pop_back();
+    } else {
+        index = static_cast<uint32_t>(m_Records.size());
+        m_Records.emplace_back();
+    }
+
+    EntityRecord& record = m_Records[index];
+    const Entity entity{ index, record.Generation };
+    record.Arch = archetype;
+    archetype->Append(entity, record.Chunk, record.Row);
+    m_EntityCount++;
+    return entity;
+}
+
+void World::DestroyEntity(Entity entity) {
+    if (!IsAlive(entity)) return;
+
+    EntityRecord& record = m_Records[entity.Index];
+    const Entity moved = record.Arch->Remove(record.Chunk, record.Row);
+    if (moved.IsValid()) {
+        m_Records[moved.Index].Chunk = record.Chunk;
+        m_Records[moved.Index].Row = record.Row;
+    }
+
+    record.Arch = nullptr;
+    // Skip 0 on wrap-around so the slot never looks unused
+    if (++record.Generation == 0) {
+        record.Generation = 1;
+    }
+    m_FreeList.push_back(entity.Index);
+    m_EntityCount--;
+}
+
+bool World::IsAlive(Entity entity) const {
+    return entity.Index < m_Records.size()
+        && m_Records[entity.Index].Generation == entity.Generation
+        && m_Records[entity.Index].Arch != nullptr;
+}
+
+void World::MoveEntity(Entity entity, Archetype* target) {
+    EntityRecord& record = m_Records[entity.Index];
+    Archetype* source = record.Arch;
+
+    uint32_t chunk;
+    uint32_t row;
+    target->Append(entity, chunk, row);
+    Archetype::CopyShared(*source, record.Chunk, record.Row, *target, chunk, row);
+
+    const Entity moved = source->Remove(record.Chunk, record.Row);
+    if (moved.IsValid()) {
+        m_Records[moved.Index].Chunk = record.Chunk;
+        m_Records[moved.Index].Row = record.Row;
+    }
+
+    record.Arch = target;
+    record.Chunk = chunk;
+    record.Row = row;
+}
+
+bool World::HasComponent(Entity entity, ComponentId id) const {
+    return IsAlive(entity) && (m_Records[entity.Index].Arch->GetMask() & (ComponentMask(1) << id)) != 0;
+}
+
+void* World::GetComponentData(Entity entity, ComponentId id) const {
+    if (!IsAlive(entity)) return nullptr;
+
+    const EntityRecord& record = m_Records[entity.Index];
+    const int column = record.Arch->FindColumn(id);
+    if (column == Archetype::NoColumn) return nullptr;
+
+    const ComponentInfo& info = ComponentRegistry::GetInfo(id);
+    return static_cast<uint8_t*>(record.Arch->GetColumn(record.Arch->GetChunk(record.Chunk), column))
+        + info.Size * record.Row;
+}
+
+Archetype* World::GetOrCreateArchetype(ComponentMask mask) {
+    auto it = m_ArchetypeByMask.find(mask);
+    if (it != m_ArchetypeByMask.end()) {
+        return it->second;
+    }
+
+    m_Archetypes.push_back(std::make_unique<Archetype>(mask));
+    Archetype* archetype = m_Archetypes.back().get();
+    m_ArchetypeByMask.emplace(mask, archetype);
+
+    // Keep every cached query complete
+    for (const auto& query : m_Queries) {
+        if (query->Matches(mask)) {
+            query->Archetypes.push_back(archetype);
+        }
+    }
+    return archetype;
+}
+
+Archetype* World::GetAddTarget(Archetype* archetype, ComponentId id) {
+    auto it = archetype->AddEdges.find(id);
+    if (it != archetype->AddEdges.end()) {
+        return it->second;
+    }
+
+    Archetype* target = GetOrCreateArchetype(archetype->GetMask() | (ComponentMask(1) << id));
+    archetype->AddEdges.emplace(id, target);
+    target->RemoveEdges.emplace(id, archetype);
+    return target;
+}
+
+Archetype* World::GetRemoveTarget(Archetype* archetype, ComponentId id) {
+    auto it = archetype->RemoveEdges.find(id);
+    if (it != archetype->RemoveEdges.end()) {
+        return it->second;
+    }
+
+    Archetype* target = GetOrCreateArchetype(archetype->GetMask() & ~(ComponentMask(1) << id));
+    archetype->RemoveEdges.emplace(id, target);
+    target->AddEdges.emplace(id, archetype);
+    return target;
+}
+
+const QueryCache* World::FindOrCreateQuery(ComponentMask include, ComponentMask exclude) {
+    for (const auto& query : m_Queries) {
+        if (query->Include == include && query->Exclude == exclude) {
+            return query.get();
+        }
+    }
+
+    auto query = std::make_unique<QueryCache>();
+    query->Include = include;
+    query->Exclude = exclude;
+    for (const auto& archetype : m_Archetypes) {
+        if (query->Matches(archetype->GetMask())) {
+            query->Archetypes.push_back(archetype.get());
+        }
+    }
+    m_Queries.push_back(std::move(query));
+    return m_Queries.back().get();
+}
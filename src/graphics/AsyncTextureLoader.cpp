@@ -0,0 +1,182 @@
+#include "graphics/AsyncTextureLoader.hpp"
+#include "core/Logger.hpp"
+#include <glad/glad.h>
+#include <stb_image.h>
+#include <chrono>
+#include <cstring>
+
+AsyncTextureLoader::AsyncTextureLoader()
+    : m_MaxPendingUploads(DefaultMaxPendingUploads)
+    , m_StopRequested(false)
+    , m_UsePixelBuffers(true)
+    , m_PixelBuffers{}
+    , m_NextPixelBuffer(0) {
+}
+
+AsyncTextureLoader::~AsyncTextureLoader() {
+    Shutdown();
+}
+
+bool AsyncTextureLoader::Init(size_t workerCount, size_t maxPendingUploads, bool usePixelBuffers) {
+    if (IsRunning()) {
+        Logger::Warn("AsyncTextureLoader already initialized");
+        return true;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_MaxPendingUploads = maxPendingUploads > 0 ? maxPendingUploads : 1;
+        m_StopRequested = false;
+    }
+    m_UsePixelBuffers = usePixelBuffers;
+
+    return m_Pool.Init(workerCount);
+}
+
+void AsyncTextureLoader::Shutdown() {
+    if (!IsRunning()) return;
+
+    // Wake decoders waiting for queue space; queued decodes bail out early
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_StopRequested = true;
+    }
+    m_SpaceAvailable.notify_all();
+    m_Pool.Shutdown();
+
+    std::deque<DecodedImage> abandoned;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        abandoned.swap(m_Uploads);
+    }
+    for (DecodedImage& image : abandoned) {
+        stbi_image_free(image.Pixels);
+        image.Promise->set_value(nullptr);
+    }
+}
+
+AsyncTextureLoader::TextureFuture AsyncTextureLoader::Load(const std::string& path) {
+    auto promise = std::make_shared<std::promise<std::shared_ptr<Texture>>>();
+    TextureFuture future = promise->get_future().share();
+    auto texture = std::make_shared<Texture>();
+
+    if (!m_Pool.Enqueue([this, texture, promise, path] { Decode(texture, promise, path); })) {
+        Logger::Error("AsyncTextureLoader is not running, cannot load: " + path);
+        promise->set_value(nullptr);
+    }
+    return future;
+}
+
+void AsyncTextureLoader::Decode(std::shared_ptr<Texture> target,
+                                std::shared_ptr<std::promise<std::shared_ptr<Texture>>> promise,
+                                const std::string& path) {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_StopRequested) {
+            promise->set_value(nullptr);
+            return;
+        }
+    }
+
+    // The global flip flag is not safe to touch from several threads
+    stbi_set_flip_vertically_on_load_thread(true);
+
+    DecodedImage image;
+    int channels = 0;
+    image.Pixels = stbi_load(path.c_str(), &image.Width, &image.Height, &channels, 4);
+    if (!image.Pixels) {
+        Logger::Error("Failed to load texture: " + path);
+        promise->set_value(nullptr);
+        return;
+    }
+    image.Target = std::move(target);
+    image.Promise = std::move(promise);
+    image.Path = path;
+
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_SpaceAvailable.wait(lock, [this] { return m_StopRequested || m_Uploads.size() < m_MaxPendingUploads; });
+    if (m_StopRequested) {
+        lock.unlock();
+        stbi_image_free(image.Pixels);
+        image.Promise->set_value(nullptr);
+        return;
+    }
+    m_Uploads.push_back(std::move(image));
+}
+
+size_t AsyncTextureLoader::ProcessUploads(double budgetMs) {
+    const auto start = std::chrono::steady_clock::now();
+    size_t uploaded = 0;
+
+    while (true) {
+        DecodedImage image;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (m_Uploads.empty()) break;
+            image = std::move(m_Uploads.front());
+            m_Uploads.pop_front();
+        }
+        m_SpaceAvailable.notify_one();
+
+        const bool resident = Upload(image);
+        stbi_image_free(image.Pixels);
+
+        if (resident) {
+            LOG_INFO("Successfully loaded texture: {}", image.Path);
+        } else {
+            Logger::Error("Failed to upload texture: " + image.Path);
+        }
+        image.Promise->set_value(resident ? image.Target : nullptr);
+        ++uploaded;
+
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        if (elapsed.count() >= budgetMs) break;
+    }
+
+    return uploaded;
+}
+
+bool AsyncTextureLoader::Upload(const DecodedImage& image) {
+    if (!m_UsePixelBuffers) {
+        return image.Target->LoadFromMemory(image.Pixels, image.Width, image.Height, 4);
+    }
+
+    if (m_PixelBuffers[0] == 0) {
+        glGenBuffers(PixelBufferCount, m_PixelBuffers);
+    }
+
+    // Rotate and orphan the staging buffers so a copy still in flight is never overwritten
+    const GLsizeiptr size = static_cast<GLsizeiptr>(image.Width) * image.Height * 4;
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_PixelBuffers[m_NextPixelBuffer]);
+    m_NextPixelBuffer = (m_NextPixelBuffer + 1) % PixelBufferCount;
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW);
+
+    bool uploaded = false;
+    void* staging = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+    if (staging) {
+        std::memcpy(staging, image.Pixels, static_cast<size_t>(size));
+        if (glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_TRUE) {
+            uploaded = image.Target->LoadFromPixelBuffer(0, image.Width, image.Height, 4);
+        }
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    // Mapping can fail (e.g. the buffer was lost); fall back to a direct upload
+    if (!uploaded) {
+        uploaded = image.Target->LoadFromMemory(image.Pixels, image.Width, image.Height, 4);
+    }
+    return uploaded;
+}
+
+void AsyncTextureLoader::ReleaseGLResources() {
+    if (m_PixelBuffers[0] != 0) {
+        glDeleteBuffers(PixelBufferCount, m_PixelBuffers);
+        std::memset(m_PixelBuffers, 0, sizeof(m_PixelBuffers));
+    }
+    m_NextPixelBuffer = 0;
+}
+
+size_t AsyncTextureLoader::GetPendingUploadCount() {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Uploads.size();
+}
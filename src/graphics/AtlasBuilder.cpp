@@ -0,0 +1,142 @@
+#include "graphics/AtlasBuilder.hpp"
+#include "graphics/AtlasFormat.hpp"
+#include "core/Logger.hpp"
+#include "utils/Hash.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+
+AtlasBuilder::AtlasBuilder(int pageSize, int padding)
+    : m_PageSize(pageSize), m_Padding(padding) {
+}
+
+bool AtlasBuilder::Build(const std::vector<Image>& images) {
+    m_Pages.clear();
+    m_Regions.clear();
+
+    // Tallest first keeps the skyline flat
+    std::vector<size_t> order(images.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&images](size_t a, size_t b) {
+        if (images[a].Height != images[b].Height) return images[a].Height > images[b].Height;
+        return images[a].Width > images[b].Width;
+    });
+
+    std::vector<SkylinePacker> packers;
+    m_Regions.reserve(images.size());
+
+    for (size_t index : order) {
+        const Image& image = images[index];
+        if (image.Width > m_PageSize || image.Height > m_PageSize || !image.Pixels) {
+            LOG_ERROR("Atlas image '{}' ({}x{}) does not fit a {}x{} page", image.Name,
+                      image.Width, image.Height, m_PageSize, m_PageSize);
+            return false;
+        }
+
+        Region region;
+        region.Name = image.Name;
+
+        bool placed = false;
+        for (size_t page = 0; page < packers.size() && !placed; ++page) {
+            if (packers[page].Pack(image.Width, image.Height, region.Rect)) {
+                region.Page = static_cast<uint32_t>(page);
+                placed = true;
+            }
+        }
+
+        if (!placed) {
+            packers.emplace_back(m_PageSize, m_PageSize, m_Padding);
+            Page page;
+            page.Width = m_PageSize;
+            page.Height = m_PageSize;
+            page.Pixels.assign(static_cast<size_t>(m_PageSize) * m_PageSize * 4, 0);
+            m_Pages.push_back(std::move(page));
+
+            packers.back().Pack(image.Width, image.Height, region.Rect);
+            region.Page = static_cast<uint32_t>(packers.size() - 1);
+        }
+
+        // Blit row by row into the page
+        Page& page = m_Pages[region.Page];
+        const size_t rowBytes = static_cast<size_t>(image.Width) * 4;
+        for (int row = 0; row < image.Height; ++row) {
+            unsigned char* dst = &page.Pixels[(static_cast<size_t>(region.Rect.Y + row) * page.Width + region.Rect.X) * 4];
+            const unsigned char* src = image.Pixels + static_cast<size_t>(row) * rowBytes;
+            std::memcpy(dst, src, rowBytes);
+        }
+
+        m_Regions.push_back(std::move(region));
+    }
+
+    LOG_INFO("Packed {} images into {} atlas page(s)", images.size(), m_Pages.size());
+    return true;
+}
+
+bool AtlasBuilder::WriteIndex(const std::string& path, const std::vector<std::string>& pagePaths) const {
+    if (pagePaths.size() != m_Pages.size()) {
+        LOG_ERROR("Atlas index needs one path per page ({} given, {} pages)", pagePaths.size(), m_Pages.size());
+        return false;
+    }
+
+    std::vector<char> strings;
+    auto addString = [&strings](const std::string& str) {
+        const auto offset = static_cast<uint32_t>(strings.size());
+        strings.insert(strings.end(), str.begin(), str.end());
+        strings.push_back('\0');
+        return offset;
+    };
+
+    std::vector<AtlasPageEntry> pages;
+    for (size_t i = 0; i < m_Pages.size(); ++i) {
+        pages.push_back({ addString(pagePaths[i]),
+                          static_cast<uint32_t>(m_Pages[i].Width),
+                          static_cast<uint32_t>(m_Pages[i].Height) });
+    }
+
+    std::vector<AtlasRegionEntry> regions;
+    for (const Region& region : m_Regions) {
+        const Page& page = m_Pages[region.Page];
+        AtlasRegionEntry entry;
+        entry.NameHash = HashString(region.Name);
+        entry.NameOffset = addString(region.Name);
+        entry.Page = region.Page;
+        entry.U0 = static_cast<float>(region.Rect.X) / page.Width;
+        entry.V0 = static_cast<float>(region.Rect.Y) / page.Height;
+        entry.U1 = static_cast<float>(region.Rect.X + region.Rect.Width) / page.Width;
+        entry.V1 = static_cast<float>(region.Rect.Y + region.Rect.Height) / page.Height;
+        entry.Width = static_cast<uint32_t>(region.Rect.Width);
+        entry.Height = static_cast<uint32_t>(region.Rect.Height);
+        regions.push_back(entry);
+    }
+    std::sort(regions.begin(), regions.end(), [](const AtlasRegionEntry& a, const AtlasRegionEntry& b) {
+        return a.NameHash < b.NameHash;
+    });
+
+    auto align8 = [](size_t value) { return (value + 7) & ~static_cast<size_t>(7); };
+
+    AtlasFileHeader header;
+    std::memcpy(header.Magic, AtlasFormat::Magic, sizeof(header.Magic));
+    header.Version = AtlasFormat::Version;
+    header.PageCount = static_cast<uint32_t>(pages.size());
+    header.RegionCount = static_cast<uint32_t>(regions.size());
+    header.PageTableOffset = sizeof(AtlasFileHeader);
+    header.RegionTableOffset = static_cast<uint32_t>(align8(header.PageTableOffset + pages.size() * sizeof(AtlasPageEntry)));
+    header.StringTableOffset = static_cast<uint32_t>(header.RegionTableOffset + regions.size() * sizeof(AtlasRegionEntry));
+    header.StringTableSize = static_cast<uint32_t>(strings.size());
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        LOG_ERROR("Failed to open atlas index for writing: {}", path);
+        return false;
+    }
+
+    const char zeros[8] = {};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(pages.data()), static_cast<std::streamsize>(pages.size() * sizeof(AtlasPageEntry)));
+    file.write(zeros, static_cast<std::streamsize>(header.RegionTableOffset - (header.PageTableOffset + pages.size() * sizeof(AtlasPageEntry))));
+    file.write(reinterpret_cast<const char*>(regions.data()), static_cast<std::streamsize>(regions.size() * sizeof(AtlasRegionEntry)));
+    file.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+
+    return static_cast<bool>(file);
+}
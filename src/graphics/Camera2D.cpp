@@ -0,0 +1,158 @@
+#include "graphics/Camera2D.hpp"
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+
+Camera2D::Camera2D()
+    : Camera2D(1.0f, 1.0f) {
+}
+
+Camera2D::Camera2D(float viewportWidth, float viewportHeight)
+    : m_ViewportSize(std::max(viewportWidth, 1.0f), std::max(viewportHeight, 1.0f))
+    , m_Position(0.0f)
+    , m_Zoom(1.0f)
+    , m_PixelSnap(false)
+    , m_Deadzone(0.0f)
+    , m_FollowSpeed(0.0f)
+    , m_View(1.0f)
+    , m_Projection(1.0f)
+    , m_ViewProjection(1.0f)
+    , m_ViewDirty(true)
+    , m_ProjectionDirty(true)
+    , m_ViewProjectionDirty(true)
+    , m_BoundsDirty(true) {
+}
+
+void Camera2D::SetViewportSize(float width, float height) {
+    const glm::vec2 size(std::max(width, 1.0f), std::max(height, 1.0f));
+    if (size == m_ViewportSize) return;
+
+    m_ViewportSize = size;
+    m_ProjectionDirty = true;
+    m_ViewProjectionDirty = true;
+    m_BoundsDirty = true;
+}
+
+void Camera2D::SetPosition(const glm::vec2& position) {
+    if (position == m_Position) return;
+
+    m_Position = position;
+    m_ViewDirty = true;
+    m_ViewProjectionDirty = true;
+    m_BoundsDirty = true;
+}
+
+glm::vec2 Camera2D::GetRenderPosition() const {
+    if (!m_PixelSnap) return m_Position;
+    return glm::round(m_Position * m_Zoom) / m_Zoom;
+}
+
+void Camera2D::SetZoom(float zoom) {
+    if (zoom <= 0.0f || zoom == m_Zoom) return;
+
+    m_Zoom = zoom;
+    m_ViewDirty = true;
+    m_ViewProjectionDirty = true;
+    m_BoundsDirty = true;
+}
+
+void Camera2D::SetPixelSnap(bool enabled) {
+    if (enabled == m_PixelSnap) return;
+
+    m_PixelSnap = enabled;
+    m_ViewDirty = true;
+    m_ViewProjectionDirty = true;
+    m_BoundsDirty = true;
+}
+
+void Camera2D::Follow(const glm::vec2& target, float deltaTime) {
+    // Nearest center that has the target inside the deadzone
+    glm::vec2 goal = m_Position;
+    for (int axis = 0; axis < 2; ++axis) {
+        const float offset = target[axis] - m_Position[axis];
+        if (offset > m_Deadzone[axis]) {
+            goal[axis] = target[axis] - m_Deadzone[axis];
+        } else if (offset < -m_Deadzone[axis]) {
+            goal[axis] = target[axis] + m_Deadzone[axis];
+        }
+    }
+
+    if (m_FollowSpeed <= 0.0f) {
+        SetPosition(goal);
+        return;
+    }
+
+    // Frame-rate independent easing: the same fraction of the gap closes
+    // per second however the time is sliced
+    const float t = 1.0f - std::exp(-m_FollowSpeed * std::max(deltaTime, 0.0f));
+    SetPosition(m_Position + (goal - m_Position) * t);
+}
+
+glm::vec4 Camera2D::GetPixelExtents() const {
+    const float left = -std::floor(m_ViewportSize.x * 0.5f);
+    const float bottom = -std::floor(m_ViewportSize.y * 0.5f);
+    return glm::vec4(left, bottom, left + m_ViewportSize.x, bottom + m_ViewportSize.y);
+}
+
+const glm::mat4& Camera2D::GetViewMatrix() const {
+    if (m_ViewDirty) {
+        // World units to pixels around the view center
+        const glm::vec2 position = GetRenderPosition();
+        m_View = glm::scale(glm::mat4(1.0f), glm::vec3(m_Zoom, m_Zoom, 1.0f));
+        m_View = glm::translate(m_View, glm::vec3(-position.x, -position.y, 0.0f));
+        m_ViewDirty = false;
+    }
+    return m_View;
+}
+
+const glm::mat4& Camera2D::GetProjectionMatrix() const {
+    if (m_ProjectionDirty) {
+        const glm::vec4 extents = GetPixelExtents();
+        m_Projection = glm::ortho(extents.x, extents.z, extents.y, extents.w, -1.0f, 1.0f);
+        m_ProjectionDirty = false;
+    }
+    return m_Projection;
+}
+
+const glm::mat4& Camera2D::GetViewProjectionMatrix() const {
+    if (m_ViewProjectionDirty) {
+        m_ViewProjection = GetProjectionMatrix() * GetViewMatrix();
+        m_ViewProjectionDirty = false;
+    }
+    return m_ViewProjection;
+}
+
+const AABB& Camera2D::GetViewBounds() const {
+    if (m_BoundsDirty) {
+        const glm::vec2 position = GetRenderPosition();
+        const glm::vec4 extents = GetPixelExtents();
+        m_ViewBounds.Min = position + glm::vec2(extents.x, extents.y) / m_Zoom;
+        m_ViewBounds.Max = position + glm::vec2(extents.z, extents.w) / m_Zoom;
+        m_BoundsDirty = false;
+    }
+    return m_ViewBounds;
+}
+
+glm::vec2 Camera2D::ScreenToWorld(const glm::vec2& screen) const {
+    const glm::vec4 extents = GetPixelExtents();
+    const glm::vec2 pixel(extents.x + screen.x, extents.w - screen.y);
+    return GetRenderPosition() + pixel / m_Zoom;
+}
+
+glm::vec2 Camera2D::WorldToScreen(const glm::vec2& world) const {
+    const glm::vec4 extents = GetPixelExtents();
+    const glm::vec2 pixel = (world - GetRenderPosition()) * m_Zoom;
+    return glm::vec2(pixel.x - extents.x, extents.w - pixel.y);
+}
+
+size_t Camera2D::Cull(const float* minX, const float* minY, const float* maxX, const float* maxY,
+                      size_t count, uint32_t* mask) const {
+    PhysicsKernels::OverlapMask(GetViewBounds(), minX, minY, maxX, maxY, count, mask);
+
+    size_t visible = 0;
+    for (size_t word = 0; word < GetMaskWordCount(count); ++word) {
+        visible += std::bitset<32>(mask[word]).count();
+    }
+    return visible;
+}
@@ -0,0 +1,98 @@
+#include "graphics/GLStateCache.hpp"
+#include "utils/Debug.hpp"
+#include <glad/glad.h>
+
+GLStateCache::GLStateCache() {
+    Invalidate();
+}
+
+bool GLStateCache::Changed(unsigned int& current, unsigned int value) {
+    if (current == value) {
+        m_Stats.Skipped++;
+        return false;
+    }
+    current = value;
+    m_Stats.Issued++;
+    return true;
+}
+
+void GLStateCache::UseProgram(unsigned int program) {
+    if (Changed(m_Program, program)) {
+        glUseProgram(program);
+    }
+}
+
+void GLStateCache::BindVertexArray(unsigned int vao) {
+    if (Changed(m_VertexArray, vao)) {
+        glBindVertexArray(vao);
+    }
+}
+
+void GLStateCache::BindTexture(unsigned int slot, unsigned int texture) {
+    ASSERT(slot < MaxTextureSlots, "Texture slot out of range");
+    if (m_Textures[slot] == texture) {
+        m_Stats.Skipped++;
+        return;
+    }
+
+    // Only switch the active unit when a bind actually has to happen
+    if (m_ActiveSlot != slot) {
+        glActiveTexture(GL_TEXTURE0 + slot);
+        m_ActiveSlot = slot;
+    }
+    glBindTexture(GL_TEXTURE_2D, texture);
+    m_Textures[slot] = texture;
+    m_Stats.Issued++;
+}
+
+void GLStateCache::SetBlend(bool enabled) {
+    if (Changed(m_BlendEnabled, enabled ? 1u : 0u)) {
+        if (enabled) {
+            glEnable(GL_BLEND);
+        } else {
+            glDisable(GL_BLEND);
+        }
+    }
+}
+
+void GLStateCache::SetBlendFunc(unsigned int srcFactor, unsigned int dstFactor) {
+    if (m_BlendSrc == srcFactor && m_BlendDst == dstFactor) {
+        m_Stats.Skipped++;
+        return;
+    }
+    glBlendFunc(srcFactor, dstFactor);
+    m_BlendSrc = srcFactor;
+    m_BlendDst = dstFactor;
+    m_Stats.Issued++;
+}
+
+void GLStateCache::OnProgramDeleted(unsigned int program) {
+    // A deleted program stays in use until another one is bound
+    if (m_Program == program) {
+        m_Program = Unknown;
+    }
+}
+
+void GLStateCache::OnVertexArrayDeleted(unsigned int vao) {
+    if (m_VertexArray == vao) {
+        m_VertexArray = 0;
+    }
+}
+
+void GLStateCache::OnTextureDeleted(unsigned int texture) {
+    for (auto& bound : m_Textures) {
+        if (bound == texture) {
+            bound = 0;
+        }
+    }
+}
+
+void GLStateCache::Invalidate() {
+    m_Program = Unknown;
+    m_VertexArray = Unknown;
+    m_ActiveSlot = Unknown;
+    m_Textures.fill(Unknown);
+    m_BlendEnabled = Unknown;
+    m_BlendSrc = Unknown;
+    m_BlendDst = Unknown;
+}
@@ -0,0 +1,168 @@
+#include "graphics/GpuProfiler.hpp"
+#include "core/Logger.hpp"
+#include <glad/glad.h>
+#include <algorithm>
+
+namespace {
+
+constexpr uint32_t NoTrack = ~0u;
+constexpr uint32_t SkippedZone = ~0u;
+
+} // namespace
+
+GpuProfiler::GpuProfiler()
+    : m_FrameIndex(0)
+    , m_TrackId(NoTrack)
+    , m_Enabled(false)
+    , m_InFrame(false)
+    , m_LastFrameTimeMs(0.0)
+    , m_ResolvedFrames(0)
+    , m_SkippedFrames(0) {
+}
+
+void GpuProfiler::Init() {
+    if (m_Enabled) return;
+
+    GLint counterBits = 0;
+    glGetQueryiv(GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &counterBits);
+    if (counterBits == 0) {
+        Logger::Warn("GL timestamp queries unavailable; GPU zones disabled");
+        return;
+    }
+
+    // Tracks outlive Profiler re-initialization, so register only once
+    if (m_TrackId == NoTrack) {
+        m_TrackId = Profiler::RegisterTrack("GPU");
+    }
+
+    m_FrameIndex = 0;
+    m_LastFrameTimeMs = 0.0;
+    m_ResolvedFrames = 0;
+    m_SkippedFrames = 0;
+    m_Results.reserve(MaxZonesPerFrame * 2);
+    m_Enabled = true;
+    LOG_INFO("GPU profiler initialized ({}-bit timestamps)", counterBits);
+}
+
+void GpuProfiler::Shutdown() {
+    if (!m_Enabled) return;
+
+    for (FrameQueries& frame : m_Frames) {
+        if (!frame.Queries.empty()) {
+            glDeleteQueries(static_cast<GLsizei>(frame.Queries.size()), frame.Queries.data());
+        }
+        frame = FrameQueries();
+    }
+    m_OpenZones.clear();
+    m_InFrame = false;
+    m_Enabled = false;
+}
+
+void GpuProfiler::BeginFrame() {
+    if (!m_Enabled) return;
+
+    m_FrameIndex = (m_FrameIndex + 1) % FrameLatency;
+    FrameQueries& frame = m_Frames[m_FrameIndex];
+    if (frame.Pending) {
+        Resolve(frame);
+    }
+
+    frame.Zones.clear();
+    frame.QueryCount = 0;
+
+    // GL_TIMESTAMP as a state query returns once earlier commands reach the
+    // GPU, without waiting for them to finish
+    GLint64 gpuTime = 0;
+    glGetInteger64v(GL_TIMESTAMP, &gpuTime);
+    frame.CpuTicks = Profiler::Now();
+    frame.GpuTime = gpuTime;
+
+    m_OpenZones.clear();
+    m_InFrame = true;
+}
+
+void GpuProfiler::EndFrame() {
+    if (!m_InFrame) return;
+
+    while (!m_OpenZones.empty()) {
+        EndZone();
+    }
+
+    FrameQueries& frame = m_Frames[m_FrameIndex];
+    frame.Pending = frame.QueryCount > 0;
+    m_InFrame = false;
+}
+
+void GpuProfiler::BeginZone(const char* name) {
+    if (!m_InFrame) return;
+
+    FrameQueries& frame = m_Frames[m_FrameIndex];
+    if (frame.Zones.size() >= MaxZonesPerFrame) {
+        // Still pushed so the matching EndZone() pops the right entry
+        m_OpenZones.push_back(SkippedZone);
+        return;
+    }
+
+    const auto depth = static_cast<uint32_t>(m_OpenZones.size());
+    m_OpenZones.push_back(static_cast<uint32_t>(frame.Zones.size()));
+    frame.Zones.push_back({ name, IssueTimestamp(frame), 0, depth });
+}
+
+void GpuProfiler::EndZone() {
+    if (!m_InFrame || m_OpenZones.empty()) return;
+
+    const uint32_t zone = m_OpenZones.back();
+    m_OpenZones.pop_back();
+    if (zone == SkippedZone) return;
+
+    FrameQueries& frame = m_Frames[m_FrameIndex];
+    frame.Zones[zone].EndQuery = IssueTimestamp(frame);
+}
+
+uint32_t GpuProfiler::IssueTimestamp(FrameQueries& frame) {
+    if (frame.QueryCount == frame.Queries.size()) {
+        GLuint query = 0;
+        glGenQueries(1, &query);
+        frame.Queries.push_back(query);
+    }
+
+    const uint32_t index = frame.QueryCount++;
+    glQueryCounter(frame.Queries[index], GL_TIMESTAMP);
+    return index;
+}
+
+void GpuProfiler::Resolve(FrameQueries& frame) {
+    frame.Pending = false;
+
+    // Queries complete in submission order, so the last one decides
+    GLint available = 0;
+    glGetQueryObjectiv(frame.Queries[frame.QueryCount - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available) {
+        m_SkippedFrames++;
+        return;
+    }
+
+    m_Results.resize(frame.QueryCount);
+    for (uint32_t i = 0; i < frame.QueryCount; ++i) {
+        GLuint64 result = 0;
+        glGetQueryObjectui64v(frame.Queries[i], GL_QUERY_RESULT, &result);
+        m_Results[i] = result;
+    }
+
+    // Map GPU nanoseconds onto profiler ticks through the frame's calibration pair
+    const double ticksPerNs = 1e-6 / Profiler::GetMillisecondsPerTick();
+    auto toTicks = [&](uint64_t gpuTime) {
+        const double offset = (static_cast<double>(gpuTime) - static_cast<double>(frame.GpuTime)) * ticksPerNs;
+        return static_cast<uint64_t>(std::max(0.0, static_cast<double>(frame.CpuTicks) + offset));
+    };
+
+    for (const Zone& zone : frame.Zones) {
+        const uint64_t begin = m_Results[zone.BeginQuery];
+        const uint64_t end = std::max(begin, m_Results[zone.EndQuery]);
+        Profiler::RecordEvent({ zone.Name, toTicks(begin), toTicks(end), zone.Depth, m_TrackId });
+    }
+
+    const auto [first, last] = std::minmax_element(m_Results.begin(), m_Results.end());
+    m_LastFrameTimeMs = static_cast<double>(*last - *first) * 1e-6;
+    m_ResolvedFrames++;
+}
@@ -0,0 +1,144 @@
+#include "graphics/InstancedQuadRenderer.hpp"
+#include "graphics/GLStateCache.hpp"
+#include "core/Logger.hpp"
+#include <glad/glad.h>
+
+namespace {
+    // Per-vertex: corner position and corner UV of a unit quad centered on the origin
+    const float quadVertices[] = {
+        -0.5f, -0.5f, 0.0f, 0.0f,
+         0.5f, -0.5f, 1.0f, 0.0f,
+         0.5f,  0.5f, 1.0f, 1.0f,
+        -0.5f,  0.5f, 0.0f, 1.0f
+    };
+
+    const unsigned int quadIndices[] = { 0, 1, 2, 2, 3, 0 };
+
+    constexpr size_t InitialCapacity = 1024;
+}
+
+InstancedQuadRenderer::InstancedQuadRenderer()
+    : m_VAO(0), m_QuadVBO(0), m_EBO(0), m_InstanceVBO(0)
+    , m_Capacity(0)
+    , m_Initialized(false) {
+}
+
+InstancedQuadRenderer::~InstancedQuadRenderer() {
+    Shutdown();
+}
+
+bool InstancedQuadRenderer::Init(std::shared_ptr<Shader> shader) {
+    if (m_Initialized) {
+        Logger::Warn("InstancedQuadRenderer already initialized");
+        return true;
+    }
+
+    if (!shader) {
+        Logger::Error("InstancedQuadRenderer requires a shader");
+        return false;
+    }
+    m_Shader = std::move(shader);
+
+    // Instances always sample from unit 0
+    m_Shader->Use();
+    m_Shader->SetInt(m_Shader->GetUniform("spriteTexture"), 0);
+
+    CreateBuffers();
+
+    m_Initialized = true;
+    return true;
+}
+
+void InstancedQuadRenderer::Shutdown() {
+    if (!m_Initialized) return;
+
+    CleanupBuffers();
+    m_Shader.reset();
+    m_Initialized = false;
+}
+
+void InstancedQuadRenderer::CreateBuffers() {
+    glGenVertexArrays(1, &m_VAO);
+    glGenBuffers(1, &m_QuadVBO);
+    glGenBuffers(1, &m_EBO);
+    glGenBuffers(1, &m_InstanceVBO);
+
+    GLStateCache::getInstance().BindVertexArray(m_VAO);
+
+    // Static unit quad
+    glBindBuffer(GL_ARRAY_BUFFER, m_QuadVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(quadVertices), quadVertices, GL_STATIC_DRAW);
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(quadIndices), quadIndices, GL_STATIC_DRAW);
+
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2 * sizeof(float)));
+
+    // Per-instance attributes, advanced once per quad
+    m_Capacity = InitialCapacity;
+    glBindBuffer(GL_ARRAY_BUFFER, m_InstanceVBO);
+    glBufferData(GL_ARRAY_BUFFER, m_Capacity * sizeof(QuadInstance), nullptr, GL_STREAM_DRAW);
+
+    const GLsizei stride = sizeof(QuadInstance);
+    glEnableVertexAttribArray(3);
+    glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(QuadInstance, Position));
+    glVertexAttribDivisor(3, 1);
+    glEnableVertexAttribArray(4);
+    glVertexAttribPointer(4, 2, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(QuadInstance, Size));
+    glVertexAttribDivisor(4, 1);
+    glEnableVertexAttribArray(5);
+    glVertexAttribPointer(5, 4, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(QuadInstance, Color));
+    glVertexAttribDivisor(5, 1);
+    glEnableVertexAttribArray(6);
+    glVertexAttribPointer(6, 4, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(QuadInstance, UVRect));
+    glVertexAttribDivisor(6, 1);
+    glEnableVertexAttribArray(7);
+    glVertexAttribPointer(7, 1, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(QuadInstance, Rotation));
+    glVertexAttribDivisor(7, 1);
+}
+
+void InstancedQuadRenderer::CleanupBuffers() {
+    if (m_VAO != 0) {
+        glDeleteVertexArrays(1, &m_VAO);
+        GLStateCache::getInstance().OnVertexArrayDeleted(m_VAO);
+        m_VAO = 0;
+    }
+    if (m_QuadVBO != 0) {
+        glDeleteBuffers(1, &m_QuadVBO);
+        m_QuadVBO = 0;
+    }
+    if (m_EBO != 0) {
+        glDeleteBuffers(1, &m_EBO);
+        m_EBO = 0;
+    }
+    if (m_InstanceVBO != 0) {
+        glDeleteBuffers(1, &m_InstanceVBO);
+        m_InstanceVBO = 0;
+    }
+    m_Capacity = 0;
+}
+
+void InstancedQuadRenderer::Draw(const QuadInstance* instances, size_t count, unsigned int textureID) {
+    if (!m_Initialized || !instances || count == 0) return;
+
+    glBindBuffer(GL_ARRAY_BUFFER, m_InstanceVBO);
+
+    // Orphan the previous contents; grow geometrically so steady-state frames never reallocate
+    if (count > m_Capacity) {
+        while (m_Capacity < count) {
+            m_Capacity *= 2;
+        }
+    }
+    glBufferData(GL_ARRAY_BUFFER, m_Capacity * sizeof(QuadInstance), nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, count * sizeof(QuadInstance), instances);
+
+    m_Shader->Use();
+
+    GLStateCache::getInstance().BindTexture(0, textureID);
+
+    GLStateCache::getInstance().BindVertexArray(m_VAO);
+    glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr, static_cast<GLsizei>(count));
+}
@@ -1,4 +1,5 @@
 #include "graphics/Mesh.hpp"
+#include "graphics/GLStateCache.hpp"
 #include "core/Logger.hpp"
 #include <glad/glad.h>
 
@@ -46,7 +47,7 @@ void Mesh::SetupMesh() {
     glGenBuffers(1, &m_EBO);
 
     // Bind VAO first
-    glBindVertexArray(m_VAO);
+    GLStateCache::getInstance().BindVertexArray(m_VAO);
 
     // Load vertex data
     glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
@@ -68,23 +69,21 @@ void Mesh::SetupMesh() {
     // Color
     glEnableVertexAttribArray(2);
     glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Color));
-
-    // Unbind
-    glBindVertexArray(0);
     
     Logger::Info("Mesh setup completed successfully");
 }
 
 void Mesh::Draw(const Shader& shader) const {
+    // The VAO stays bound; the state cache skips the rebind for back-to-back draws
     shader.Use();
-    glBindVertexArray(m_VAO);
+    GLStateCache::getInstance().BindVertexArray(m_VAO);
     glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(m_Indices.size()), GL_UNSIGNED_INT, 0);
-    glBindVertexArray(0);
 }
 
 void Mesh::CleanupMesh() {
     if (m_VAO != 0) {
         glDeleteVertexArrays(1, &m_VAO);
+        GLStateCache::getInstance().OnVertexArrayDeleted(m_VAO);
         m_VAO = 0;
     }
     if (m_VBO != 0) {
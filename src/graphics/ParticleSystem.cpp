@@ -0,0 +1,243 @@
+#include "graphics/ParticleSystem.hpp"
+#include "graphics/Renderer.hpp"
+#include "graphics/RenderQueue.hpp"
+#include "core/JobSystem.hpp"
+#include "core/Profiler.hpp"
+#include "physics/PhysicsKernels.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Shortest life a particle can be given, so 1 / lifetime stays finite
+    constexpr float MinLifetime = 1e-3f;
+}
+
+ParticleEmitter::ParticleEmitter()
+    : ParticleEmitter(Properties()) {
+}
+
+ParticleEmitter::ParticleEmitter(const Properties& props)
+    : m_Properties(props)
+    , m_Count(0)
+    , m_EmissionAccumulator(0.0f)
+    , m_Random(props.Seed) {
+    m_Properties.ParticlesPerJob = std::max<size_t>(m_Properties.ParticlesPerJob, 1);
+
+    // The whole pool up front: emitting never allocates
+    const size_t capacity = m_Properties.MaxParticles;
+    for (std::vector<float>* array : { &m_PositionX, &m_PositionY, &m_VelocityX, &m_VelocityY, &m_Life,
+                                       &m_InverseLifetime, &m_BaseSize, &m_Size,
+                                       &m_ColorR, &m_ColorG, &m_ColorB, &m_ColorA }) {
+        array->resize(capacity);
+    }
+}
+
+size_t ParticleEmitter::Emit(size_t count, const glm::vec2& position) {
+    const size_t free = m_Properties.MaxParticles - m_Count;
+    const size_t emitted = std::min(count, free);
+    m_Stats.Dropped += static_cast<uint32_t>(count - emitted);
+    m_Stats.Emitted += static_cast<uint32_t>(emitted);
+
+    std::uniform_real_distribution<float> spread(-1.0f, 1.0f);
+    const Properties& props = m_Properties;
+    for (size_t n = 0; n < emitted; ++n) {
+        const size_t i = m_Count++;
+        m_PositionX[i] = position.x + props.PositionVariation.x * spread(m_Random);
+        m_PositionY[i] = position.y + props.PositionVariation.y * spread(m_Random);
+        m_VelocityX[i] = props.Velocity.x + props.VelocityVariation.x * spread(m_Random);
+        m_VelocityY[i] = props.Velocity.y + props.VelocityVariation.y * spread(m_Random);
+
+        const float lifetime = std::max(props.Lifetime + props.LifetimeVariation * spread(m_Random), MinLifetime);
+        m_Life[i] = lifetime;
+        m_InverseLifetime[i] = 1.0f / lifetime;
+
+        m_BaseSize[i] = std::max(props.Size + props.SizeVariation * spread(m_Random), 0.0f);
+        m_Size[i] = m_BaseSize[i];
+        m_ColorR[i] = props.ColorBegin.r;
+        m_ColorG[i] = props.ColorBegin.g;
+        m_ColorB[i] = props.ColorBegin.b;
+        m_ColorA[i] = props.ColorBegin.a;
+    }
+    return emitted;
+}
+
+void ParticleEmitter::Update(float deltaTime) {
+    PROFILE_FUNCTION();
+
+    if (m_Properties.EmissionRate > 0.0f) {
+        m_EmissionAccumulator += m_Properties.EmissionRate * deltaTime;
+        const float whole = std::floor(m_EmissionAccumulator);
+        m_EmissionAccumulator -= whole;
+        Emit(static_cast<size_t>(whole));
+    }
+    if (m_Count == 0) return;
+
+    // Batches touch disjoint ranges of every array, so results do not
+    // depend on how the pool was split
+    if (m_Count <= m_Properties.ParticlesPerJob) {
+        UpdateRange(0, m_Count, deltaTime);
+    } else {
+        JobSystem::getInstance().ParallelFor(m_Count, m_Properties.ParticlesPerJob,
+            [this, deltaTime](size_t begin, size_t end) { UpdateRange(begin, end, deltaTime); });
+    }
+
+    RemoveExpired();
+}
+
+void ParticleEmitter::UpdateRange(size_t begin, size_t end, float deltaTime) {
+    const size_t count = end - begin;
+    float* velocityX = m_VelocityX.data() + begin;
+    float* velocityY = m_VelocityY.data() + begin;
+
+    // Plain loops over contiguous floats with no branches; they vectorize
+    const float damping = std::max(1.0f - m_Properties.Drag * deltaTime, 0.0f);
+    const float gravityX = m_Properties.Gravity.x * deltaTime;
+    const float gravityY = m_Properties.Gravity.y * deltaTime;
+    for (size_t i = 0; i < count; ++i) {
+        velocityX[i] = velocityX[i] * damping + gravityX;
+        velocityY[i] = velocityY[i] * damping + gravityY;
+    }
+
+    PhysicsKernels::IntegratePositions(m_PositionX.data() + begin, m_PositionY.data() + begin,
+                                       velocityX, velocityY, count, deltaTime);
+
+    // t runs from 1 at birth to 0 at death
+    float* life = m_Life.data() + begin;
+    const float* inverseLifetime = m_InverseLifetime.data() + begin;
+    const float* baseSize = m_BaseSize.data() + begin;
+    float* size = m_Size.data() + begin;
+    float* colorR = m_ColorR.data() + begin;
+    float* colorG = m_ColorG.data() + begin;
+    float* colorB = m_ColorB.data() + begin;
+    float* colorA = m_ColorA.data() + begin;
+    const glm::vec4 colorBegin = m_Properties.ColorBegin;
+    const glm::vec4 colorEnd = m_Properties.ColorEnd;
+    const glm::vec4 colorRange = colorBegin - colorEnd;
+    const float sizeEndScale = m_Properties.SizeEndScale;
+    const float sizeRange = 1.0f - sizeEndScale;
+    for (size_t i = 0; i < count; ++i) {
+        life[i] -= deltaTime;
+        const float t = std::max(life[i] * inverseLifetime[i], 0.0f);
+        size[i] = baseSize[i] * (sizeEndScale + sizeRange * t);
+        colorR[i] = colorEnd.r + colorRange.r * t;
+        colorG[i] = colorEnd.g + colorRange.g * t;
+        colorB[i] = colorEnd.b + colorRange.b * t;
+        colorA[i] = colorEnd.a + colorRange.a * t;
+    }
+}
+
+void ParticleEmitter::RemoveExpired() {
+    // Swap-remove: the last live particle takes the dead one's slot, and is
+    // checked again there
+    size_t i = 0;
+    while (i < m_Count) {
+        if (m_Life[i] > 0.0f) {
+            ++i;
+            continue;
+        }
+        --m_Count;
+        MoveParticle(m_Count, i);
+        ++m_Stats.Expired;
+    }
+}
+
+void ParticleEmitter::MoveParticle(size_t from, size_t to) {
+    m_PositionX[to] = m_PositionX[from];
+    m_PositionY[to] = m_PositionY[from];
+    m_VelocityX[to] = m_VelocityX[from];
+    m_VelocityY[to] = m_VelocityY[from];
+    m_Life[to] = m_Life[from];
+    m_InverseLifetime[to] = m_InverseLifetime[from];
+    m_BaseSize[to] = m_BaseSize[from];
+    m_Size[to] = m_Size[from];
+    m_ColorR[to] = m_ColorR[from];
+    m_ColorG[to] = m_ColorG[from];
+    m_ColorB[to] = m_ColorB[from];
+    m_ColorA[to] = m_ColorA[from];
+}
+
+glm::vec4 ParticleEmitter::GetColor(size_t index) const {
+    return glm::vec4(m_ColorR[index], m_ColorG[index], m_ColorB[index], m_ColorA[index]);
+}
+
+void ParticleEmitter::BuildInstances() {
+    PROFILE_FUNCTION();
+
+    m_Instances.resize(m_Count);
+    if (m_Count <= m_Properties.ParticlesPerJob) {
+        BuildInstanceRange(0, m_Count);
+    } else {
+        JobSystem::getInstance().ParallelFor(m_Count, m_Properties.ParticlesPerJob,
+            [this](size_t begin, size_t end) { BuildInstanceRange(begin, end); });
+    }
+}
+
+void ParticleEmitter::BuildInstanceRange(size_t begin, size_t end) {
+    const glm::vec4 uvRect = m_Properties.UVRect;
+    for (size_t i = begin; i < end; ++i) {
+        QuadInstance& instance = m_Instances[i];
+        instance.Position = glm::vec2(m_PositionX[i], m_PositionY[i]);
+        instance.Size = glm::vec2(m_Size[i]);
+        instance.Color = glm::vec4(m_ColorR[i], m_ColorG[i], m_ColorB[i], m_ColorA[i]);
+        instance.UVRect = uvRect;
+        instance.Rotation = 0.0f;
+    }
+}
+
+void ParticleEmitter::Draw() {
+    if (m_Count == 0) return;
+
+    BuildInstances();
+    Renderer::getInstance().DrawQuadsInstanced(m_Instances.data(), m_Instances.size(), m_Properties.TextureRef);
+}
+
+void ParticleEmitter::Submit(RenderQueue& queue, uint8_t layer, float depth) {
+    if (m_Count == 0) return;
+
+    BuildInstances();
+    queue.SubmitInstancedQuads(layer, depth, m_Instances.data(), m_Instances.size(), m_Properties.TextureRef);
+}
+
+ParticleEmitter& ParticleSystem::CreateEmitter() {
+    return CreateEmitter(ParticleEmitter::Properties());
+}
+
+ParticleEmitter& ParticleSystem::CreateEmitter(const ParticleEmitter::Properties& props) {
+    m_Emitters.push_back(std::make_unique<ParticleEmitter>(props));
+    return *m_Emitters.back();
+}
+
+void ParticleSystem::DestroyEmitter(ParticleEmitter& emitter) {
+    auto it = std::find_if(m_Emitters.begin(), m_Emitters.end(),
+                           [&emitter](const std::unique_ptr<ParticleEmitter>& owned) { return owned.get() == &emitter; });
+    if (it != m_Emitters.end()) {
+        m_Emitters.erase(it);
+    }
+}
+
+void ParticleSystem::Update(float deltaTime) {
+    PROFILE_FUNCTION();
+    for (const std::unique_ptr<ParticleEmitter>& emitter : m_Emitters) {
+        emitter->Update(deltaTime);
+    }
+}
+
+void ParticleSystem::Draw() {
+    for (const std::unique_ptr<ParticleEmitter>& emitter : m_Emitters) {
+        emitter->Draw();
+    }
+}
+
+void ParticleSystem::Submit(RenderQueue& queue, uint8_t layer, float depth) {
+    for (const std::unique_ptr<ParticleEmitter>& emitter : m_Emitters) {
+        emitter->Submit(queue, layer, depth);
+    }
+}
+
+size_t ParticleSystem::GetParticleCount() const {
+    size_t count = 0;
+    for (const std::unique_ptr<ParticleEmitter>& emitter : m_Emitters) {
+        count += emitter->GetCount();
+    }
+    return count;
+}
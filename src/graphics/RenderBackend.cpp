@@ -0,0 +1,214 @@
+#include "graphics/RenderBackend.hpp"
+#include "graphics/Renderer.hpp"
+#include "graphics/AsyncTextureLoader.hpp"
+#include "graphics/GpuProfiler.hpp"
+#include "core/Window.hpp"
+#include "core/Logger.hpp"
+#include "core/Profiler.hpp"
+
+RenderBackend::RenderBackend()
+    : m_Window(nullptr)
+    , m_WriteIndex(0)
+    , m_Threaded(false)
+    , m_Initialized(false)
+    , m_FramePending(false)
+    , m_StopRequested(false)
+    , m_ThreadReady(false) {
+    m_Queues[0] = std::make_unique<RenderQueue>();
+    m_Queues[1] = std::make_unique<RenderQueue>();
+}
+
+RenderBackend::~RenderBackend() {
+    Shutdown();
+}
+
+bool RenderBackend::Init(Window* window, bool threaded) {
+    if (m_Initialized) {
+        Logger::Warn("RenderBackend already initialized");
+        return true;
+    }
+
+    m_Window = window;
+    m_Threaded = threaded;
+
+    if (!m_Threaded) {
+        Renderer::getInstance().Init();
+        GpuProfiler::getInstance().Init();
+        m_Initialized = true;
+        Logger::Info("Render backend running inline");
+        return true;
+    }
+
+    // Hand the context to the render thread; a context is current on one thread at a time
+    m_Window->DetachContext();
+
+    m_StopRequested = false;
+    m_ThreadReady = false;
+    m_Thread = std::thread(&RenderBackend::RenderThreadMain, this);
+
+    // Wait for the Renderer to come up on the render thread
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Condition.wait(lock, [this] { return m_ThreadReady; });
+    }
+
+    m_Initialized = true;
+    Logger::Info("Render backend running on a dedicated render thread");
+    return true;
+}
+
+void RenderBackend::Shutdown() {
+    if (!m_Initialized) return;
+
+    if (m_Threaded) {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_StopRequested = true;
+        }
+        m_Condition.notify_all();
+        m_Thread.join();
+
+        // The render thread released the context on exit
+        m_Window->MakeContextCurrent();
+    } else {
+        GpuProfiler::getInstance().Shutdown();
+        AsyncTextureLoader::getInstance().ReleaseGLResources();
+        Renderer::getInstance().Shutdown();
+    }
+
+    m_Queues[0]->Reset();
+    m_Queues[1]->Reset();
+    m_Initialized = false;
+}
+
+void RenderBackend::SubmitFrame() {
+    if (!m_Initialized) return;
+
+    if (!m_Threaded) {
+        RenderQueue& queue = *m_Queues[m_WriteIndex];
+        Execute(queue);
+        queue.Reset();
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        // The other queue is free once the render thread finished the previous frame
+        m_Condition.wait(lock, [this] { return !m_FramePending; });
+        m_WriteIndex ^= 1;
+        m_FramePending = true;
+    }
+    m_Condition.notify_all();
+
+    // Carry frame-wide state over so callers only set what changes
+    RenderQueue& submitted = *m_Queues[m_WriteIndex ^ 1];
+    RenderQueue& next = *m_Queues[m_WriteIndex];
+    next.Reset();
+    next.SetClearColor(submitted.GetClearColor());
+    next.SetCamera(submitted.GetProjectionMatrix(), submitted.GetViewMatrix());
+}
+
+void RenderBackend::WaitIdle() {
+    if (!m_Threaded || !m_Initialized) return;
+
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_Condition.wait(lock, [this] { return !m_FramePending; });
+}
+
+void RenderBackend::Execute(RenderQueue& queue) {
+    PROFILE_SCOPE("Execute");
+    Renderer& renderer = Renderer::getInstance();
+    GpuProfiler& gpuProfiler = GpuProfiler::getInstance();
+    gpuProfiler.BeginFrame();
+
+    // Finish a bounded slice of pending texture uploads before drawing
+    {
+        PROFILE_SCOPE("TextureUploads");
+        GPU_PROFILE_SCOPE("TextureUploads");
+        AsyncTextureLoader::getInstance().ProcessUploads();
+    }
+
+    {
+        PROFILE_SCOPE("SortQueue");
+        queue.Sort();
+    }
+
+    {
+        PROFILE_SCOPE("Draw");
+        GPU_PROFILE_SCOPE("Draw");
+        renderer.BeginFrame();
+        renderer.Clear(queue.GetClearColor());
+        renderer.SetProjectionMatrix(queue.GetProjectionMatrix());
+        renderer.SetViewMatrix(queue.GetViewMatrix());
+
+        renderer.BeginScene();
+        for (const RenderQueue::Entry& entry : queue.GetEntries()) {
+            const RenderCommand* command = queue.GetCommand(entry);
+            switch (command->Type) {
+                case RenderCommandType::Quad: {
+                    const auto* quad = static_cast<const QuadCommand*>(command);
+                    if (quad->TextureRef) {
+                        renderer.DrawTexturedRectangle(quad->Position, quad->Size, *quad->TextureRef, quad->Color);
+                    } else {
+                        renderer.DrawRectangle(quad->Position, quad->Size, quad->Color);
+                    }
+                    break;
+                }
+                case RenderCommandType::InstancedQuads: {
+                    const auto* instanced = static_cast<const InstancedQuadsCommand*>(command);
+                    renderer.DrawQuadsInstanced(queue.GetInstances(*instanced), instanced->Count, instanced->TextureRef);
+                    break;
+                }
+                case RenderCommandType::Mesh: {
+                    const auto* mesh = static_cast<const MeshCommand*>(command);
+                    renderer.DrawMesh(*mesh->MeshRef, *mesh->ShaderRef);
+                    break;
+                }
+            }
+        }
+        renderer.EndScene();
+    }
+    gpuProfiler.EndFrame();
+
+    {
+        PROFILE_SCOPE("Swap");
+        m_Window->SwapBuffers();
+    }
+}
+
+void RenderBackend::RenderThreadMain() {
+    Profiler::SetThreadName("Render");
+    m_Window->MakeContextCurrent();
+    Renderer::getInstance().Init();
+    GpuProfiler::getInstance().Init();
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_ThreadReady = true;
+    }
+    m_Condition.notify_all();
+
+    while (true) {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Condition.wait(lock, [this] { return m_FramePending || m_StopRequested; });
+        if (!m_FramePending && m_StopRequested) {
+            break;
+        }
+
+        // The main thread only touches the write queue while a frame is pending
+        RenderQueue& queue = *m_Queues[m_WriteIndex ^ 1];
+        lock.unlock();
+
+        Execute(queue);
+
+        lock.lock();
+        m_FramePending = false;
+        lock.unlock();
+        m_Condition.notify_all();
+    }
+
+    GpuProfiler::getInstance().Shutdown();
+    AsyncTextureLoader::getInstance().ReleaseGLResources();
+    Renderer::getInstance().Shutdown();
+    m_Window->DetachContext();
+}
@@ -0,0 +1,125 @@
+#include "graphics/RenderQueue.hpp"
+#include "graphics/Camera2D.hpp"
+#include "graphics/Texture.hpp"
+#include "graphics/Shader.hpp"
+#include "core/Logger.hpp"
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+RenderQueue::RenderQueue(size_t arenaSize)
+    : m_Arena(arenaSize)
+    , m_ClearColor(0.0f, 0.0f, 0.0f, 1.0f)
+    , m_ProjectionMatrix(1.0f)
+    , m_ViewMatrix(1.0f)
+    , m_Dropped(0) {
+}
+
+void RenderQueue::Reset() {
+    m_Arena.Reset();
+    m_Entries.clear();
+    m_Instances.clear();
+    m_Dropped = 0;
+}
+
+void RenderQueue::SetCamera(const glm::mat4& projection, const glm::mat4& view) {
+    m_ProjectionMatrix = projection;
+    m_ViewMatrix = view;
+}
+
+void RenderQueue::SetCamera(const Camera2D& camera) {
+    SetCamera(camera.GetProjectionMatrix(), camera.GetViewMatrix());
+}
+
+template<typename T>
+T* RenderQueue::Allocate(uint64_t key) {
+    static_assert(std::is_trivially_destructible<T>::value, "Render commands must be trivially destructible");
+
+    void* memory = m_Arena.Allocate(sizeof(T), alignof(T));
+    if (!memory) {
+        if (m_Dropped++ == 0) {
+            LOG_WARN("RenderQueue arena full ({} bytes), dropping commands", m_Arena.GetCapacity());
+        }
+        return nullptr;
+    }
+
+    const auto offset = static_cast<uint32_t>(static_cast<uint8_t*>(memory) - m_Arena.GetBase());
+    m_Entries.push_back({ key, offset });
+    return new (memory) T();
+}
+
+void RenderQueue::SubmitQuad(uint8_t layer, float depth, const glm::vec2& position, const glm::vec2& size,
+                             const glm::vec4& color, const Texture* texture) {
+    const uint32_t textureID = texture ? texture->GetID() : 0;
+    QuadCommand* command = Allocate<QuadCommand>(RenderKey::Make(layer, 0, textureID, depth));
+    if (!command) return;
+
+    command->Type = RenderCommandType::Quad;
+    command->Position = position;
+    command->Size = size;
+    command->Color = color;
+    command->TextureRef = texture;
+}
+
+void RenderQueue::SubmitInstancedQuads(uint8_t layer, float depth, const QuadInstance* instances, size_t count,
+                                       const Texture* texture) {
+    if (!instances || count == 0) return;
+
+    const uint32_t textureID = texture ? texture->GetID() : 0;
+    InstancedQuadsCommand* command = Allocate<InstancedQuadsCommand>(RenderKey::Make(layer, 0, textureID, depth));
+    if (!command) return;
+
+    command->Type = RenderCommandType::InstancedQuads;
+    // The caller's array may be gone by the time the backend runs; keep a copy
+    command->FirstInstance = static_cast<uint32_t>(m_Instances.size());
+    m_Instances.insert(m_Instances.end(), instances, instances + count);
+    command->Count = static_cast<uint32_t>(count);
+    command->TextureRef = texture;
+}
+
+void RenderQueue::SubmitMesh(uint8_t layer, float depth, const Mesh& mesh, const Shader& shader) {
+    MeshCommand* command = Allocate<MeshCommand>(RenderKey::Make(layer, shader.GetProgram(), 0, depth));
+    if (!command) return;
+
+    command->Type = RenderCommandType::Mesh;
+    command->MeshRef = &mesh;
+    command->ShaderRef = &shader;
+}
+
+void RenderQueue::Sort() {
+    const size_t count = m_Entries.size();
+    if (count < 2) return;
+
+    m_SortScratch.resize(count);
+    Entry* src = m_Entries.data();
+    Entry* dst = m_SortScratch.data();
+
+    // LSD radix sort, one byte per pass
+    for (int shift = 0; shift < 64; shift += 8) {
+        size_t histogram[256] = {};
+        for (size_t i = 0; i < count; ++i) {
+            histogram[(src[i].Key >> shift) & 0xFF]++;
+        }
+
+        // Every key has the same byte here; the pass would be a plain copy
+        if (histogram[(src[0].Key >> shift) & 0xFF] == count) {
+            continue;
+        }
+
+        size_t sum = 0;
+        for (size_t& bucket : histogram) {
+            const size_t bucketCount = bucket;
+            bucket = sum;
+            sum += bucketCount;
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            dst[histogram[(src[i].Key >> shift) & 0xFF]++] = src[i];
+        }
+        std::swap(src, dst);
+    }
+
+    if (src != m_Entries.data()) {
+        m_Entries.swap(m_SortScratch);
+    }
+}
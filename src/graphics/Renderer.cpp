@@ -1,69 +1,86 @@
 #include "graphics/Renderer.hpp"
+#include "graphics/Camera2D.hpp"
+#include "graphics/GLStateCache.hpp"
 #include "core/Logger.hpp"
 #include <glad/glad.h>
 #include <glm/gtc/matrix_transform.hpp>
 
 namespace {
-    const char* colorVertexShader = R"(
+    const char* spriteVertexShader = R"(
         #version 330 core
         layout (location = 0) in vec3 aPos;
+        layout (location = 1) in vec2 aTexCoord;
         layout (location = 2) in vec4 aColor;
         
-        uniform mat4 projection;
-        uniform mat4 view;
-        uniform mat4 model;
+        layout (std140) uniform Camera {
+            mat4 projection;
+            mat4 view;
+            mat4 viewProjection;
+        };
         
-        out vec4 vertexColor;
+        out vec2 TexCoord;
+        out vec4 Color;
         
         void main() {
-            gl_Position = projection * view * model * vec4(aPos, 1.0);
-            vertexColor = aColor;
+            gl_Position = viewProjection * vec4(aPos, 1.0);
+            TexCoord = aTexCoord;
+            Color = aColor;
         }
     )";
 
-    const char* colorFragmentShader = R"(
+    const char* spriteFragmentShader = R"(
         #version 330 core
-        in vec4 vertexColor;
+        in vec2 TexCoord;
+        in vec4 Color;
         out vec4 FragColor;
         
+        uniform sampler2D spriteTexture;
+        
         void main() {
-            FragColor = vertexColor;
+            FragColor = texture(spriteTexture, TexCoord) * Color;
         }
     )";
 
-    const char* textureVertexShader = R"(
+    const char* instanceVertexShader = R"(
         #version 330 core
-        layout (location = 0) in vec3 aPos;
+        layout (location = 0) in vec2 aCorner;
         layout (location = 1) in vec2 aTexCoord;
+        layout (location = 3) in vec2 iPosition;
+        layout (location = 4) in vec2 iSize;
+        layout (location = 5) in vec4 iColor;
+        layout (location = 6) in vec4 iUVRect;
+        layout (location = 7) in float iRotation;
         
-        uniform mat4 projection;
-        uniform mat4 view;
-        uniform mat4 model;
+        layout (std140) uniform Camera {
+            mat4 projection;
+            mat4 view;
+            mat4 viewProjection;
+        };
         
         out vec2 TexCoord;
+        out vec4 Color;
         
         void main() {
-            gl_Position = projection * view * model * vec4(aPos, 1.0);
-            TexCoord = aTexCoord;
+            vec2 local = aCorner * iSize;
+            float c = cos(iRotation);
+            float s = sin(iRotation);
+            vec2 world = vec2(local.x * c - local.y * s, local.x * s + local.y * c) + iPosition;
+            gl_Position = viewProjection * vec4(world, 0.0, 1.0);
+            TexCoord = mix(iUVRect.xy, iUVRect.zw, aTexCoord);
+            Color = iColor;
         }
     )";
 
-    const char* textureFragmentShader = R"(
-        #version 330 core
-        in vec2 TexCoord;
-        out vec4 FragColor;
-        
-        uniform sampler2D texture1;
-        uniform vec4 tintColor;
-        
-        void main() {
-            FragColor = texture(texture1, TexCoord) * tintColor;
-        }
-    )";
+    struct CameraBlock {
+        glm::mat4 Projection;
+        glm::mat4 View;
+        glm::mat4 ViewProjection;
+    };
 }
 
 Renderer::Renderer()
-    : m_ProjectionMatrix(1.0f), m_ViewMatrix(1.0f), m_Initialized(false) {
+    : m_ProjectionMatrix(1.0f), m_ViewMatrix(1.0f), m_ViewProjectionMatrix(1.0f), m_CameraDirty(true)
+    , m_HasViewBounds(false), m_CulledCount(0), m_Initialized(false) {
 }
 
 Renderer::~Renderer() {
@@ -76,12 +93,28 @@ void Renderer::Init() {
         return;
     }
 
+    // Fresh context: nothing the cache remembers can be trusted
+    GLStateCache::getInstance().Invalidate();
+
+    m_CameraUBO = std::make_unique<UniformBuffer>(sizeof(CameraBlock), CameraBlockBinding);
+    m_CameraDirty = true;
+
     CreateDefaultShaders();
     CreateDefaultMeshes();
 
+    m_SpriteBatch = std::make_unique<SpriteBatch>();
+    if (!m_SpriteBatch->Init(m_SpriteShader)) {
+        Logger::Error("Failed to initialize sprite batch");
+    }
+
+    m_InstancedQuads = std::make_unique<InstancedQuadRenderer>();
+    if (!m_InstancedQuads->Init(m_InstanceShader)) {
+        Logger::Error("Failed to initialize instanced quad renderer");
+    }
+
     // Enable blending for transparency
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    GLStateCache::getInstance().SetBlend(true);
+    GLStateCache::getInstance().SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
     m_Initialized = true;
     Logger::Info("Renderer initialized successfully");
@@ -90,28 +123,41 @@ void Renderer::Init() {
 void Renderer::Shutdown() {
     if (!m_Initialized) return;
 
-    m_ColorShader.reset();
-    m_TextureShader.reset();
+    m_InstancedQuads.reset();
+    m_SpriteBatch.reset();
+    m_SpriteShader.reset();
+    m_InstanceShader.reset();
     m_QuadMesh.reset();
+    m_CameraUBO.reset();
 
     m_Initialized = false;
     Logger::Info("Renderer shut down");
 }
 
+void Renderer::BeginFrame() {
+    GLStateCache::getInstance().ResetStats();
+    m_CulledCount = 0;
+    if (m_SpriteBatch) {
+        m_SpriteBatch->ResetStats();
+    }
+}
+
 void Renderer::CreateDefaultShaders() {
-    // Create color shader
-    m_ColorShader = std::make_shared<Shader>();
-    if (!m_ColorShader->Init(colorVertexShader, colorFragmentShader)) {
-        Logger::Error("Failed to create color shader");
+    // Create sprite shader, shared by colored and textured quads
+    m_SpriteShader = std::make_shared<Shader>();
+    if (!m_SpriteShader->Init(spriteVertexShader, spriteFragmentShader)) {
+        Logger::Error("Failed to create sprite shader");
         return;
     }
+    m_SpriteShader->BindUniformBlock("Camera", CameraBlockBinding);
 
-    // Create texture shader
-    m_TextureShader = std::make_shared<Shader>();
-    if (!m_TextureShader->Init(textureVertexShader, textureFragmentShader)) {
-        Logger::Error("Failed to create texture shader");
+    // Create instanced quad shader, reusing the sprite fragment stage
+    m_InstanceShader = std::make_shared<Shader>();
+    if (!m_InstanceShader->Init(instanceVertexShader, spriteFragmentShader)) {
+        Logger::Error("Failed to create instanced quad shader");
         return;
     }
+    m_InstanceShader->BindUniformBlock("Camera", CameraBlockBinding);
 }
 
 void Renderer::CreateDefaultMeshes() {
@@ -136,60 +182,134 @@ void Renderer::Clear(const glm::vec4& color) {
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 }
 
+void Renderer::BeginScene() {
+    UploadCameraIfDirty();
+    m_SpriteBatch->Begin();
+}
+
+void Renderer::EndScene() {
+    m_SpriteBatch->End();
+}
+
 void Renderer::DrawMesh(const Mesh& mesh, const Shader& shader) {
+    // Keep draw order: anything batched so far goes out before the mesh
+    m_SpriteBatch->Flush();
+    UploadCameraIfDirty();
+
     shader.Use();
-    shader.SetMat4("projection", m_ProjectionMatrix);
-    shader.SetMat4("view", m_ViewMatrix);
+    if (!shader.BindUniformBlock("Camera", CameraBlockBinding)) {
+        // Shader declares plain projection/view uniforms instead of the camera block
+        shader.SetMat4("projection", m_ProjectionMatrix);
+        shader.SetMat4("view", m_ViewMatrix);
+    }
     shader.SetMat4("model", glm::mat4(1.0f));
     mesh.Draw(shader);
 }
 
 void Renderer::DrawRectangle(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color) {
-    m_ColorShader->Use();
-    
-    glm::mat4 model = glm::mat4(1.0f);
-    model = glm::translate(model, glm::vec3(position, 0.0f));
-    model = glm::scale(model, glm::vec3(size, 1.0f));
-    
-    m_ColorShader->SetMat4("projection", m_ProjectionMatrix);
-    m_ColorShader->SetMat4("view", m_ViewMatrix);
-    m_ColorShader->SetMat4("model", model);
-    
-    // Update quad vertices color
-    std::vector<Vertex> coloredQuad = {
-        Vertex({-0.5f, -0.5f, 0.0f}, {0.0f, 0.0f}, color),
-        Vertex({ 0.5f, -0.5f, 0.0f}, {1.0f, 0.0f}, color),
-        Vertex({ 0.5f,  0.5f, 0.0f}, {1.0f, 1.0f}, color),
-        Vertex({-0.5f,  0.5f, 0.0f}, {0.0f, 1.0f}, color)
-    };
-    
-    std::vector<unsigned int> indices = {0, 1, 2, 2, 3, 0};
-    Mesh coloredQuadMesh(coloredQuad, indices);
-    coloredQuadMesh.Draw(*m_ColorShader);
+    if (!IsVisible(AABB::FromCenter(position, size * 0.5f))) {
+        ++m_CulledCount;
+        return;
+    }
+
+    if (m_SpriteBatch->IsActive()) {
+        m_SpriteBatch->Submit(position, size, color);
+        return;
+    }
+
+    BeginScene();
+    m_SpriteBatch->Submit(position, size, color);
+    EndScene();
 }
 
 void Renderer::DrawTexturedRectangle(const glm::vec2& position, const glm::vec2& size, 
                                    const Texture& texture, const glm::vec4& tint) {
-    m_TextureShader->Use();
-    
-    glm::mat4 model = glm::mat4(1.0f);
-    model = glm::translate(model, glm::vec3(position, 0.0f));
-    model = glm::scale(model, glm::vec3(size, 1.0f));
-    
-    m_TextureShader->SetMat4("projection", m_ProjectionMatrix);
-    m_TextureShader->SetMat4("view", m_ViewMatrix);
-    m_TextureShader->SetMat4("model", model);
-    m_TextureShader->SetVec4("tintColor", tint);
-    
-    texture.Bind();
-    m_QuadMesh->Draw(*m_TextureShader);
-    texture.Unbind();
+    if (!IsVisible(AABB::FromCenter(position, size * 0.5f))) {
+        ++m_CulledCount;
+        return;
+    }
+
+    if (m_SpriteBatch->IsActive()) {
+        m_SpriteBatch->Submit(position, size, texture, tint);
+        return;
+    }
+
+    BeginScene();
+    m_SpriteBatch->Submit(position, size, texture, tint);
+    EndScene();
+}
+
+void Renderer::DrawQuadsInstanced(const QuadInstance* instances, size_t count, const Texture* texture) {
+    if (count == 0) return;
+
+    // Keep draw order: anything batched so far goes out before the instances
+    m_SpriteBatch->Flush();
+    UploadCameraIfDirty();
+
+    const unsigned int textureID = texture ? texture->GetID() : m_SpriteBatch->GetWhiteTexture().GetID();
+    m_InstancedQuads->Draw(instances, count, textureID);
+}
+
+void Renderer::DrawIndexed(unsigned int vao, size_t indexCount, const Texture* texture) {
+    if (vao == 0 || indexCount == 0) return;
+
+    // Keep draw order: anything batched so far goes out first
+    m_SpriteBatch->Flush();
+    UploadCameraIfDirty();
+
+    m_SpriteShader->Use();
+    const unsigned int textureID = texture ? texture->GetID() : m_SpriteBatch->GetWhiteTexture().GetID();
+    GLStateCache::getInstance().BindTexture(0, textureID);
+    GLStateCache::getInstance().BindVertexArray(vao);
+    glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indexCount), GL_UNSIGNED_INT, nullptr);
+}
+
+void Renderer::SetCamera(const Camera2D& camera) {
+    m_ViewBounds = camera.GetViewBounds();
+    m_HasViewBounds = true;
+
+    const glm::mat4& projection = camera.GetProjectionMatrix();
+    const glm::mat4& view = camera.GetViewMatrix();
+    if (projection == m_ProjectionMatrix && view == m_ViewMatrix) return;
+
+    m_ProjectionMatrix = projection;
+    m_ViewMatrix = view;
+    m_ViewProjectionMatrix = camera.GetViewProjectionMatrix();
+    OnCameraChanged();
 }
 
 void Renderer::SetProjectionMatrix(const glm::mat4& projection) {
+    m_HasViewBounds = false;
+    if (projection == m_ProjectionMatrix) return;
+
     m_ProjectionMatrix = projection;
+    m_ViewProjectionMatrix = m_ProjectionMatrix * m_ViewMatrix;
+    OnCameraChanged();
 }
 
 void Renderer::SetViewMatrix(const glm::mat4& view) {
+    m_HasViewBounds = false;
+    if (view == m_ViewMatrix) return;
+
     m_ViewMatrix = view;
+    m_ViewProjectionMatrix = m_ProjectionMatrix * m_ViewMatrix;
+    OnCameraChanged();
+}
+
+void Renderer::OnCameraChanged() {
+    m_CameraDirty = true;
+
+    // Quads already batched were submitted under the old matrices
+    if (m_SpriteBatch && m_SpriteBatch->IsActive()) {
+        m_SpriteBatch->Flush();
+        UploadCameraIfDirty();
+    }
+}
+
+void Renderer::UploadCameraIfDirty() {
+    if (!m_CameraDirty || !m_CameraUBO) return;
+
+    const CameraBlock block = { m_ProjectionMatrix, m_ViewMatrix, m_ViewProjectionMatrix };
+    m_CameraUBO->SetData(&block, sizeof(block));
+    m_CameraDirty = false;
 }
@@ -1,13 +1,17 @@
 #include "graphics/Shader.hpp"
+#include "graphics/GLStateCache.hpp"
 #include "core/Logger.hpp"
 #include <glad/glad.h>
+#include "utils/Hash.hpp"
 #include <glm/gtc/type_ptr.hpp>
+#include <algorithm>
 
 Shader::Shader() : m_Program(0) {}
 
 Shader::~Shader() {
     if (m_Program != 0) {
         glDeleteProgram(m_Program);
+        GLStateCache::getInstance().OnProgramDeleted(m_Program);
     }
 }
 
@@ -47,6 +51,72 @@ bool Shader::Init(const std::string& vertexSource, const std::string& fragmentSo
     glDeleteShader(vertexShader);
     glDeleteShader(fragmentShader);
     
+    ReflectUniforms();
+    return true;
+}
+
+void Shader::ReflectUniforms() {
+    m_Uniforms.clear();
+    m_UniformBlocks.clear();
+
+    int uniformCount = 0;
+    glGetProgramiv(m_Program, GL_ACTIVE_UNIFORMS, &uniformCount);
+
+    char name[256];
+    for (int i = 0; i < uniformCount; ++i) {
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(m_Program, static_cast<GLuint>(i), sizeof(name), &length, &size, &type, name);
+
+        // Members of uniform blocks have no location
+        int location = glGetUniformLocation(m_Program, name);
+        if (location < 0) continue;
+
+        // Arrays are reported as "name[0]"; register them under the bare name too
+        m_Uniforms.push_back({ HashString(name, static_cast<size_t>(length)), location });
+        if (length > 3 && std::string(name + length - 3) == "[0]") {
+            m_Uniforms.push_back({ HashString(name, static_cast<size_t>(length - 3)), location });
+        }
+    }
+
+    int blockCount = 0;
+    glGetProgramiv(m_Program, GL_ACTIVE_UNIFORM_BLOCKS, &blockCount);
+    for (int i = 0; i < blockCount; ++i) {
+        GLsizei length = 0;
+        glGetActiveUniformBlockName(m_Program, static_cast<GLuint>(i), sizeof(name), &length, name);
+        m_UniformBlocks.push_back({ HashString(name, static_cast<size_t>(length)), static_cast<unsigned int>(i), -1 });
+    }
+
+    auto byHash = [](const auto& a, const auto& b) { return a.Hash < b.Hash; };
+    std::sort(m_Uniforms.begin(), m_Uniforms.end(), byHash);
+    std::sort(m_UniformBlocks.begin(), m_UniformBlocks.end(), byHash);
+}
+
+Shader::Uniform Shader::GetUniform(const std::string& name) const {
+    const uint64_t hash = HashString(name);
+    auto it = std::lower_bound(m_Uniforms.begin(), m_Uniforms.end(), hash,
+        [](const UniformEntry& entry, uint64_t value) { return entry.Hash < value; });
+
+    Uniform uniform;
+    if (it != m_Uniforms.end() && it->Hash == hash) {
+        uniform.Location = it->Location;
+    }
+    return uniform;
+}
+
+bool Shader::BindUniformBlock(const std::string& name, unsigned int bindingPoint) const {
+    const uint64_t hash = HashString(name);
+    auto it = std::lower_bound(m_UniformBlocks.begin(), m_UniformBlocks.end(), hash,
+        [](const UniformBlockEntry& entry, uint64_t value) { return entry.Hash < value; });
+    if (it == m_UniformBlocks.end() || it->Hash != hash) {
+        return false;
+    }
+
+    if (it->Binding != static_cast<int>(bindingPoint)) {
+        glUniformBlockBinding(m_Program, it->Index, bindingPoint);
+        it->Binding = static_cast<int>(bindingPoint);
+    }
     return true;
 }
 
@@ -69,33 +139,61 @@ bool Shader::CompileShader(unsigned int& shader, const std::string& source, unsi
 }
 
 void Shader::Use() const {
-    glUseProgram(m_Program);
+    GLStateCache::getInstance().UseProgram(m_Program);
+}
+
+void Shader::SetBool(Uniform uniform, bool value) const {
+    glUniform1i(uniform.Location, (int)value);
+}
+
+void Shader::SetInt(Uniform uniform, int value) const {
+    glUniform1i(uniform.Location, value);
+}
+
+void Shader::SetFloat(Uniform uniform, float value) const {
+    glUniform1f(uniform.Location, value);
+}
+
+void Shader::SetVec2(Uniform uniform, const glm::vec2& value) const {
+    glUniform2fv(uniform.Location, 1, glm::value_ptr(value));
+}
+
+void Shader::SetVec3(Uniform uniform, const glm::vec3& value) const {
+    glUniform3fv(uniform.Location, 1, glm::value_ptr(value));
+}
+
+void Shader::SetVec4(Uniform uniform, const glm::vec4& value) const {
+    glUniform4fv(uniform.Location, 1, glm::value_ptr(value));
+}
+
+void Shader::SetMat4(Uniform uniform, const glm::mat4& value) const {
+    glUniformMatrix4fv(uniform.Location, 1, GL_FALSE, glm::value_ptr(value));
 }
 
 void Shader::SetBool(const std::string& name, bool value) const {
-    glUniform1i(glGetUniformLocation(m_Program, name.c_str()), (int)value);
+    SetBool(GetUniform(name), value);
 }
 
 void Shader::SetInt(const std::string& name, int value) const {
-    glUniform1i(glGetUniformLocation(m_Program, name.c_str()), value);
+    SetInt(GetUniform(name), value);
 }
 
 void Shader::SetFloat(const std::string& name, float value) const {
-    glUniform1f(glGetUniformLocation(m_Program, name.c_str()), value);
+    SetFloat(GetUniform(name), value);
 }
 
 void Shader::SetVec2(const std::string& name, const glm::vec2& value) const {
-    glUniform2fv(glGetUniformLocation(m_Program, name.c_str()), 1, glm::value_ptr(value));
+    SetVec2(GetUniform(name), value);
 }
 
 void Shader::SetVec3(const std::string& name, const glm::vec3& value) const {
-    glUniform3fv(glGetUniformLocation(m_Program, name.c_str()), 1, glm::value_ptr(value));
+    SetVec3(GetUniform(name), value);
 }
 
 void Shader::SetVec4(const std::string& name, const glm::vec4& value) const {
-    glUniform4fv(glGetUniformLocation(m_Program, name.c_str()), 1, glm::value_ptr(value));
+    SetVec4(GetUniform(name), value);
 }
 
 void Shader::SetMat4(const std::string& name, const glm::mat4& value) const {
-    glUniform4fv(glGetUniformLocation(m_Program, name.c_str()), 1, glm::value_ptr(value));
+    SetMat4(GetUniform(name), value);
 }
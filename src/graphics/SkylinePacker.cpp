@@ -0,0 +1,117 @@
+#include "graphics/SkylinePacker.hpp"
+#include <algorithm>
+#include <climits>
+
+SkylinePacker::SkylinePacker(int width, int height, int padding)
+    : m_Width(width), m_Height(height), m_Padding(padding), m_UsedArea(0) {
+    Reset();
+}
+
+void SkylinePacker::Reset() {
+    m_Skyline.clear();
+    m_Skyline.push_back({ 0, 0, m_Width });
+    m_UsedArea = 0;
+}
+
+float SkylinePacker::GetOccupancy() const {
+    return static_cast<float>(m_UsedArea) / (static_cast<float>(m_Width) * static_cast<float>(m_Height));
+}
+
+int SkylinePacker::FitAt(size_t index, int width, int height) const {
+    const int x = m_Skyline[index].X;
+    if (x + width > m_Width) {
+        return -1;
+    }
+
+    int y = 0;
+    int remaining = width;
+    for (size_t i = index; remaining > 0; ++i) {
+        if (i == m_Skyline.size()) {
+            return -1;
+        }
+        y = std::max(y, m_Skyline[i].Y);
+        if (y + height > m_Height) {
+            return -1;
+        }
+        remaining -= m_Skyline[i].Width;
+    }
+    return y;
+}
+
+bool SkylinePacker::Pack(int width, int height, Rect& outRect) {
+    if (width <= 0 || height <= 0) {
+        return false;
+    }
+
+    int bestY = INT_MAX;
+    int bestWidth = INT_MAX;
+    size_t bestIndex = m_Skyline.size();
+
+    for (size_t i = 0; i < m_Skyline.size(); ++i) {
+        // The gutter on the right is dropped when the rectangle touches the page edge
+        const int paddedWidth = std::min(width + m_Padding, m_Width - m_Skyline[i].X);
+        if (paddedWidth < width) {
+            continue;
+        }
+
+        const int y = FitAt(i, paddedWidth, height);
+        if (y < 0) {
+            continue;
+        }
+
+        // Lowest placement wins; ties go to the narrowest segment to limit waste
+        if (y < bestY || (y == bestY && m_Skyline[i].Width < bestWidth)) {
+            bestY = y;
+            bestWidth = m_Skyline[i].Width;
+            bestIndex = i;
+        }
+    }
+
+    if (bestIndex == m_Skyline.size()) {
+        return false;
+    }
+
+    const int x = m_Skyline[bestIndex].X;
+    const int usedWidth = std::min(width + m_Padding, m_Width - x);
+    const int usedHeight = std::min(height + m_Padding, m_Height - bestY);
+    Insert(bestIndex, x, bestY, usedWidth, usedHeight);
+    m_UsedArea += static_cast<long long>(usedWidth) * usedHeight;
+
+    outRect.X = x;
+    outRect.Y = bestY;
+    outRect.Width = width;
+    outRect.Height = height;
+    return true;
+}
+
+void SkylinePacker::Insert(size_t index, int x, int y, int width, int height) {
+    m_Skyline.insert(m_Skyline.begin() + static_cast<std::ptrdiff_t>(index), { x, y + height, width });
+
+    // Trim or remove the segments now hidden under the new one
+    for (size_t i = index + 1; i < m_Skyline.size();) {
+        Segment& segment = m_Skyline[i];
+        const int newRight = x + width;
+        if (segment.X >= newRight) {
+            break;
+        }
+
+        const int shrink = newRight - segment.X;
+        if (segment.Width <= shrink) {
+            m_Skyline.erase(m_Skyline.begin() + static_cast<std::ptrdiff_t>(i));
+            continue;
+        }
+        segment.X += shrink;
+        segment.Width -= shrink;
+        break;
+    }
+
+    // Merge neighbours at the same height
+    for (size_t i = 0; i + 1 < m_Skyline.size();) {
+        if (m_Skyline[i].Y == m_Skyline[i + 1].Y) {
+            m_Skyline[i].Width += m_Skyline[i + 1].Width;
+            m_Skyline.erase(m_Skyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+        } else {
+            ++i;
+        }
+    }
+}
@@ -0,0 +1,224 @@
+#include "graphics/SpriteBatch.hpp"
+#include "graphics/GLStateCache.hpp"
+#include "core/Logger.hpp"
+#include <glad/glad.h>
+#include <cstring>
+
+SpriteBatch::SpriteBatch()
+    : m_QuadCount(0)
+    , m_VAO(0), m_VBO(0), m_EBO(0)
+    , m_BufferCursor(0)
+    , m_CurrentShader(nullptr)
+    , m_CurrentTexture(0)
+    , m_Active(false)
+    , m_Initialized(false) {
+}
+
+SpriteBatch::~SpriteBatch() {
+    Shutdown();
+}
+
+bool SpriteBatch::Init(std::shared_ptr<Shader> defaultShader) {
+    if (m_Initialized) {
+        Logger::Warn("SpriteBatch already initialized");
+        return true;
+    }
+
+    if (!defaultShader) {
+        Logger::Error("SpriteBatch requires a default shader");
+        return false;
+    }
+    m_DefaultShader = std::move(defaultShader);
+
+    // Sprites always sample from unit 0
+    m_DefaultShader->Use();
+    m_DefaultShader->SetInt(m_DefaultShader->GetUniform("spriteTexture"), 0);
+
+    const unsigned char white[4] = { 255, 255, 255, 255 };
+    if (!m_WhiteTexture.LoadFromMemory(white, 1, 1, 4)) {
+        Logger::Error("Failed to create SpriteBatch white texture");
+        return false;
+    }
+
+    m_Vertices.resize(MaxVertices);
+    CreateBuffers();
+
+    m_Initialized = true;
+    Logger::Info("SpriteBatch initialized successfully");
+    return true;
+}
+
+void SpriteBatch::Shutdown() {
+    if (!m_Initialized) return;
+
+    CleanupBuffers();
+    m_Vertices.clear();
+    m_Vertices.shrink_to_fit();
+    m_DefaultShader.reset();
+    m_CurrentShader = nullptr;
+    m_Active = false;
+    m_Initialized = false;
+}
+
+void SpriteBatch::CreateBuffers() {
+    // Indices never change, so build them once for the largest possible chunk
+    std::vector<unsigned int> indices(MaxIndices);
+    for (uint32_t quad = 0, vertex = 0; quad < MaxQuads; ++quad, vertex += 4) {
+        unsigned int* index = &indices[quad * 6];
+        index[0] = vertex + 0;
+        index[1] = vertex + 1;
+        index[2] = vertex + 2;
+        index[3] = vertex + 2;
+        index[4] = vertex + 3;
+        index[5] = vertex + 0;
+    }
+
+    glGenVertexArrays(1, &m_VAO);
+    glGenBuffers(1, &m_VBO);
+    glGenBuffers(1, &m_EBO);
+
+    GLStateCache::getInstance().BindVertexArray(m_VAO);
+
+    glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+    glBufferData(GL_ARRAY_BUFFER, MaxVertices * BufferChunks * sizeof(Vertex), nullptr, GL_STREAM_DRAW);
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+
+    // Same attribute layout as Mesh
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Position));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, TexCoords));
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Color));
+
+    m_BufferCursor = 0;
+}
+
+void SpriteBatch::CleanupBuffers() {
+    if (m_VAO != 0) {
+        glDeleteVertexArrays(1, &m_VAO);
+        GLStateCache::getInstance().OnVertexArrayDeleted(m_VAO);
+        m_VAO = 0;
+    }
+    if (m_VBO != 0) {
+        glDeleteBuffers(1, &m_VBO);
+        m_VBO = 0;
+    }
+    if (m_EBO != 0) {
+        glDeleteBuffers(1, &m_EBO);
+        m_EBO = 0;
+    }
+}
+
+void SpriteBatch::Begin() {
+    if (m_Active) {
+        Logger::Warn("SpriteBatch::Begin called twice without End");
+        Flush();
+    }
+
+    m_CurrentShader = m_DefaultShader.get();
+    m_CurrentTexture = m_WhiteTexture.GetID();
+    m_QuadCount = 0;
+    m_Active = true;
+}
+
+void SpriteBatch::End() {
+    if (!m_Active) return;
+
+    Flush();
+    m_Active = false;
+}
+
+void SpriteBatch::SetShader(const Shader* shader) {
+    const Shader* next = shader ? shader : m_DefaultShader.get();
+    if (next != m_CurrentShader) {
+        Flush();
+        m_CurrentShader = next;
+    }
+}
+
+void SpriteBatch::Submit(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color) {
+    const glm::vec2 min = position - size * 0.5f;
+    const glm::vec2 max = position + size * 0.5f;
+
+    const Vertex quad[4] = {
+        Vertex({min.x, min.y, 0.0f}, {0.0f, 0.0f}, color),
+        Vertex({max.x, min.y, 0.0f}, {1.0f, 0.0f}, color),
+        Vertex({max.x, max.y, 0.0f}, {1.0f, 1.0f}, color),
+        Vertex({min.x, max.y, 0.0f}, {0.0f, 1.0f}, color)
+    };
+    SubmitQuad(quad, m_WhiteTexture.GetID());
+}
+
+void SpriteBatch::Submit(const glm::vec2& position, const glm::vec2& size, const Texture& texture,
+                         const glm::vec4& tint, const glm::vec4& uvRect) {
+    const glm::vec2 min = position - size * 0.5f;
+    const glm::vec2 max = position + size * 0.5f;
+
+    const Vertex quad[4] = {
+        Vertex({min.x, min.y, 0.0f}, {uvRect.x, uvRect.y}, tint),
+        Vertex({max.x, min.y, 0.0f}, {uvRect.z, uvRect.y}, tint),
+        Vertex({max.x, max.y, 0.0f}, {uvRect.z, uvRect.w}, tint),
+        Vertex({min.x, max.y, 0.0f}, {uvRect.x, uvRect.w}, tint)
+    };
+    SubmitQuad(quad, texture.GetID());
+}
+
+void SpriteBatch::SubmitQuad(const Vertex* vertices, unsigned int textureID) {
+    if (!m_Active) {
+        Logger::Warn("SpriteBatch::Submit called outside Begin/End");
+        return;
+    }
+
+    if (textureID != m_CurrentTexture) {
+        Flush();
+        m_CurrentTexture = textureID;
+    }
+    if (m_QuadCount == MaxQuads) {
+        Flush();
+    }
+
+    std::memcpy(&m_Vertices[m_QuadCount * 4], vertices, 4 * sizeof(Vertex));
+    ++m_QuadCount;
+}
+
+void SpriteBatch::Flush() {
+    if (m_QuadCount == 0 || !m_CurrentShader) return;
+
+    const uint32_t vertexCount = m_QuadCount * 4;
+    const GLsizeiptr bytes = vertexCount * sizeof(Vertex);
+
+    GLStateCache::getInstance().BindVertexArray(m_VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+
+    // Append to the streaming buffer; orphan it once it is full so the driver
+    // can hand us fresh storage instead of waiting on in-flight draws
+    if (m_BufferCursor + vertexCount > MaxVertices * BufferChunks) {
+        glBufferData(GL_ARRAY_BUFFER, MaxVertices * BufferChunks * sizeof(Vertex), nullptr, GL_STREAM_DRAW);
+        m_BufferCursor = 0;
+    }
+
+    void* dst = glMapBufferRange(GL_ARRAY_BUFFER, m_BufferCursor * sizeof(Vertex), bytes,
+                                 GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    if (!dst) {
+        Logger::Error("SpriteBatch failed to map vertex buffer");
+        m_QuadCount = 0;
+        return;
+    }
+    std::memcpy(dst, m_Vertices.data(), bytes);
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+
+    m_CurrentShader->Use();
+
+    GLStateCache::getInstance().BindTexture(0, m_CurrentTexture);
+
+    glDrawElementsBaseVertex(GL_TRIANGLES, static_cast<GLsizei>(m_QuadCount * 6), GL_UNSIGNED_INT,
+                             nullptr, static_cast<GLint>(m_BufferCursor));
+
+    m_BufferCursor += vertexCount;
+    m_Stats.DrawCalls++;
+    m_Stats.QuadCount += m_QuadCount;
+    m_QuadCount = 0;
+}
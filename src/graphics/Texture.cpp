@@ -1,7 +1,35 @@
 #include "graphics/Texture.hpp"
+#include "graphics/GLStateCache.hpp"
 #include "core/Logger.hpp"
 #include <glad/glad.h>
+#include "graphics/TextureFormat.hpp"
+#include "core/MappedFile.hpp"
 #include <stb_image.h>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#ifdef PLATFORMER_WITH_LZ4
+    #include <lz4.h>
+#endif
+
+namespace {
+    bool GetPixelFormat(int channels, GLenum& format) {
+        switch (channels) {
+            case 1: format = GL_RED; return true;
+            case 3: format = GL_RGB; return true;
+            case 4: format = GL_RGBA; return true;
+            default:
+                LOG_ERROR("Unsupported texture channel count: {}", channels);
+                return false;
+        }
+    }
+
+    bool EndsWith(const std::string& str, const char* suffix) {
+        const size_t length = std::strlen(suffix);
+        return str.size() >= length && str.compare(str.size() - length, length, suffix) == 0;
+    }
+}
 
 Texture::Texture()
     : m_TextureID(0), m_Width(0), m_Height(0), m_Channels(0) {
@@ -12,6 +40,11 @@ Texture::~Texture() {
 }
 
 bool Texture::loadFromFile(const std::string& path) {
+    // Cooked textures skip decoding and mip generation entirely
+    if (EndsWith(path, TextureFormat::Extension)) {
+        return LoadFromContainer(path);
+    }
+
     // Load image data
     stbi_set_flip_vertically_on_load(true);
     unsigned char* data = stbi_load(path.c_str(), &m_Width, &m_Height, &m_Channels, 0);
@@ -21,9 +54,51 @@ bool Texture::loadFromFile(const std::string& path) {
         return false;
     }
 
+    bool uploaded = LoadFromMemory(data, m_Width, m_Height, m_Channels);
+
+    // Free image data
+    stbi_image_free(data);
+
+    if (!uploaded) {
+        Logger::Error("Failed to upload texture: " + path);
+        return false;
+    }
+
+    this->path = path;
+    Logger::Info("Successfully loaded texture: " + path);
+    return true;
+}
+
+bool Texture::LoadFromMemory(const unsigned char* data, int width, int height, int channels) {
+    if (!data) {
+        return false;
+    }
+    return Upload(data, width, height, channels);
+}
+
+bool Texture::LoadFromPixelBuffer(size_t offset, int width, int height, int channels) {
+    // With an unpack buffer bound, the pointer argument is an offset into it
+    return Upload(reinterpret_cast<const void*>(offset), width, height, channels);
+}
+
+bool Texture::Upload(const void* pixels, int width, int height, int channels) {
+    if (width <= 0 || height <= 0) {
+        return false;
+    }
+
+    GLenum format;
+    if (!GetPixelFormat(channels, format)) {
+        return false;
+    }
+
+    Cleanup();
+    m_Width = width;
+    m_Height = height;
+    m_Channels = channels;
+
     // Create texture
     glGenTextures(1, &m_TextureID);
-    glBindTexture(GL_TEXTURE_2D, m_TextureID);
+    GLStateCache::getInstance().BindTexture(0, m_TextureID);
 
     // Set texture parameters
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
@@ -31,30 +106,128 @@ bool Texture::loadFromFile(const std::string& path) {
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
-    // Upload texture data
-    GLenum format = (m_Channels == 4) ? GL_RGBA : GL_RGB;
-    glTexImage2D(GL_TEXTURE_2D, 0, format, m_Width, m_Height, 0, format, GL_UNSIGNED_BYTE, data);
+    // Upload texture data (rows of 1/3 channel images are not 4-byte aligned)
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, pixels);
     glGenerateMipmap(GL_TEXTURE_2D);
 
-    // Free image data
-    stbi_image_free(data);
+    return true;
+}
+
+bool Texture::LoadFromContainer(const std::string& path) {
+    MappedFile file;
+    if (!file.Open(path)) {
+        Logger::Error("Failed to open cooked texture: " + path);
+        return false;
+    }
+
+    const uint8_t* data = file.GetData();
+    const size_t size = file.GetSize();
+
+    TextureFileHeader header;
+    if (size < sizeof(header)) {
+        Logger::Error("Cooked texture is truncated: " + path);
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+
+    GLenum format;
+    if (std::memcmp(header.Magic, TextureFormat::Magic, sizeof(header.Magic)) != 0 ||
+        header.Version != TextureFormat::Version || header.MipCount == 0 ||
+        !GetPixelFormat(static_cast<int>(header.Channels), format)) {
+        Logger::Error("Not a cooked texture (or wrong version): " + path);
+        return false;
+    }
+
+    const auto compression = static_cast<TextureFormat::Compression>(header.Compression);
+#ifndef PLATFORMER_WITH_LZ4
+    if (compression == TextureFormat::Compression::LZ4) {
+        Logger::Error("Cooked texture is LZ4-compressed but LZ4 support is not built in: " + path);
+        return false;
+    }
+#endif
+    if (compression != TextureFormat::Compression::None && compression != TextureFormat::Compression::LZ4) {
+        Logger::Error("Unknown compression in cooked texture: " + path);
+        return false;
+    }
+
+    // Validate the whole mip table before touching GL
+    if (sizeof(header) + uint64_t(header.MipCount) * sizeof(TextureMipEntry) > size) {
+        Logger::Error("Cooked texture is truncated: " + path);
+        return false;
+    }
+    std::vector<TextureMipEntry> mips(header.MipCount);
+    std::memcpy(mips.data(), data + sizeof(header), mips.size() * sizeof(TextureMipEntry));
+
+    size_t largestLevel = 0;
+    for (const TextureMipEntry& mip : mips) {
+        const uint64_t expected = uint64_t(mip.Width) * mip.Height * header.Channels;
+        // Written so a huge Offset cannot wrap the sum back into range
+        if (mip.Offset > size || mip.StoredSize > size - mip.Offset || mip.Size != expected ||
+            (compression == TextureFormat::Compression::None && mip.StoredSize != mip.Size)) {
+            Logger::Error("Cooked texture is corrupt: " + path);
+            return false;
+        }
+        largestLevel = std::max<size_t>(largestLevel, mip.Size);
+    }
+
+    Cleanup();
+    m_Width = static_cast<int>(header.Width);
+    m_Height = static_cast<int>(header.Height);
+    m_Channels = static_cast<int>(header.Channels);
+
+    glGenTextures(1, &m_TextureID);
+    GLStateCache::getInstance().BindTexture(0, m_TextureID);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, header.MipCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(header.MipCount - 1));
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    // Uncompressed levels go to GL straight from the mapping
+    std::vector<char> scratch;
+    for (uint32_t level = 0; level < header.MipCount; ++level) {
+        const TextureMipEntry& mip = mips[level];
+        const void* pixels = data + mip.Offset;
+
+#ifdef PLATFORMER_WITH_LZ4
+        if (compression == TextureFormat::Compression::LZ4) {
+            scratch.resize(largestLevel);
+            const int decoded = LZ4_decompress_safe(static_cast<const char*>(pixels), scratch.data(),
+                                                    static_cast<int>(mip.StoredSize), static_cast<int>(mip.Size));
+            if (decoded != static_cast<int>(mip.Size)) {
+                Logger::Error("Failed to decompress cooked texture: " + path);
+                Cleanup();
+                return false;
+            }
+            pixels = scratch.data();
+        }
+#endif
+
+        glTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(level), format, static_cast<GLsizei>(mip.Width),
+                     static_cast<GLsizei>(mip.Height), 0, format, GL_UNSIGNED_BYTE, pixels);
+    }
 
+    this->path = path;
     Logger::Info("Successfully loaded texture: " + path);
     return true;
 }
 
 void Texture::Bind(unsigned int slot) const {
-    glActiveTexture(GL_TEXTURE0 + slot);
-    glBindTexture(GL_TEXTURE_2D, m_TextureID);
+    GLStateCache::getInstance().BindTexture(slot, m_TextureID);
 }
 
-void Texture::Unbind() const {
-    glBindTexture(GL_TEXTURE_2D, 0);
+void Texture::Unbind(unsigned int slot) const {
+    GLStateCache::getInstance().BindTexture(slot, 0);
 }
 
 void Texture::Cleanup() {
     if (m_TextureID != 0) {
         glDeleteTextures(1, &m_TextureID);
+        GLStateCache::getInstance().OnTextureDeleted(m_TextureID);
         m_TextureID = 0;
     }
 }
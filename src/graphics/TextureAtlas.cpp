@@ -0,0 +1,218 @@
+#include "graphics/TextureAtlas.hpp"
+#include "graphics/AtlasBuilder.hpp"
+#include "core/ResourceManager.hpp"
+#include "core/Logger.hpp"
+#include "utils/Hash.hpp"
+#include <stb_image.h>
+#include <algorithm>
+#include <cstring>
+
+namespace {
+    std::string GetDirectory(const std::string& path) {
+        const size_t slash = path.find_last_of("/\\");
+        return slash == std::string::npos ? std::string() : path.substr(0, slash + 1);
+    }
+}
+
+TextureAtlas::TextureAtlas()
+    : m_Regions(nullptr), m_RegionCount(0)
+    , m_Strings(nullptr), m_StringsSize(0) {
+}
+
+void TextureAtlas::Clear() {
+    m_Index.Close();
+    m_OwnedRegions.clear();
+    m_OwnedStrings.clear();
+    m_Regions = nullptr;
+    m_RegionCount = 0;
+    m_Strings = nullptr;
+    m_StringsSize = 0;
+    m_Pages.clear();
+}
+
+bool TextureAtlas::loadFromFile(const std::string& path) {
+    Clear();
+
+    if (!m_Index.Open(path)) {
+        Logger::Error("Failed to open texture atlas: " + path);
+        return false;
+    }
+
+    const uint8_t* data = m_Index.GetData();
+    const size_t size = m_Index.GetSize();
+
+    AtlasFileHeader header;
+    if (size < sizeof(header)) {
+        Logger::Error("Texture atlas is truncated: " + path);
+        Clear();
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+
+    if (std::memcmp(header.Magic, AtlasFormat::Magic, sizeof(header.Magic)) != 0 ||
+        header.Version != AtlasFormat::Version) {
+        Logger::Error("Not a texture atlas index (or wrong version): " + path);
+        Clear();
+        return false;
+    }
+
+    const uint64_t pageTableEnd = header.PageTableOffset + uint64_t(header.PageCount) * sizeof(AtlasPageEntry);
+    const uint64_t regionTableEnd = header.RegionTableOffset + uint64_t(header.RegionCount) * sizeof(AtlasRegionEntry);
+    const uint64_t stringTableEnd = header.StringTableOffset + uint64_t(header.StringTableSize);
+    if (pageTableEnd > size || regionTableEnd > size || stringTableEnd > size ||
+        header.RegionTableOffset % alignof(AtlasRegionEntry) != 0 ||
+        header.StringTableSize == 0 || data[stringTableEnd - 1] != '\0') {
+        Logger::Error("Texture atlas index is corrupt: " + path);
+        Clear();
+        return false;
+    }
+
+    // The region table is used in place; nothing is copied out of the mapping
+    m_Regions = reinterpret_cast<const AtlasRegionEntry*>(data + header.RegionTableOffset);
+    m_RegionCount = header.RegionCount;
+    m_Strings = reinterpret_cast<const char*>(data + header.StringTableOffset);
+    m_StringsSize = header.StringTableSize;
+
+    // Page images are ordinary textures, shared through the ResourceManager
+    ResourceManager& resources = ResourceManager::getInstance();
+    const std::string directory = GetDirectory(path);
+    for (uint32_t i = 0; i < header.PageCount; ++i) {
+        AtlasPageEntry page;
+        std::memcpy(&page, data + header.PageTableOffset + i * sizeof(AtlasPageEntry), sizeof(page));
+        if (page.PathOffset >= m_StringsSize) {
+            Logger::Error("Texture atlas index is corrupt: " + path);
+            Clear();
+            return false;
+        }
+
+        const std::string pagePath = directory + (m_Strings + page.PathOffset);
+        if (!resources.hasResource<Texture>(pagePath)) {
+            resources.loadResource<Texture>(pagePath, pagePath);
+        }
+        std::shared_ptr<Texture> texture = resources.getResource<Texture>(pagePath);
+        if (!texture) {
+            Clear();
+            return false;
+        }
+        m_Pages.push_back(std::move(texture));
+    }
+
+    this->path = path;
+    LOG_INFO("Loaded texture atlas {} ({} regions, {} pages)", path, m_RegionCount, m_Pages.size());
+    return true;
+}
+
+bool TextureAtlas::Build(const std::string& name, const std::vector<std::pair<std::string, std::string>>& sprites,
+                         int pageSize, int padding) {
+    Clear();
+
+    // Decode everything as RGBA so all pages share one format
+    std::vector<AtlasBuilder::Image> images;
+    images.reserve(sprites.size());
+    bool decoded = true;
+
+    // Per-thread flag, like AsyncTextureLoader: the global one would race with its workers
+    stbi_set_flip_vertically_on_load_thread(true);
+    for (const auto& sprite : sprites) {
+        AtlasBuilder::Image image;
+        int channels = 0;
+        image.Name = sprite.first;
+        image.Pixels = stbi_load(sprite.second.c_str(), &image.Width, &image.Height, &channels, 4);
+        if (!image.Pixels) {
+            Logger::Error("Failed to load atlas image: " + sprite.second);
+            decoded = false;
+            break;
+        }
+        images.push_back(std::move(image));
+    }
+
+    AtlasBuilder builder(pageSize, padding);
+    const bool built = decoded && builder.Build(images);
+
+    for (AtlasBuilder::Image& image : images) {
+        stbi_image_free(const_cast<unsigned char*>(image.Pixels));
+    }
+
+    if (!built) {
+        Logger::Error("Failed to build texture atlas: " + name);
+        return false;
+    }
+
+    // Lay the regions out exactly like a mapped index so lookups share one path
+    for (const AtlasBuilder::Region& region : builder.GetRegions()) {
+        const AtlasBuilder::Page& page = builder.GetPages()[region.Page];
+        AtlasRegionEntry entry;
+        entry.NameHash = HashString(region.Name);
+        entry.NameOffset = static_cast<uint32_t>(m_OwnedStrings.size());
+        entry.Page = region.Page;
+        entry.U0 = static_cast<float>(region.Rect.X) / page.Width;
+        entry.V0 = static_cast<float>(region.Rect.Y) / page.Height;
+        entry.U1 = static_cast<float>(region.Rect.X + region.Rect.Width) / page.Width;
+        entry.V1 = static_cast<float>(region.Rect.Y + region.Rect.Height) / page.Height;
+        entry.Width = static_cast<uint32_t>(region.Rect.Width);
+        entry.Height = static_cast<uint32_t>(region.Rect.Height);
+        m_OwnedRegions.push_back(entry);
+
+        m_OwnedStrings.insert(m_OwnedStrings.end(), region.Name.begin(), region.Name.end());
+        m_OwnedStrings.push_back('\0');
+    }
+    std::sort(m_OwnedRegions.begin(), m_OwnedRegions.end(), [](const AtlasRegionEntry& a, const AtlasRegionEntry& b) {
+        return a.NameHash < b.NameHash;
+    });
+
+    m_Regions = m_OwnedRegions.data();
+    m_RegionCount = m_OwnedRegions.size();
+    m_Strings = m_OwnedStrings.data();
+    m_StringsSize = m_OwnedStrings.size();
+
+    ResourceManager& resources = ResourceManager::getInstance();
+    const auto& pages = builder.GetPages();
+    for (size_t i = 0; i < pages.size(); ++i) {
+        auto texture = std::make_shared<Texture>();
+        if (!texture->LoadFromMemory(pages[i].Pixels.data(), pages[i].Width, pages[i].Height, 4)) {
+            Logger::Error("Failed to upload texture atlas page for: " + name);
+            Clear();
+            return false;
+        }
+        resources.addResource<Texture>(name + "#" + std::to_string(i), texture);
+        m_Pages.push_back(std::move(texture));
+    }
+
+    this->path = name;
+    LOG_INFO("Built texture atlas {} ({} regions, {} pages)", name, m_RegionCount, m_Pages.size());
+    return true;
+}
+
+const AtlasRegionEntry* TextureAtlas::FindEntry(const std::string& name) const {
+    const uint64_t hash = HashString(name);
+    const AtlasRegionEntry* end = m_Regions + m_RegionCount;
+    const AtlasRegionEntry* it = std::lower_bound(m_Regions, end, hash,
+        [](const AtlasRegionEntry& entry, uint64_t value) { return entry.NameHash < value; });
+
+    // Confirm the name so a hash collision never returns the wrong sprite
+    for (; it != end && it->NameHash == hash; ++it) {
+        if (it->NameOffset < m_StringsSize && name == (m_Strings + it->NameOffset)) {
+            return it;
+        }
+    }
+    return nullptr;
+}
+
+bool TextureAtlas::GetRegion(const std::string& name, Region& outRegion) const {
+    const AtlasRegionEntry* entry = FindEntry(name);
+    if (!entry) return false;
+
+    outRegion.Page = entry->Page;
+    outRegion.UVRect = glm::vec4(entry->U0, entry->V0, entry->U1, entry->V1);
+    outRegion.Width = static_cast<int>(entry->Width);
+    outRegion.Height = static_cast<int>(entry->Height);
+    return true;
+}
+
+bool TextureAtlas::HasRegion(const std::string& name) const {
+    return FindEntry(name) != nullptr;
+}
+
+const Texture* TextureAtlas::GetPage(uint32_t index) const {
+    return index < m_Pages.size() ? m_Pages[index].get() : nullptr;
+}
@@ -0,0 +1,138 @@
+#include "graphics/TextureCooker.hpp"
+#include "graphics/TextureFormat.hpp"
+#include "core/Logger.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#ifdef PLATFORMER_WITH_LZ4
+    #include <lz4.h>
+    #include <lz4hc.h>
+#endif
+
+std::vector<TextureCooker::MipLevel> TextureCooker::BuildMipChain(const unsigned char* pixels, int width, int height,
+                                                                  int channels) {
+    std::vector<MipLevel> mips;
+    if (!pixels || width <= 0 || height <= 0 || channels <= 0) {
+        return mips;
+    }
+
+    MipLevel base;
+    base.Width = width;
+    base.Height = height;
+    base.Pixels.assign(pixels, pixels + static_cast<size_t>(width) * height * channels);
+    mips.push_back(std::move(base));
+
+    while (mips.back().Width > 1 || mips.back().Height > 1) {
+        const MipLevel& src = mips.back();
+        MipLevel dst;
+        dst.Width = std::max(1, src.Width / 2);
+        dst.Height = std::max(1, src.Height / 2);
+        dst.Pixels.resize(static_cast<size_t>(dst.Width) * dst.Height * channels);
+
+        // Odd edges clamp, so the last row/column is weighted a little more
+        for (int y = 0; y < dst.Height; ++y) {
+            const int y0 = std::min(y * 2, src.Height - 1);
+            const int y1 = std::min(y * 2 + 1, src.Height - 1);
+            for (int x = 0; x < dst.Width; ++x) {
+                const int x0 = std::min(x * 2, src.Width - 1);
+                const int x1 = std::min(x * 2 + 1, src.Width - 1);
+                for (int c = 0; c < channels; ++c) {
+                    auto at = [&src, channels, c](int px, int py) {
+                        return static_cast<int>(src.Pixels[(static_cast<size_t>(py) * src.Width + px) * channels + c]);
+                    };
+                    const int sum = at(x0, y0) + at(x1, y0) + at(x0, y1) + at(x1, y1);
+                    dst.Pixels[(static_cast<size_t>(y) * dst.Width + x) * channels + c] = static_cast<unsigned char>((sum + 2) / 4);
+                }
+            }
+        }
+        mips.push_back(std::move(dst));
+    }
+
+    return mips;
+}
+
+bool TextureCooker::Write(const std::string& path, const std::vector<MipLevel>& mips, int channels, bool compress) {
+    if (mips.empty() || (channels != 1 && channels != 3 && channels != 4)) {
+        LOG_ERROR("Cannot cook texture {}: no mip levels or unsupported channel count {}", path, channels);
+        return false;
+    }
+
+    if (compress && !IsCompressionAvailable()) {
+        Logger::Warn("Built without LZ4; writing uncompressed texture: " + path);
+        compress = false;
+    }
+
+    auto align16 = [](uint64_t value) { return (value + 15) & ~static_cast<uint64_t>(15); };
+
+    std::vector<TextureMipEntry> entries(mips.size());
+    std::vector<std::vector<char>> payloads(mips.size());
+    uint64_t offset = align16(sizeof(TextureFileHeader) + mips.size() * sizeof(TextureMipEntry));
+
+    for (size_t i = 0; i < mips.size(); ++i) {
+        const MipLevel& mip = mips[i];
+        const char* raw = reinterpret_cast<const char*>(mip.Pixels.data());
+        const int rawSize = static_cast<int>(mip.Pixels.size());
+
+        std::vector<char>& payload = payloads[i];
+#ifdef PLATFORMER_WITH_LZ4
+        if (compress) {
+            payload.resize(static_cast<size_t>(LZ4_compressBound(rawSize)));
+            const int compressedSize = LZ4_compress_HC(raw, payload.data(), rawSize,
+                                                       static_cast<int>(payload.size()), LZ4HC_CLEVEL_DEFAULT);
+            if (compressedSize <= 0) {
+                LOG_ERROR("LZ4 compression failed for mip {} of {}", i, path);
+                return false;
+            }
+            payload.resize(static_cast<size_t>(compressedSize));
+        }
+#endif
+        if (!compress) {
+            payload.assign(raw, raw + rawSize);
+        }
+
+        entries[i].Offset = offset;
+        entries[i].StoredSize = static_cast<uint32_t>(payload.size());
+        entries[i].Size = static_cast<uint32_t>(rawSize);
+        entries[i].Width = static_cast<uint32_t>(mip.Width);
+        entries[i].Height = static_cast<uint32_t>(mip.Height);
+        offset = align16(offset + payload.size());
+    }
+
+    TextureFileHeader header;
+    std::memcpy(header.Magic, TextureFormat::Magic, sizeof(header.Magic));
+    header.Version = TextureFormat::Version;
+    header.Width = static_cast<uint32_t>(mips[0].Width);
+    header.Height = static_cast<uint32_t>(mips[0].Height);
+    header.Channels = static_cast<uint32_t>(channels);
+    header.MipCount = static_cast<uint32_t>(mips.size());
+    header.Compression = static_cast<uint32_t>(compress ? TextureFormat::Compression::LZ4 : TextureFormat::Compression::None);
+    header.Reserved = 0;
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        LOG_ERROR("Failed to open cooked texture for writing: {}", path);
+        return false;
+    }
+
+    const char zeros[16] = {};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(TextureMipEntry)));
+
+    uint64_t written = sizeof(header) + entries.size() * sizeof(TextureMipEntry);
+    for (size_t i = 0; i < payloads.size(); ++i) {
+        file.write(zeros, static_cast<std::streamsize>(entries[i].Offset - written));
+        file.write(payloads[i].data(), static_cast<std::streamsize>(payloads[i].size()));
+        written = entries[i].Offset + payloads[i].size();
+    }
+
+    return static_cast<bool>(file);
+}
+
+bool TextureCooker::IsCompressionAvailable() {
+#ifdef PLATFORMER_WITH_LZ4
+    return true;
+#else
+    return false;
+#endif
+}
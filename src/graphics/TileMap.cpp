@@ -0,0 +1,267 @@
+#include "graphics/TileMap.hpp"
+#include "graphics/Camera2D.hpp"
+#include "graphics/GLStateCache.hpp"
+#include "graphics/Renderer.hpp"
+#include "core/Profiler.hpp"
+#include <glad/glad.h>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr uint32_t QuadsPerChunk = TileMap::ChunkSize * TileMap::ChunkSize;
+    constexpr uint32_t WhiteColor = 0xFFFFFFFFu;
+}
+
+glm::vec4 Tileset::GetTileUV(TileId tile) const {
+    const int columns = std::max(Columns, 1);
+    const int rows = std::max(Rows, 1);
+    const int cell = (tile - 1) % (columns * rows);
+    const int column = cell % columns;
+    const int row = cell / columns;
+
+    // Row 0 is the top of the image, which is the top of the v range
+    const float width = (UVRect.z - UVRect.x) / columns;
+    const float height = (UVRect.w - UVRect.y) / rows;
+    const float u0 = UVRect.x + column * width;
+    const float top = UVRect.w - row * height;
+    return glm::vec4(u0, top - height, u0 + width, top);
+}
+
+TileMap::TileMap(int width, int height, float tileSize, const glm::vec2& origin)
+    : m_Width(std::max(width, 0))
+    , m_Height(std::max(height, 0))
+    , m_TileSize(tileSize)
+    , m_Origin(origin)
+    , m_ChunksX((m_Width + ChunkSize - 1) / ChunkSize)
+    , m_ChunksY((m_Height + ChunkSize - 1) / ChunkSize)
+    , m_IndexBuffer(0)
+    , m_MaxResidentChunks(DefaultMaxResidentChunks)
+    , m_DrawCounter(0) {
+    m_Tiles.assign(static_cast<size_t>(m_Width) * m_Height, EmptyTile);
+    m_Chunks.resize(static_cast<size_t>(m_ChunksX) * m_ChunksY);
+}
+
+TileMap::~TileMap() {
+    ReleaseGpuResources();
+}
+
+void TileMap::SetTileset(const Tileset& tileset) {
+    m_Tileset = tileset;
+    // Every baked UV depends on the tileset layout
+    MarkAllDirty();
+}
+
+TileId TileMap::GetTile(int x, int y) const {
+    if (x < 0 || y < 0 || x >= m_Width || y >= m_Height) return EmptyTile;
+    return m_Tiles[static_cast<size_t>(y) * m_Width + x];
+}
+
+void TileMap::SetTile(int x, int y, TileId tile) {
+    if (x < 0 || y < 0 || x >= m_Width || y >= m_Height) return;
+
+    TileId& current = m_Tiles[static_cast<size_t>(y) * m_Width + x];
+    if (current == tile) return;
+
+    current = tile;
+    m_Chunks[static_cast<size_t>(y / ChunkSize) * m_ChunksX + x / ChunkSize].Dirty = true;
+}
+
+void TileMap::Fill(int x, int y, int width, int height, TileId tile) {
+    const int minX = std::max(x, 0);
+    const int minY = std::max(y, 0);
+    const int maxX = std::min(x + width, m_Width);
+    const int maxY = std::min(y + height, m_Height);
+
+    for (int tileY = minY; tileY < maxY; ++tileY) {
+        for (int tileX = minX; tileX < maxX; ++tileX) {
+            SetTile(tileX, tileY, tile);
+        }
+    }
+}
+
+void TileMap::Draw(const glm::vec2& viewMin, const glm::vec2& viewMax) {
+    PROFILE_FUNCTION();
+    if (m_Chunks.empty()) return;
+
+    // Chunk range overlapping the view, clamped to the map
+    const float chunkWorldSize = m_TileSize * ChunkSize;
+    const int firstX = std::max(static_cast<int>(std::floor((viewMin.x - m_Origin.x) / chunkWorldSize)), 0);
+    const int firstY = std::max(static_cast<int>(std::floor((viewMin.y - m_Origin.y) / chunkWorldSize)), 0);
+    const int lastX = std::min(static_cast<int>(std::floor((viewMax.x - m_Origin.x) / chunkWorldSize)), m_ChunksX - 1);
+    const int lastY = std::min(static_cast<int>(std::floor((viewMax.y - m_Origin.y) / chunkWorldSize)), m_ChunksY - 1);
+    if (firstX > lastX || firstY > lastY) return;
+
+    if (m_IndexBuffer == 0) {
+        CreateIndexBuffer();
+    }
+
+    ++m_DrawCounter;
+    Renderer& renderer = Renderer::getInstance();
+    const Texture* texture = m_Tileset.Sheet.get();
+
+    for (int chunkY = firstY; chunkY <= lastY; ++chunkY) {
+        for (int chunkX = firstX; chunkX <= lastX; ++chunkX) {
+            const uint32_t index = static_cast<uint32_t>(chunkY * m_ChunksX + chunkX);
+            Chunk& chunk = m_Chunks[index];
+            ++m_Stats.ChunksVisible;
+
+            if (chunk.Dirty) {
+                RebuildChunk(index);
+                ++m_Stats.ChunksRebuilt;
+            }
+            if (chunk.QuadCount == 0) continue;
+
+            chunk.LastDrawn = m_DrawCounter;
+            renderer.DrawIndexed(chunk.VAO, static_cast<size_t>(chunk.QuadCount) * 6, texture);
+            ++m_Stats.DrawCalls;
+            m_Stats.TilesDrawn += chunk.QuadCount;
+        }
+    }
+}
+
+void TileMap::Draw(const Camera2D& camera) {
+    const AABB& view = camera.GetViewBounds();
+    Draw(view.Min, view.Max);
+}
+
+void TileMap::RebuildChunk(uint32_t index) {
+    Chunk& chunk = m_Chunks[index];
+    chunk.Dirty = false;
+
+    const int chunkX = static_cast<int>(index % m_ChunksX);
+    const int chunkY = static_cast<int>(index / m_ChunksX);
+    const int beginX = chunkX * ChunkSize;
+    const int beginY = chunkY * ChunkSize;
+    const int endX = std::min(beginX + ChunkSize, m_Width);
+    const int endY = std::min(beginY + ChunkSize, m_Height);
+
+    m_Scratch.clear();
+    for (int y = beginY; y < endY; ++y) {
+        const TileId* row = &m_Tiles[static_cast<size_t>(y) * m_Width];
+        for (int x = beginX; x < endX; ++x) {
+            if (row[x] == EmptyTile) continue;
+
+            const glm::vec4 uv = m_Tileset.GetTileUV(row[x]);
+            const glm::vec2 min = m_Origin + glm::vec2(x, y) * m_TileSize;
+            const glm::vec2 max = min + glm::vec2(m_TileSize);
+
+            // Same corner order as SpriteBatch, to match the shared indices
+            m_Scratch.push_back({ { min.x, min.y }, { uv.x, uv.y }, WhiteColor });
+            m_Scratch.push_back({ { max.x, min.y }, { uv.z, uv.y }, WhiteColor });
+            m_Scratch.push_back({ { max.x, max.y }, { uv.z, uv.w }, WhiteColor });
+            m_Scratch.push_back({ { min.x, max.y }, { uv.x, uv.w }, WhiteColor });
+        }
+    }
+
+    chunk.QuadCount = static_cast<uint32_t>(m_Scratch.size() / 4);
+    if (chunk.QuadCount == 0) {
+        // Nothing to draw, so nothing worth keeping on the GPU
+        ReleaseChunk(chunk);
+        m_Resident.erase(std::remove(m_Resident.begin(), m_Resident.end(), index), m_Resident.end());
+        return;
+    }
+
+    if (chunk.VAO == 0) {
+        if (m_Resident.size() >= m_MaxResidentChunks) {
+            EvictLeastRecentlyDrawn();
+        }
+
+        glGenVertexArrays(1, &chunk.VAO);
+        glGenBuffers(1, &chunk.VBO);
+        GLStateCache::getInstance().BindVertexArray(chunk.VAO);
+
+        glBindBuffer(GL_ARRAY_BUFFER, chunk.VBO);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IndexBuffer);
+
+        // Sprite shader inputs; z and w of the position default to 0 and 1
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(TileVertex), (void*)offsetof(TileVertex, Position));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(TileVertex), (void*)offsetof(TileVertex, TexCoords));
+        glEnableVertexAttribArray(2);
+        glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(TileVertex), (void*)offsetof(TileVertex, Color));
+
+        m_Resident.push_back(index);
+    } else {
+        glBindBuffer(GL_ARRAY_BUFFER, chunk.VBO);
+    }
+
+    glBufferData(GL_ARRAY_BUFFER, m_Scratch.size() * sizeof(TileVertex), m_Scratch.data(), GL_STATIC_DRAW);
+}
+
+void TileMap::EvictLeastRecentlyDrawn() {
+    auto oldest = std::min_element(m_Resident.begin(), m_Resident.end(), [this](uint32_t a, uint32_t b) {
+        return m_Chunks[a].LastDrawn < m_Chunks[b].LastDrawn;
+    });
+    if (oldest == m_Resident.end()) return;
+
+    // Keeps its tiles; it is baked again when it comes back into view
+    Chunk& chunk = m_Chunks[*oldest];
+    ReleaseChunk(chunk);
+    chunk.Dirty = true;
+    m_Resident.erase(oldest);
+}
+
+void TileMap::ReleaseChunk(Chunk& chunk) {
+    if (chunk.VAO != 0) {
+        glDeleteVertexArrays(1, &chunk.VAO);
+        GLStateCache::getInstance().OnVertexArrayDeleted(chunk.VAO);
+        chunk.VAO = 0;
+    }
+    if (chunk.VBO != 0) {
+        glDeleteBuffers(1, &chunk.VBO);
+        chunk.VBO = 0;
+    }
+}
+
+void TileMap::ReleaseGpuResources() {
+    for (uint32_t index : m_Resident) {
+        ReleaseChunk(m_Chunks[index]);
+    }
+    m_Resident.clear();
+    MarkAllDirty();
+
+    if (m_IndexBuffer != 0) {
+        glDeleteBuffers(1, &m_IndexBuffer);
+        m_IndexBuffer = 0;
+    }
+}
+
+void TileMap::CreateIndexBuffer() {
+    std::vector<unsigned int> indices(QuadsPerChunk * 6);
+    for (uint32_t quad = 0, vertex = 0; quad < QuadsPerChunk; ++quad, vertex += 4) {
+        unsigned int* index = &indices[quad * 6];
+        index[0] = vertex + 0;
+        index[1] = vertex + 1;
+        index[2] = vertex + 2;
+        index[3] = vertex + 2;
+        index[4] = vertex + 3;
+        index[5] = vertex + 0;
+    }
+
+    // Bind no VAO so the element binding lands in none of the chunks' state
+    GLStateCache::getInstance().BindVertexArray(0);
+    glGenBuffers(1, &m_IndexBuffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IndexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+}
+
+void TileMap::MarkAllDirty() {
+    for (Chunk& chunk : m_Chunks) {
+        chunk.Dirty = true;
+    }
+}
+
+glm::ivec2 TileMap::WorldToTile(const glm::vec2& position) const {
+    const glm::vec2 local = (position - m_Origin) / m_TileSize;
+    return glm::ivec2(static_cast<int>(std::floor(local.x)), static_cast<int>(std::floor(local.y)));
+}
+
+glm::vec2 TileMap::TileToWorld(int x, int y) const {
+    return m_Origin + glm::vec2(x, y) * m_TileSize;
+}
+
+bool TileMap::IsChunkDirty(int chunkX, int chunkY) const {
+    if (chunkX < 0 || chunkY < 0 || chunkX >= m_ChunksX || chunkY >= m_ChunksY) return false;
+    return m_Chunks[static_cast<size_t>(chunkY) * m_ChunksX + chunkX].Dirty;
+}
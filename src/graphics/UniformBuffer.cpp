@@ -0,0 +1,31 @@
+#include "graphics/UniformBuffer.hpp"
+#include "core/Logger.hpp"
+#include <glad/glad.h>
+
+UniformBuffer::UniformBuffer(size_t size, unsigned int bindingPoint)
+    : m_UBO(0), m_BindingPoint(bindingPoint), m_Size(size) {
+    glGenBuffers(1, &m_UBO);
+    glBindBuffer(GL_UNIFORM_BUFFER, m_UBO);
+    glBufferData(GL_UNIFORM_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    glBindBufferBase(GL_UNIFORM_BUFFER, bindingPoint, m_UBO);
+}
+
+UniformBuffer::~UniformBuffer() {
+    if (m_UBO != 0) {
+        glDeleteBuffers(1, &m_UBO);
+        m_UBO = 0;
+    }
+}
+
+void UniformBuffer::SetData(const void* data, size_t size, size_t offset) {
+    if (offset + size > m_Size) {
+        LOG_ERROR("UniformBuffer write out of range ({} + {} > {})", offset, size, m_Size);
+        return;
+    }
+
+    glBindBuffer(GL_UNIFORM_BUFFER, m_UBO);
+    glBufferSubData(GL_UNIFORM_BUFFER, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
@@ -0,0 +1,47 @@
+#include "level/CollisionBaker.hpp"
+#include "core/Profiler.hpp"
+#include <algorithm>
+#include <cstdint>
+
+void CollisionBaker::Bake(const LevelFormat::Collision* tiles, int width, int height, int stride,
+                          float tileSize, const glm::vec2& origin, std::vector<Collider>& out) {
+    PROFILE_FUNCTION();
+    if (width <= 0 || height <= 0) return;
+
+    using LevelFormat::Collision;
+    std::vector<uint8_t> merged(static_cast<size_t>(width) * height, 0);
+    auto at = [&](int x, int y) { return tiles[static_cast<size_t>(y) * stride + x]; };
+    auto isMerged = [&](int x, int y) { return merged[static_cast<size_t>(y) * width + x] != 0; };
+
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            const Collision type = at(x, y);
+            if (type == Collision::None || isMerged(x, y)) continue;
+
+            int runWidth = 1;
+            while (x + runWidth < width && at(x + runWidth, y) == type && !isMerged(x + runWidth, y)) {
+                ++runWidth;
+            }
+
+            int runHeight = 1;
+            if (type == Collision::Solid) {
+                for (; y + runHeight < height; ++runHeight) {
+                    bool rowFits = true;
+                    for (int i = 0; i < runWidth && rowFits; ++i) {
+                        rowFits = at(x + i, y + runHeight) == Collision::Solid && !isMerged(x + i, y + runHeight);
+                    }
+                    if (!rowFits) break;
+                }
+            }
+
+            for (int row = 0; row < runHeight; ++row) {
+                std::fill_n(merged.begin() + static_cast<size_t>(y + row) * width + x, runWidth, uint8_t(1));
+            }
+
+            const glm::vec2 min = origin + glm::vec2(x, y) * tileSize;
+            const glm::vec2 max = origin + glm::vec2(x + runWidth, y + runHeight) * tileSize;
+            out.push_back({ { min, max }, type == Collision::OneWay ? StaticType::OneWay : StaticType::Solid });
+            x += runWidth - 1;
+        }
+    }
+}
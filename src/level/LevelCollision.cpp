@@ -0,0 +1,153 @@
+#include "level/LevelCollision.hpp"
+#include "level/CollisionBaker.hpp"
+#include "physics/PhysicsWorld.hpp"
+#include "core/Profiler.hpp"
+
+LevelCollision::LevelCollision(PhysicsWorld& world, const LevelStreamer& streamer)
+    : m_World(world)
+    , m_Streamer(streamer)
+    , m_ColliderCount(0) {
+}
+
+LevelCollision::~LevelCollision() {
+    for (auto& [index, state] : m_Sections) {
+        RemoveStatics(state);
+    }
+}
+
+void LevelCollision::OnSectionLoaded(const LevelStreamer::Section& section) {
+    const uint32_t index = static_cast<uint32_t>(section.Y) * m_Streamer.GetHeader().SectionsX + section.X;
+    SectionState& state = m_Sections[index];
+    state.X = section.X;
+    state.Y = section.Y;
+    state.Loaded = true;
+
+    if (state.Edited.empty()) {
+        // Untouched: the colliders baked with the level are still right
+        state.Layer = section.Collision;
+        AddStatics(state, section);
+    } else {
+        state.Layer = state.Edited.data();
+        Rebake(state);
+    }
+}
+
+void LevelCollision::OnSectionUnloaded(const LevelStreamer::Section& section) {
+    const uint32_t index = static_cast<uint32_t>(section.Y) * m_Streamer.GetHeader().SectionsX + section.X;
+    auto it = m_Sections.find(index);
+    if (it == m_Sections.end()) return;
+
+    SectionState& state = it->second;
+    RemoveStatics(state);
+    if (state.Edited.empty()) {
+        m_Sections.erase(it);
+        return;
+    }
+
+    // Keep the edits for when it comes back; a pending re-bake is moot
+    state.Loaded = false;
+    state.Layer = nullptr;
+    state.Dirty = false;
+}
+
+bool LevelCollision::LocateTile(int tileX, int tileY, uint32_t& section, size_t& tile) const {
+    const LevelFileHeader& header = m_Streamer.GetHeader();
+    if (tileX < 0 || tileY < 0 || tileX >= static_cast<int>(header.Width) || tileY >= static_cast<int>(header.Height)) {
+        return false;
+    }
+
+    const uint32_t size = header.SectionSize;
+    const uint32_t x = static_cast<uint32_t>(tileX);
+    const uint32_t y = static_cast<uint32_t>(tileY);
+    section = (y / size) * header.SectionsX + x / size;
+    tile = static_cast<size_t>(y % size) * size + x % size;
+    return true;
+}
+
+LevelFormat::Collision LevelCollision::GetCollision(int tileX, int tileY) const {
+    uint32_t section;
+    size_t tile;
+    if (!LocateTile(tileX, tileY, section, tile)) return LevelFormat::Collision::None;
+
+    auto it = m_Sections.find(section);
+    if (it == m_Sections.end() || !it->second.Loaded) return LevelFormat::Collision::None;
+    return it->second.Layer[tile];
+}
+
+bool LevelCollision::SetCollision(int tileX, int tileY, LevelFormat::Collision type) {
+    uint32_t section;
+    size_t tile;
+    if (!LocateTile(tileX, tileY, section, tile)) return false;
+
+    auto it = m_Sections.find(section);
+    if (it == m_Sections.end() || !it->second.Loaded) return false;
+
+    SectionState& state = it->second;
+    if (state.Layer[tile] == type) return true;
+
+    // The mapped layer is read-only; edit a copy from now on
+    if (state.Edited.empty()) {
+        const size_t size = m_Streamer.GetHeader().SectionSize;
+        state.Edited.assign(state.Layer, state.Layer + size * size);
+        state.Layer = state.Edited.data();
+    }
+    state.Edited[tile] = type;
+
+    if (!state.Dirty) {
+        state.Dirty = true;
+        m_DirtySections.push_back(section);
+    }
+    return true;
+}
+
+void LevelCollision::Update() {
+    PROFILE_FUNCTION();
+
+    for (uint32_t index : m_DirtySections) {
+        auto it = m_Sections.find(index);
+        // Unloaded since it was changed; it is re-baked when it comes back
+        if (it == m_Sections.end() || !it->second.Dirty) continue;
+
+        Rebake(it->second);
+    }
+    m_DirtySections.clear();
+}
+
+void LevelCollision::AddStatics(SectionState& state, const LevelStreamer::Section& section) {
+    for (uint32_t i = 0; i < section.ColliderCount; ++i) {
+        const LevelColliderEntry& entry = section.Colliders[i];
+        const StaticType type = entry.Type == static_cast<uint32_t>(LevelFormat::Collision::OneWay)
+            ? StaticType::OneWay : StaticType::Solid;
+        state.Statics.push_back(m_World.AddStatic({ { entry.MinX, entry.MinY }, { entry.MaxX, entry.MaxY } }, type));
+    }
+    m_ColliderCount += section.ColliderCount;
+    m_Stats.CollidersAdded += section.ColliderCount;
+}
+
+void LevelCollision::Rebake(SectionState& state) {
+    const LevelFileHeader& header = m_Streamer.GetHeader();
+    const int size = static_cast<int>(header.SectionSize);
+    const glm::vec2 origin = glm::vec2(header.OriginX, header.OriginY) +
+                             glm::vec2(state.X * size, state.Y * size) * header.TileSize;
+
+    std::vector<CollisionBaker::Collider> colliders;
+    CollisionBaker::Bake(state.Layer, size, size, size, header.TileSize, origin, colliders);
+
+    RemoveStatics(state);
+    for (const CollisionBaker::Collider& collider : colliders) {
+        state.Statics.push_back(m_World.AddStatic(collider.Box, collider.Type));
+    }
+    m_ColliderCount += colliders.size();
+    m_Stats.CollidersAdded += static_cast<uint32_t>(colliders.size());
+    ++m_Stats.SectionsRebaked;
+    state.Dirty = false;
+}
+
+void LevelCollision::RemoveStatics(SectionState& state) {
+    for (uint32_t id : state.Statics) {
+        m_World.RemoveStatic(id);
+    }
+    m_ColliderCount -= state.Statics.size();
+    m_Stats.CollidersRemoved += static_cast<uint32_t>(state.Statics.size());
+    state.Statics.clear();
+}
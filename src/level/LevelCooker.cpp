@@ -0,0 +1,156 @@
+#include "level/LevelCooker.hpp"
+#include "level/CollisionBaker.hpp"
+#include "core/Logger.hpp"
+#include "utils/Hash.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace {
+    uint64_t AlignUp(uint64_t value, uint64_t alignment) {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+}
+
+bool LevelCooker::Write(const std::string& path, const Level& level, int sectionSize) {
+    const size_t tileCount = static_cast<size_t>(std::max(level.Width, 0)) * std::max(level.Height, 0);
+    if (tileCount == 0 || sectionSize <= 0 || level.Tiles.size() != tileCount ||
+        (!level.Collision.empty() && level.Collision.size() != tileCount)) {
+        LOG_ERROR("Cannot cook level {}: empty level, bad section size or mismatched layer sizes", path);
+        return false;
+    }
+
+    const uint32_t size = static_cast<uint32_t>(sectionSize);
+    const uint32_t sectionsX = (static_cast<uint32_t>(level.Width) + size - 1) / size;
+    const uint32_t sectionsY = (static_cast<uint32_t>(level.Height) + size - 1) / size;
+    const uint32_t sectionCount = sectionsX * sectionsY;
+    const uint32_t sectionTiles = size * size;
+
+    // Bucket spawns by the section they fall in; ones outside the map go to the nearest edge
+    std::vector<std::vector<LevelSpawnEntry>> spawns(sectionCount);
+    const float sectionWorldSize = level.TileSize * static_cast<float>(size);
+    for (const Spawn& spawn : level.Spawns) {
+        const glm::vec2 local = (spawn.Position - level.Origin) / sectionWorldSize;
+        const int x = std::min(std::max(static_cast<int>(std::floor(local.x)), 0), static_cast<int>(sectionsX) - 1);
+        const int y = std::min(std::max(static_cast<int>(std::floor(local.y)), 0), static_cast<int>(sectionsY) - 1);
+
+        LevelSpawnEntry entry;
+        entry.TypeHash = HashString(spawn.Type);
+        entry.X = spawn.Position.x;
+        entry.Y = spawn.Position.y;
+        entry.Param = spawn.Param;
+        entry.Reserved = 0;
+        spawns[static_cast<size_t>(y) * sectionsX + x].push_back(entry);
+    }
+
+    // Collision is baked per section so each one's colliders stream with it
+    std::vector<std::vector<LevelColliderEntry>> colliders(sectionCount);
+    if (!level.Collision.empty()) {
+        std::vector<CollisionBaker::Collider> baked;
+        for (uint32_t sectionY = 0; sectionY < sectionsY; ++sectionY) {
+            for (uint32_t sectionX = 0; sectionX < sectionsX; ++sectionX) {
+                const uint32_t beginX = sectionX * size;
+                const uint32_t beginY = sectionY * size;
+                const int width = static_cast<int>(std::min(size, static_cast<uint32_t>(level.Width) - beginX));
+                const int height = static_cast<int>(std::min(size, static_cast<uint32_t>(level.Height) - beginY));
+
+                baked.clear();
+                CollisionBaker::Bake(level.Collision.data() + static_cast<size_t>(beginY) * level.Width + beginX,
+                                     width, height, level.Width, level.TileSize,
+                                     level.Origin + glm::vec2(beginX, beginY) * level.TileSize, baked);
+
+                std::vector<LevelColliderEntry>& entries = colliders[sectionY * sectionsX + sectionX];
+                for (const CollisionBaker::Collider& collider : baked) {
+                    const LevelFormat::Collision type = collider.Type == StaticType::OneWay
+                        ? LevelFormat::Collision::OneWay : LevelFormat::Collision::Solid;
+                    entries.push_back({ collider.Box.Min.x, collider.Box.Min.y, collider.Box.Max.x, collider.Box.Max.y,
+                                        static_cast<uint32_t>(type) });
+                }
+            }
+        }
+    }
+
+    const uint32_t collisionOffset = sectionTiles * sizeof(uint16_t);
+    const uint32_t spawnOffset = static_cast<uint32_t>(AlignUp(collisionOffset + sectionTiles, alignof(LevelSpawnEntry)));
+
+    std::vector<LevelSectionEntry> entries(sectionCount);
+    uint64_t offset = AlignUp(sizeof(LevelFileHeader) + sectionCount * sizeof(LevelSectionEntry),
+                              LevelFormat::SectionAlignment);
+    for (uint32_t i = 0; i < sectionCount; ++i) {
+        LevelSectionEntry& entry = entries[i];
+        entry.Offset = offset;
+        entry.CollisionOffset = collisionOffset;
+        entry.SpawnOffset = spawnOffset;
+        entry.SpawnCount = static_cast<uint32_t>(spawns[i].size());
+        entry.ColliderOffset = spawnOffset + entry.SpawnCount * static_cast<uint32_t>(sizeof(LevelSpawnEntry));
+        entry.ColliderCount = static_cast<uint32_t>(colliders[i].size());
+        entry.Size = entry.ColliderOffset + entry.ColliderCount * static_cast<uint32_t>(sizeof(LevelColliderEntry));
+        offset = AlignUp(offset + entry.Size, LevelFormat::SectionAlignment);
+    }
+
+    LevelFileHeader header;
+    std::memcpy(header.Magic, LevelFormat::Magic, sizeof(header.Magic));
+    header.Version = LevelFormat::Version;
+    header.Width = static_cast<uint32_t>(level.Width);
+    header.Height = static_cast<uint32_t>(level.Height);
+    header.SectionSize = size;
+    header.SectionsX = sectionsX;
+    header.SectionsY = sectionsY;
+    header.TileSize = level.TileSize;
+    header.OriginX = level.Origin.x;
+    header.OriginY = level.Origin.y;
+    header.SectionTableOffset = sizeof(LevelFileHeader);
+    header.Reserved = 0;
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        LOG_ERROR("Failed to open cooked level for writing: {}", path);
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(LevelSectionEntry)));
+    uint64_t written = sizeof(header) + entries.size() * sizeof(LevelSectionEntry);
+
+    // One section's layers, reused; edge sections keep the zero padding
+    std::vector<char> section;
+    for (uint32_t sectionY = 0; sectionY < sectionsY; ++sectionY) {
+        for (uint32_t sectionX = 0; sectionX < sectionsX; ++sectionX) {
+            const uint32_t index = sectionY * sectionsX + sectionX;
+            const LevelSectionEntry& entry = entries[index];
+            section.assign(entry.Size, 0);
+
+            uint16_t* tiles = reinterpret_cast<uint16_t*>(section.data());
+            uint8_t* collision = reinterpret_cast<uint8_t*>(section.data() + entry.CollisionOffset);
+            const uint32_t beginX = sectionX * size;
+            const uint32_t beginY = sectionY * size;
+            const uint32_t endX = std::min(beginX + size, header.Width);
+            const uint32_t endY = std::min(beginY + size, header.Height);
+            for (uint32_t y = beginY; y < endY; ++y) {
+                const size_t source = static_cast<size_t>(y) * header.Width + beginX;
+                const size_t target = static_cast<size_t>(y - beginY) * size;
+                std::memcpy(tiles + target, level.Tiles.data() + source, (endX - beginX) * sizeof(uint16_t));
+                if (!level.Collision.empty()) {
+                    std::memcpy(collision + target, level.Collision.data() + source, endX - beginX);
+                }
+            }
+            if (!spawns[index].empty()) {
+                std::memcpy(section.data() + entry.SpawnOffset, spawns[index].data(),
+                            spawns[index].size() * sizeof(LevelSpawnEntry));
+            }
+
+            if (!colliders[index].empty()) {
+                std::memcpy(section.data() + entry.ColliderOffset, colliders[index].data(),
+                            colliders[index].size() * sizeof(LevelColliderEntry));
+            }
+
+            std::fill_n(std::ostreambuf_iterator<char>(file), entry.Offset - written, '\0');
+            file.write(section.data(), static_cast<std::streamsize>(section.size()));
+            written = entry.Offset + section.size();
+        }
+    }
+
+    return static_cast<bool>(file);
+}
@@ -0,0 +1,287 @@
+#include "level/LevelStreamer.hpp"
+#include "core/Logger.hpp"
+#include "core/Profiler.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+LevelStreamer::LevelStreamer()
+    : m_Header()
+    , m_Entries(nullptr)
+    , m_ResidentBytes(0)
+    , m_UpdateCounter(0)
+    , m_WarnedOverBudget(false) {
+}
+
+LevelStreamer::~LevelStreamer() {
+    // Whoever registered the callbacks may already be gone
+    m_OnLoaded = nullptr;
+    m_OnUnloaded = nullptr;
+    Close();
+}
+
+bool LevelStreamer::Open(const std::string& path) {
+    return Open(path, Properties());
+}
+
+bool LevelStreamer::Open(const std::string& path, const Properties& props) {
+    Close();
+
+    // Sections are read wherever the camera goes, so read-ahead would only pull in neighbours
+    if (!m_File.Open(path, true)) {
+        Logger::Error("Failed to open level: " + path);
+        return false;
+    }
+
+    const uint8_t* data = m_File.GetData();
+    const size_t size = m_File.GetSize();
+    if (size < sizeof(m_Header)) {
+        Logger::Error("Level is truncated: " + path);
+        Close();
+        return false;
+    }
+    std::memcpy(&m_Header, data, sizeof(m_Header));
+
+    if (std::memcmp(m_Header.Magic, LevelFormat::Magic, sizeof(m_Header.Magic)) != 0 ||
+        m_Header.Version != LevelFormat::Version) {
+        Logger::Error("Not a cooked level (or wrong version): " + path);
+        Close();
+        return false;
+    }
+
+    // Bounded by the space left after the table offset, so a huge section
+    // count cannot wrap the table size back into range
+    const uint64_t sectionCount = uint64_t(m_Header.SectionsX) * m_Header.SectionsY;
+    if (sectionCount == 0 || m_Header.SectionSize == 0 || m_Header.TileSize <= 0.0f ||
+        m_Header.SectionTableOffset > size ||
+        sectionCount > (size - m_Header.SectionTableOffset) / sizeof(LevelSectionEntry) ||
+        m_Header.SectionTableOffset % alignof(LevelSectionEntry) != 0) {
+        Logger::Error("Level is corrupt: " + path);
+        Close();
+        return false;
+    }
+
+    // The section table is used in place; section data is not touched until needed
+    m_Entries = reinterpret_cast<const LevelSectionEntry*>(data + m_Header.SectionTableOffset);
+    if (!ValidateSections()) {
+        Logger::Error("Level is corrupt: " + path);
+        Close();
+        return false;
+    }
+
+    m_Path = path;
+    m_Properties = props;
+    m_Slots.assign(static_cast<size_t>(sectionCount), SectionSlot());
+    LOG_INFO("Opened level {} ({}x{} tiles, {} sections)", path, m_Header.Width, m_Header.Height, sectionCount);
+    return true;
+}
+
+bool LevelStreamer::ValidateSections() const {
+    const uint64_t sectionCount = uint64_t(m_Header.SectionsX) * m_Header.SectionsY;
+    const uint64_t sectionTiles = uint64_t(m_Header.SectionSize) * m_Header.SectionSize;
+
+    const uint64_t fileSize = m_File.GetSize();
+    for (uint64_t i = 0; i < sectionCount; ++i) {
+        const LevelSectionEntry& entry = m_Entries[i];
+        // Written so a huge Offset cannot wrap the sum back into range
+        if (entry.Offset % alignof(LevelSpawnEntry) != 0 ||
+            entry.Offset > fileSize || entry.Size > fileSize - entry.Offset ||
+            sectionTiles * sizeof(uint16_t) > entry.CollisionOffset ||
+            entry.CollisionOffset + sectionTiles > entry.SpawnOffset ||
+            entry.SpawnOffset % alignof(LevelSpawnEntry) != 0 ||
+            entry.SpawnOffset + uint64_t(entry.SpawnCount) * sizeof(LevelSpawnEntry) > entry.ColliderOffset ||
+            entry.ColliderOffset % alignof(LevelColliderEntry) != 0 ||
+            entry.ColliderOffset + uint64_t(entry.ColliderCount) * sizeof(LevelColliderEntry) > entry.Size) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void LevelStreamer::Close() {
+    if (!m_File.IsOpen()) return;
+
+    for (uint32_t index : m_Resident) {
+        if (m_Slots[index].State == SectionState::Loaded && m_OnUnloaded) {
+            m_OnUnloaded(GetSection(static_cast<int>(index % m_Header.SectionsX),
+                                    static_cast<int>(index / m_Header.SectionsX)));
+        }
+    }
+
+    m_File.Close();
+    m_Path.clear();
+    m_Header = LevelFileHeader();
+    m_Entries = nullptr;
+    m_Slots.clear();
+    m_Resident.clear();
+    m_ResidentBytes = 0;
+    m_UpdateCounter = 0;
+    m_WarnedOverBudget = false;
+}
+
+void LevelStreamer::Update(const glm::vec2& viewMin, const glm::vec2& viewMax, const glm::vec2& velocity) {
+    PROFILE_FUNCTION();
+    if (!m_File.IsOpen()) return;
+
+    ++m_UpdateCounter;
+
+    // Everything in view is needed now
+    const glm::vec2 margin(m_Properties.LoadMargin);
+    const SectionRange required = GetOverlappingSections(viewMin - margin, viewMax + margin);
+    for (int y = required.MinY; y <= required.MaxY; ++y) {
+        for (int x = required.MinX; x <= required.MaxX; ++x) {
+            const uint32_t index = static_cast<uint32_t>(y) * m_Header.SectionsX + static_cast<uint32_t>(x);
+            m_Slots[index].LastNeeded = m_UpdateCounter;
+            if (m_Slots[index].State != SectionState::Loaded) {
+                MakeResident(index, SectionState::Loaded);
+            }
+        }
+    }
+
+    // Whatever the view sweeps over on its way to where it will be in PrefetchTime
+    const glm::vec2 travel = velocity * m_Properties.PrefetchTime;
+    if (travel != glm::vec2(0.0f)) {
+        const SectionRange ahead = GetOverlappingSections(glm::min(viewMin, viewMin + travel) - margin,
+                                                          glm::max(viewMax, viewMax + travel) + margin);
+        for (int y = ahead.MinY; y <= ahead.MaxY; ++y) {
+            for (int x = ahead.MinX; x <= ahead.MaxX; ++x) {
+                const uint32_t index = static_cast<uint32_t>(y) * m_Header.SectionsX + static_cast<uint32_t>(x);
+                m_Slots[index].LastNeeded = m_UpdateCounter;
+                if (m_Slots[index].State == SectionState::Unloaded) {
+                    MakeResident(index, SectionState::Prefetched);
+                }
+            }
+        }
+    }
+
+    EvictOverBudget();
+}
+
+LevelStreamer::SectionRange LevelStreamer::GetOverlappingSections(const glm::vec2& min, const glm::vec2& max) const {
+    const float sectionWorldSize = m_Header.TileSize * static_cast<float>(m_Header.SectionSize);
+    const float originX = m_Header.OriginX;
+    const float originY = m_Header.OriginY;
+
+    // Clamp in float first so huge views cannot overflow the int conversion
+    auto toSection = [sectionWorldSize](float value, float origin, uint32_t count) {
+        const float section = std::floor((value - origin) / sectionWorldSize);
+        return static_cast<int>(std::min(std::max(section, -1.0f), static_cast<float>(count)));
+    };
+
+    SectionRange range;
+    range.MinX = std::max(toSection(min.x, originX, m_Header.SectionsX), 0);
+    range.MinY = std::max(toSection(min.y, originY, m_Header.SectionsY), 0);
+    range.MaxX = std::min(toSection(max.x, originX, m_Header.SectionsX), static_cast<int>(m_Header.SectionsX) - 1);
+    range.MaxY = std::min(toSection(max.y, originY, m_Header.SectionsY), static_cast<int>(m_Header.SectionsY) - 1);
+    return range;
+}
+
+size_t LevelStreamer::GetResidentSize(uint32_t index) const {
+    // Budgeted in whole pages since that is what the OS keeps resident
+    const size_t alignment = LevelFormat::SectionAlignment;
+    return (static_cast<size_t>(m_Entries[index].Size) + alignment - 1) & ~(alignment - 1);
+}
+
+void LevelStreamer::MakeResident(uint32_t index, SectionState state) {
+    SectionSlot& slot = m_Slots[index];
+    const LevelSectionEntry& entry = m_Entries[index];
+
+    if (slot.State == SectionState::Unloaded) {
+        m_File.Prefetch(static_cast<size_t>(entry.Offset), entry.Size);
+        m_Resident.push_back(index);
+        m_ResidentBytes += GetResidentSize(index);
+    }
+
+    slot.State = state;
+    if (state == SectionState::Prefetched) {
+        ++m_Stats.SectionsPrefetched;
+        return;
+    }
+
+    ++m_Stats.SectionsLoaded;
+    if (m_OnLoaded) {
+        m_OnLoaded(GetSection(static_cast<int>(index % m_Header.SectionsX),
+                              static_cast<int>(index / m_Header.SectionsX)));
+    }
+}
+
+void LevelStreamer::Evict(uint32_t index) {
+    SectionSlot& slot = m_Slots[index];
+    if (slot.State == SectionState::Loaded) {
+        ++m_Stats.SectionsUnloaded;
+        if (m_OnUnloaded) {
+            m_OnUnloaded(GetSection(static_cast<int>(index % m_Header.SectionsX),
+                                    static_cast<int>(index / m_Header.SectionsX)));
+        }
+    }
+
+    const LevelSectionEntry& entry = m_Entries[index];
+    m_File.Release(static_cast<size_t>(entry.Offset), entry.Size);
+    m_ResidentBytes -= GetResidentSize(index);
+    slot.State = SectionState::Unloaded;
+}
+
+void LevelStreamer::EvictOverBudget() {
+    while (m_ResidentBytes > m_Properties.MemoryBudget) {
+        // Least recently needed first; anything needed this update stays
+        auto oldest = std::min_element(m_Resident.begin(), m_Resident.end(), [this](uint32_t a, uint32_t b) {
+            return m_Slots[a].LastNeeded < m_Slots[b].LastNeeded;
+        });
+        if (oldest == m_Resident.end() || m_Slots[*oldest].LastNeeded == m_UpdateCounter) {
+            if (!m_WarnedOverBudget) {
+                LOG_WARN("Level {} needs {} bytes resident, over its {} byte budget",
+                         m_Path, m_ResidentBytes, m_Properties.MemoryBudget);
+                m_WarnedOverBudget = true;
+            }
+            return;
+        }
+
+        const uint32_t index = *oldest;
+        m_Resident.erase(oldest);
+        Evict(index);
+    }
+}
+
+size_t LevelStreamer::GetLoadedSectionCount() const {
+    return static_cast<size_t>(std::count_if(m_Resident.begin(), m_Resident.end(), [this](uint32_t index) {
+        return m_Slots[index].State == SectionState::Loaded;
+    }));
+}
+
+bool LevelStreamer::IsSectionLoaded(int x, int y) const {
+    if (x < 0 || y < 0 || x >= static_cast<int>(m_Header.SectionsX) || y >= static_cast<int>(m_Header.SectionsY)) {
+        return false;
+    }
+    return m_Slots[static_cast<size_t>(y) * m_Header.SectionsX + x].State == SectionState::Loaded;
+}
+
+bool LevelStreamer::IsSectionResident(int x, int y) const {
+    if (x < 0 || y < 0 || x >= static_cast<int>(m_Header.SectionsX) || y >= static_cast<int>(m_Header.SectionsY)) {
+        return false;
+    }
+    return m_Slots[static_cast<size_t>(y) * m_Header.SectionsX + x].State != SectionState::Unloaded;
+}
+
+LevelStreamer::Section LevelStreamer::GetSection(int x, int y) const {
+    Section section;
+    if (!m_File.IsOpen() || x < 0 || y < 0 ||
+        x >= static_cast<int>(m_Header.SectionsX) || y >= static_cast<int>(m_Header.SectionsY)) {
+        return section;
+    }
+
+    // Only pointers are formed here; the pages are touched by whoever reads them
+    const LevelSectionEntry& entry = m_Entries[static_cast<size_t>(y) * m_Header.SectionsX + x];
+    const uint8_t* data = m_File.GetData() + entry.Offset;
+    section.X = x;
+    section.Y = y;
+    section.Size = static_cast<int>(m_Header.SectionSize);
+    section.TileX = x * section.Size;
+    section.TileY = y * section.Size;
+    section.Tiles = reinterpret_cast<const uint16_t*>(data);
+    section.Collision = reinterpret_cast<const LevelFormat::Collision*>(data + entry.CollisionOffset);
+    section.Spawns = reinterpret_cast<const LevelSpawnEntry*>(data + entry.SpawnOffset);
+    section.SpawnCount = entry.SpawnCount;
+    section.Colliders = reinterpret_cast<const LevelColliderEntry*>(data + entry.ColliderOffset);
+    section.ColliderCount = entry.ColliderCount;
+    return section;
+}
@@ -1,5 +1,7 @@
 #include "core/Engine.hpp"
 #include "core/Logger.hpp"
+#include <cstdlib>
+#include <cstring>
 
 int main(int argc, char* argv[]) {
     try {
@@ -7,15 +9,43 @@ int main(int argc, char* argv[]) {
         Logger::Init();
         LOG_INFO("Starting PlatformerEngine...");
         
+        // Command line:
+        //   --hidden       render into an invisible window
+        //   --headless     render offscreen through EGL, no display server needed
+        //   --no-graphics  simulation only, no GL at all
+        //   --threaded     submit GL on a dedicated render thread
+        //   --frames N     run N fixed-step frames as fast as possible, then exit
+        Engine::Properties props;
+        uint32_t frameCount = 0;
+        for (int i = 1; i < argc; ++i) {
+            if (std::strcmp(argv[i], "--hidden") == 0) {
+                props.WindowMode = Window::Mode::Hidden;
+            } else if (std::strcmp(argv[i], "--headless") == 0) {
+                props.WindowMode = Window::Mode::Surfaceless;
+            } else if (std::strcmp(argv[i], "--no-graphics") == 0) {
+                props.WindowMode = Window::Mode::None;
+            } else if (std::strcmp(argv[i], "--threaded") == 0) {
+                props.ThreadedRendering = true;
+            } else if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+                frameCount = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            } else {
+                LOG_WARN("Ignoring unknown argument '{}'", argv[i]);
+            }
+        }
+        
         // Create and initialize engine
         Engine engine;
-        if (!engine.Init()) {
+        if (!engine.Init(props)) {
             LOG_ERROR("Failed to initialize engine");
             return -1;
         }
         
         // Run the engine
-        engine.Run();
+        if (frameCount > 0) {
+            engine.RunFrames(frameCount);
+        } else {
+            engine.Run();
+        }
         
         // Cleanup
         engine.Shutdown();
@@ -0,0 +1,288 @@
+#include "physics/DynamicAABBTree.hpp"
+#include "utils/Debug.hpp"
+#include <algorithm>
+
+namespace {
+
+// Surface-area heuristic in 2D: the perimeter
+float Perimeter(const AABB& box) {
+    return 2.0f * ((box.Max.x - box.Min.x) + (box.Max.y - box.Min.y));
+}
+
+bool ContainsBox(const AABB& outer, const AABB& inner) {
+    return outer.Min.x <= inner.Min.x && outer.Min.y <= inner.Min.y
+        && inner.Max.x <= outer.Max.x && inner.Max.y <= outer.Max.y;
+}
+
+} // namespace
+
+DynamicAABBTree::DynamicAABBTree(float margin)
+    : m_Root(NullNode)
+    , m_FreeList(NullNode)
+    , m_ProxyCount(0)
+    , m_Margin(margin) {
+}
+
+int32_t DynamicAABBTree::AllocateNode() {
+    int32_t node;
+    if (m_FreeList != NullNode) {
+        node = m_FreeList;
+        m_FreeList = m_Nodes[node].NextFree;
+    } else {
+        node = static_cast<int32_t>(m_Nodes.size());
+        m_Nodes.emplace_back();
+    }
+
+    m_Nodes[node] = Node();
+    m_Nodes[node].Height = 0;
+    return node;
+}
+
+void DynamicAABBTree::FreeNode(int32_t node) {
+    m_Nodes[node].Height = -1;
+    m_Nodes[node].NextFree = m_FreeList;
+    m_FreeList = node;
+}
+
+Broadphase::ProxyId DynamicAABBTree::CreateProxy(const AABB& bounds, uint32_t userData) {
+    const int32_t leaf = AllocateNode();
+    m_Nodes[leaf].Box = bounds.Expanded(m_Margin);
+    m_Nodes[leaf].Tight = bounds;
+    m_Nodes[leaf].UserData = userData;
+    InsertLeaf(leaf);
+    m_ProxyCount++;
+    return static_cast<ProxyId>(leaf);
+}
+
+void DynamicAABBTree::DestroyProxy(ProxyId proxy) {
+    const int32_t leaf = static_cast<int32_t>(proxy);
+    if (leaf < 0 || static_cast<size_t>(leaf) >= m_Nodes.size() || m_Nodes[leaf].Height != 0) return;
+
+    RemoveLeaf(leaf);
+    FreeNode(leaf);
+    m_ProxyCount--;
+}
+
+void DynamicAABBTree::MoveProxy(ProxyId proxy, const AABB& bounds) {
+    const int32_t leaf = static_cast<int32_t>(proxy);
+    const glm::vec2 displacement = bounds.Min - m_Nodes[leaf].Tight.Min;
+    m_Nodes[leaf].Tight = bounds;
+    if (ContainsBox(m_Nodes[leaf].Box, bounds)) return;
+
+    // Stretch the new fat box along the motion so a body moving steadily
+    // (falling, running) is not reinserted every step
+    AABB fat = bounds.Expanded(m_Margin);
+    const glm::vec2 predicted = displacement * DisplacementMultiplier;
+    fat.Min = glm::min(fat.Min, fat.Min + predicted);
+    fat.Max = glm::max(fat.Max, fat.Max + predicted);
+
+    RemoveLeaf(leaf);
+    m_Nodes[leaf].Box = fat;
+    InsertLeaf(leaf);
+}
+
+void DynamicAABBTree::Clear() {
+    m_Nodes.clear();
+    m_Root = NullNode;
+    m_FreeList = NullNode;
+    m_ProxyCount = 0;
+}
+
+void DynamicAABBTree::InsertLeaf(int32_t leaf) {
+    if (m_Root == NullNode) {
+        m_Root = leaf;
+        m_Nodes[leaf].Parent = NullNode;
+        return;
+    }
+
+    // Descend towards the sibling that grows the tree's total perimeter least
+    const AABB leafBox = m_Nodes[leaf].Box;
+    int32_t index = m_Root;
+    while (!m_Nodes[index].IsLeaf()) {
+        const Node& node = m_Nodes[index];
+        const float combinedPerimeter = Perimeter(node.Box.Merged(leafBox));
+
+        // Cost of pairing the leaf with this node, and of pushing it further down
+        const float cost = 2.0f * combinedPerimeter;
+        const float inheritanceCost = 2.0f * (combinedPerimeter - Perimeter(node.Box));
+
+        auto descendCost = [&](int32_t child) {
+            const Node& childNode = m_Nodes[child];
+            const float merged = Perimeter(leafBox.Merged(childNode.Box));
+            return (childNode.IsLeaf() ? merged : merged - Perimeter(childNode.Box)) + inheritanceCost;
+        };
+        const float cost1 = descendCost(node.Child1);
+        const float cost2 = descendCost(node.Child2);
+
+        if (cost < cost1 && cost < cost2) break;
+        index = cost1 < cost2 ? node.Child1 : node.Child2;
+    }
+
+    const int32_t sibling = index;
+    const int32_t oldParent = m_Nodes[sibling].Parent;
+    const int32_t newParent = AllocateNode();
+    m_Nodes[newParent].Parent = oldParent;
+    m_Nodes[newParent].Box = leafBox.Merged(m_Nodes[sibling].Box);
+    m_Nodes[newParent].Height = m_Nodes[sibling].Height + 1;
+    m_Nodes[newParent].Child1 = sibling;
+    m_Nodes[newParent].Child2 = leaf;
+    m_Nodes[sibling].Parent = newParent;
+    m_Nodes[leaf].Parent = newParent;
+
+    if (oldParent == NullNode) {
+        m_Root = newParent;
+    } else if (m_Nodes[oldParent].Child1 == sibling) {
+        m_Nodes[oldParent].Child1 = newParent;
+    } else {
+        m_Nodes[oldParent].Child2 = newParent;
+    }
+
+    Refit(m_Nodes[leaf].Parent);
+}
+
+void DynamicAABBTree::RemoveLeaf(int32_t leaf) {
+    if (leaf == m_Root) {
+        m_Root = NullNode;
+        return;
+    }
+
+    const int32_t parent = m_Nodes[leaf].Parent;
+    const int32_t grandParent = m_Nodes[parent].Parent;
+    const int32_t sibling = m_Nodes[parent].Child1 == leaf ? m_Nodes[parent].Child2 : m_Nodes[parent].Child1;
+
+    // The sibling takes the parent's place
+    m_Nodes[sibling].Parent = grandParent;
+    FreeNode(parent);
+    if (grandParent == NullNode) {
+        m_Root = sibling;
+        return;
+    }
+
+    if (m_Nodes[grandParent].Child1 == parent) {
+        m_Nodes[grandParent].Child1 = sibling;
+    } else {
+        m_Nodes[grandParent].Child2 = sibling;
+    }
+    Refit(grandParent);
+}
+
+void DynamicAABBTree::Refit(int32_t node) {
+    // Rebalance and recompute boxes and heights up to the root
+    while (node != NullNode) {
+        node = Balance(node);
+
+        Node& current = m_Nodes[node];
+        const Node& child1 = m_Nodes[current.Child1];
+        const Node& child2 = m_Nodes[current.Child2];
+        current.Height = 1 + std::max(child1.Height, child2.Height);
+        current.Box = child1.Box.Merged(child2.Box);
+
+        node = current.Parent;
+    }
+}
+
+int32_t DynamicAABBTree::Balance(int32_t iA) {
+    Node& a = m_Nodes[iA];
+    if (a.IsLeaf() || a.Height < 2) {
+        return iA;
+    }
+
+    const int32_t iB = a.Child1;
+    const int32_t iC = a.Child2;
+    Node& b = m_Nodes[iB];
+    Node& c = m_Nodes[iC];
+    const int32_t balance = c.Height - b.Height;
+
+    // Rotate the taller child up into A's place; A keeps the taller of that
+    // child's children's siblings
+    auto rotateUp = [&](int32_t iUp, Node& up, Node& other, bool upWasChild2) {
+        const int32_t iF = up.Child1;
+        const int32_t iG = up.Child2;
+        Node& f = m_Nodes[iF];
+        Node& g = m_Nodes[iG];
+
+        up.Child1 = iA;
+        up.Parent = a.Parent;
+        a.Parent = iUp;
+
+        if (up.Parent == NullNode) {
+            m_Root = iUp;
+        } else if (m_Nodes[up.Parent].Child1 == iA) {
+            m_Nodes[up.Parent].Child1 = iUp;
+        } else {
+            m_Nodes[up.Parent].Child2 = iUp;
+        }
+
+        const bool keepF = f.Height > g.Height;
+        const int32_t iKeep = keepF ? iF : iG;
+        const int32_t iGive = keepF ? iG : iF;
+        Node& keep = m_Nodes[iKeep];
+        Node& give = m_Nodes[iGive];
+
+        up.Child2 = iKeep;
+        if (upWasChild2) {
+            a.Child2 = iGive;
+        } else {
+            a.Child1 = iGive;
+        }
+        give.Parent = iA;
+
+        a.Box = other.Box.Merged(give.Box);
+        a.Height = 1 + std::max(other.Height, give.Height);
+        up.Box = a.Box.Merged(keep.Box);
+        up.Height = 1 + std::max(a.Height, keep.Height);
+        return iUp;
+    };
+
+    if (balance > 1) {
+        return rotateUp(iC, c, b, true);
+    }
+    if (balance < -1) {
+        return rotateUp(iB, b, c, false);
+    }
+    return iA;
+}
+
+template<typename Fn>
+void DynamicAABBTree::Traverse(const AABB& region, Fn&& fn) const {
+    if (m_Root == NullNode) return;
+
+    int32_t stack[MaxQueryDepth];
+    size_t count = 0;
+    stack[count++] = m_Root;
+
+    while (count > 0) {
+        const Node& node = m_Nodes[stack[--count]];
+        if (!node.Box.Overlaps(region)) continue;
+
+        if (node.IsLeaf()) {
+            if (node.Tight.Overlaps(region) && !fn(node)) return;
+        } else {
+            ASSERT(count + 2 <= MaxQueryDepth, "DynamicAABBTree query stack overflow");
+            stack[count++] = node.Child1;
+            stack[count++] = node.Child2;
+        }
+    }
+}
+
+void DynamicAABBTree::Query(const AABB& region, QueryCallback callback, void* context) const {
+    Traverse(region, [callback, context](const Node& leaf) {
+        return callback(context, leaf.UserData);
+    });
+}
+
+void DynamicAABBTree::FindPairs(std::vector<BroadphasePair>& pairs) const {
+    pairs.clear();
+    for (size_t i = 0; i < m_Nodes.size(); ++i) {
+        const Node& leaf = m_Nodes[i];
+        if (leaf.Height != 0) continue;
+
+        // Each pair is found from both ends; keep it from the lower node only
+        Traverse(leaf.Tight, [&](const Node& other) {
+            if (&other > &leaf) {
+                pairs.push_back({ std::min(leaf.UserData, other.UserData), std::max(leaf.UserData, other.UserData) });
+            }
+            return true;
+        });
+    }
+}
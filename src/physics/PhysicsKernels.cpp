@@ -0,0 +1,272 @@
+#include "physics/PhysicsKernels.hpp"
+#include "PhysicsKernelsImpl.hpp"
+#include "core/Logger.hpp"
+#include <algorithm>
+
+#if PHYSICS_KERNELS_X86
+    #include <emmintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+    #endif
+#endif
+
+namespace {
+
+// Scalar
+
+void IntegrateVelocitiesScalar(float* velocityX, float* velocityY, const float* gravityScale, size_t count,
+                               float gravityDeltaX, float gravityDeltaY, float maxFallSpeed) {
+    const float minVelocityY = -maxFallSpeed;
+    for (size_t i = 0; i < count; ++i) {
+        velocityX[i] = velocityX[i] + gravityDeltaX * gravityScale[i];
+        velocityY[i] = std::max(velocityY[i] + gravityDeltaY * gravityScale[i], minVelocityY);
+    }
+}
+
+void IntegratePositionsScalar(float* positionX, float* positionY, const float* velocityX, const float* velocityY,
+                              size_t count, float deltaTime) {
+    for (size_t i = 0; i < count; ++i) {
+        positionX[i] = positionX[i] + velocityX[i] * deltaTime;
+        positionY[i] = positionY[i] + velocityY[i] * deltaTime;
+    }
+}
+
+size_t FindOverlapsScalar(float boxMinX, float boxMinY, float boxMaxX, float boxMaxY,
+                          const float* minX, const float* minY, const float* maxX, const float* maxY,
+                          size_t count, uint32_t* indices) {
+    size_t found = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (boxMinX < maxX[i] && boxMaxX > minX[i] && boxMinY < maxY[i] && boxMaxY > minY[i]) {
+            indices[found++] = static_cast<uint32_t>(i);
+        }
+    }
+    return found;
+}
+
+void OverlapMaskScalar(float boxMinX, float boxMinY, float boxMaxX, float boxMaxY,
+                       const float* minX, const float* minY, const float* maxX, const float* maxY,
+                       size_t count, uint32_t* mask) {
+    for (size_t begin = 0; begin < count; begin += 32) {
+        const size_t end = std::min(begin + 32, count);
+        uint32_t bits = 0;
+        for (size_t i = begin; i < end; ++i) {
+            const bool overlaps = boxMinX < maxX[i] && boxMaxX > minX[i] && boxMinY < maxY[i] && boxMaxY > minY[i];
+            bits |= static_cast<uint32_t>(overlaps) << (i - begin);
+        }
+        mask[begin / 32] = bits;
+    }
+}
+
+#if PHYSICS_KERNELS_X86
+
+// SSE2: part of the x86-64 baseline, so no special compile flags
+
+void IntegrateVelocitiesSSE2(float* velocityX, float* velocityY, const float* gravityScale, size_t count,
+                             float gravityDeltaX, float gravityDeltaY, float maxFallSpeed) {
+    const __m128 gravityX = _mm_set1_ps(gravityDeltaX);
+    const __m128 gravityY = _mm_set1_ps(gravityDeltaY);
+    const __m128 minVelocityY = _mm_set1_ps(-maxFallSpeed);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128 scale = _mm_loadu_ps(gravityScale + i);
+        const __m128 x = _mm_add_ps(_mm_loadu_ps(velocityX + i), _mm_mul_ps(gravityX, scale));
+        const __m128 y = _mm_add_ps(_mm_loadu_ps(velocityY + i), _mm_mul_ps(gravityY, scale));
+        _mm_storeu_ps(velocityX + i, x);
+        // Operand order matches std::max(y, limit) for equal values
+        _mm_storeu_ps(velocityY + i, _mm_max_ps(minVelocityY, y));
+    }
+    IntegrateVelocitiesScalar(velocityX + i, velocityY + i, gravityScale + i, count - i,
+                              gravityDeltaX, gravityDeltaY, maxFallSpeed);
+}
+
+void IntegratePositionsSSE2(float* positionX, float* positionY, const float* velocityX, const float* velocityY,
+                            size_t count, float deltaTime) {
+    const __m128 dt = _mm_set1_ps(deltaTime);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(positionX + i, _mm_add_ps(_mm_loadu_ps(positionX + i), _mm_mul_ps(_mm_loadu_ps(velocityX + i), dt)));
+        _mm_storeu_ps(positionY + i, _mm_add_ps(_mm_loadu_ps(positionY + i), _mm_mul_ps(_mm_loadu_ps(velocityY + i), dt)));
+    }
+    IntegratePositionsScalar(positionX + i, positionY + i, velocityX + i, velocityY + i, count - i, deltaTime);
+}
+
+size_t FindOverlapsSSE2(float boxMinX, float boxMinY, float boxMaxX, float boxMaxY,
+                        const float* minX, const float* minY, const float* maxX, const float* maxY,
+                        size_t count, uint32_t* indices) {
+    const __m128 queryMinX = _mm_set1_ps(boxMinX);
+    const __m128 queryMinY = _mm_set1_ps(boxMinY);
+    const __m128 queryMaxX = _mm_set1_ps(boxMaxX);
+    const __m128 queryMaxY = _mm_set1_ps(boxMaxY);
+
+    size_t found = 0;
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128 overlapX = _mm_and_ps(_mm_cmplt_ps(queryMinX, _mm_loadu_ps(maxX + i)),
+                                           _mm_cmpgt_ps(queryMaxX, _mm_loadu_ps(minX + i)));
+        const __m128 overlapY = _mm_and_ps(_mm_cmplt_ps(queryMinY, _mm_loadu_ps(maxY + i)),
+                                           _mm_cmpgt_ps(queryMaxY, _mm_loadu_ps(minY + i)));
+        const uint32_t mask = static_cast<uint32_t>(_mm_movemask_ps(_mm_and_ps(overlapX, overlapY)));
+        found = PhysicsKernelDetail::AppendMaskIndices(mask, static_cast<uint32_t>(i), indices, found);
+    }
+
+    const size_t tail = FindOverlapsScalar(boxMinX, boxMinY, boxMaxX, boxMaxY,
+                                           minX + i, minY + i, maxX + i, maxY + i, count - i, indices + found);
+    for (size_t t = 0; t < tail; ++t) {
+        indices[found + t] += static_cast<uint32_t>(i);
+    }
+    return found + tail;
+}
+
+void OverlapMaskSSE2(float boxMinX, float boxMinY, float boxMaxX, float boxMaxY,
+                     const float* minX, const float* minY, const float* maxX, const float* maxY,
+                     size_t count, uint32_t* mask) {
+    const __m128 queryMinX = _mm_set1_ps(boxMinX);
+    const __m128 queryMinY = _mm_set1_ps(boxMinY);
+    const __m128 queryMaxX = _mm_set1_ps(boxMaxX);
+    const __m128 queryMaxY = _mm_set1_ps(boxMaxY);
+
+    // Whole words of 32 boxes, eight groups of four each
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        uint32_t bits = 0;
+        for (size_t group = 0; group < 32; group += 4) {
+            const size_t j = i + group;
+            const __m128 overlapX = _mm_and_ps(_mm_cmplt_ps(queryMinX, _mm_loadu_ps(maxX + j)),
+                                               _mm_cmpgt_ps(queryMaxX, _mm_loadu_ps(minX + j)));
+            const __m128 overlapY = _mm_and_ps(_mm_cmplt_ps(queryMinY, _mm_loadu_ps(maxY + j)),
+                                               _mm_cmpgt_ps(queryMaxY, _mm_loadu_ps(minY + j)));
+            bits |= static_cast<uint32_t>(_mm_movemask_ps(_mm_and_ps(overlapX, overlapY))) << group;
+        }
+        mask[i / 32] = bits;
+    }
+    OverlapMaskScalar(boxMinX, boxMinY, boxMaxX, boxMaxY, minX + i, minY + i, maxX + i, maxY + i,
+                      count - i, mask + i / 32);
+}
+
+bool CpuSupportsAVX2() {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) return false;
+
+    // AVX2 needs the OS to save the YMM registers (OSXSAVE + XCR0 bits 1-2)
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6) return false;
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif // PHYSICS_KERNELS_X86
+
+SimdLevel DetectLevel() {
+#if PHYSICS_KERNELS_X86
+    return CpuSupportsAVX2() ? SimdLevel::AVX2 : SimdLevel::SSE2;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+const PhysicsKernelTable& GetTable(SimdLevel level) {
+    switch (level) {
+#if PHYSICS_KERNELS_X86
+        case SimdLevel::AVX2: return AVX2PhysicsKernels;
+        case SimdLevel::SSE2: return SSE2PhysicsKernels;
+#endif
+        default: return ScalarPhysicsKernels;
+    }
+}
+
+struct KernelState {
+    SimdLevel Supported;
+    SimdLevel Active;
+    const PhysicsKernelTable* Table;
+
+    KernelState()
+        : Supported(DetectLevel())
+        , Active(Supported)
+        , Table(&GetTable(Supported)) {
+    }
+};
+
+KernelState& GetState() {
+    static KernelState state;
+    return state;
+}
+
+} // namespace
+
+const PhysicsKernelTable ScalarPhysicsKernels = {
+    IntegrateVelocitiesScalar,
+    IntegratePositionsScalar,
+    FindOverlapsScalar,
+    OverlapMaskScalar,
+};
+
+#if PHYSICS_KERNELS_X86
+const PhysicsKernelTable SSE2PhysicsKernels = {
+    IntegrateVelocitiesSSE2,
+    IntegratePositionsSSE2,
+    FindOverlapsSSE2,
+    OverlapMaskSSE2,
+};
+#endif
+
+namespace PhysicsKernels {
+
+SimdLevel GetSupportedLevel() {
+    return GetState().Supported;
+}
+
+SimdLevel GetActiveLevel() {
+    return GetState().Active;
+}
+
+SimdLevel SetActiveLevel(SimdLevel level) {
+    KernelState& state = GetState();
+    state.Active = std::min(level, state.Supported);
+    state.Table = &GetTable(state.Active);
+    LOG_INFO("Physics kernels: {}", GetLevelName(state.Active));
+    return state.Active;
+}
+
+const char* GetLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX2: return "AVX2";
+        case SimdLevel::SSE2: return "SSE2";
+        default: return "Scalar";
+    }
+}
+
+void IntegrateVelocities(float* velocityX, float* velocityY, const float* gravityScale, size_t count,
+                         const glm::vec2& gravityDelta, float maxFallSpeed) {
+    GetState().Table->IntegrateVelocities(velocityX, velocityY, gravityScale, count,
+                                          gravityDelta.x, gravityDelta.y, maxFallSpeed);
+}
+
+void IntegratePositions(float* positionX, float* positionY, const float* velocityX, const float* velocityY,
+                        size_t count, float deltaTime) {
+    GetState().Table->IntegratePositions(positionX, positionY, velocityX, velocityY, count, deltaTime);
+}
+
+size_t FindOverlaps(const AABB& box, const float* minX, const float* minY, const float* maxX, const float* maxY,
+                    size_t count, uint32_t* indices) {
+    return GetState().Table->FindOverlaps(box.Min.x, box.Min.y, box.Max.x, box.Max.y,
+                                          minX, minY, maxX, maxY, count, indices);
+}
+
+void OverlapMask(const AABB& box, const float* minX, const float* minY, const float* maxX, const float* maxY,
+                 size_t count, uint32_t* mask) {
+    GetState().Table->OverlapMask(box.Min.x, box.Min.y, box.Max.x, box.Max.y,
+                                  minX, minY, maxX, maxY, count, mask);
+}
+
+} // namespace PhysicsKernels
@@ -0,0 +1,107 @@
+// Built with AVX2 enabled (see CMakeLists.txt) and only ever called after
+// PhysicsKernels has checked the CPU supports it. Keep this unit free of
+// shared inline code (STL, glm): the linker could otherwise keep an AVX2
+// copy of a function that runs on any CPU.
+#include "PhysicsKernelsImpl.hpp"
+
+#if PHYSICS_KERNELS_X86
+
+#include <immintrin.h>
+
+namespace {
+
+void IntegrateVelocitiesAVX2(float* velocityX, float* velocityY, const float* gravityScale, size_t count,
+                             float gravityDeltaX, float gravityDeltaY, float maxFallSpeed) {
+    const __m256 gravityX = _mm256_set1_ps(gravityDeltaX);
+    const __m256 gravityY = _mm256_set1_ps(gravityDeltaY);
+    const __m256 minVelocityY = _mm256_set1_ps(-maxFallSpeed);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256 scale = _mm256_loadu_ps(gravityScale + i);
+        const __m256 x = _mm256_add_ps(_mm256_loadu_ps(velocityX + i), _mm256_mul_ps(gravityX, scale));
+        const __m256 y = _mm256_add_ps(_mm256_loadu_ps(velocityY + i), _mm256_mul_ps(gravityY, scale));
+        _mm256_storeu_ps(velocityX + i, x);
+        _mm256_storeu_ps(velocityY + i, _mm256_max_ps(minVelocityY, y));
+    }
+    ScalarPhysicsKernels.IntegrateVelocities(velocityX + i, velocityY + i, gravityScale + i, count - i,
+                                             gravityDeltaX, gravityDeltaY, maxFallSpeed);
+}
+
+void IntegratePositionsAVX2(float* positionX, float* positionY, const float* velocityX, const float* velocityY,
+                            size_t count, float deltaTime) {
+    const __m256 dt = _mm256_set1_ps(deltaTime);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(positionX + i, _mm256_add_ps(_mm256_loadu_ps(positionX + i), _mm256_mul_ps(_mm256_loadu_ps(velocityX + i), dt)));
+        _mm256_storeu_ps(positionY + i, _mm256_add_ps(_mm256_loadu_ps(positionY + i), _mm256_mul_ps(_mm256_loadu_ps(velocityY + i), dt)));
+    }
+    ScalarPhysicsKernels.IntegratePositions(positionX + i, positionY + i, velocityX + i, velocityY + i,
+                                            count - i, deltaTime);
+}
+
+size_t FindOverlapsAVX2(float boxMinX, float boxMinY, float boxMaxX, float boxMaxY,
+                        const float* minX, const float* minY, const float* maxX, const float* maxY,
+                        size_t count, uint32_t* indices) {
+    const __m256 queryMinX = _mm256_set1_ps(boxMinX);
+    const __m256 queryMinY = _mm256_set1_ps(boxMinY);
+    const __m256 queryMaxX = _mm256_set1_ps(boxMaxX);
+    const __m256 queryMaxY = _mm256_set1_ps(boxMaxY);
+
+    size_t found = 0;
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256 overlapX = _mm256_and_ps(_mm256_cmp_ps(queryMinX, _mm256_loadu_ps(maxX + i), _CMP_LT_OQ),
+                                              _mm256_cmp_ps(queryMaxX, _mm256_loadu_ps(minX + i), _CMP_GT_OQ));
+        const __m256 overlapY = _mm256_and_ps(_mm256_cmp_ps(queryMinY, _mm256_loadu_ps(maxY + i), _CMP_LT_OQ),
+                                              _mm256_cmp_ps(queryMaxY, _mm256_loadu_ps(minY + i), _CMP_GT_OQ));
+        const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_and_ps(overlapX, overlapY)));
+        found = PhysicsKernelDetail::AppendMaskIndices(mask, static_cast<uint32_t>(i), indices, found);
+    }
+
+    const size_t tail = ScalarPhysicsKernels.FindOverlaps(boxMinX, boxMinY, boxMaxX, boxMaxY,
+                                                          minX + i, minY + i, maxX + i, maxY + i,
+                                                          count - i, indices + found);
+    for (size_t t = 0; t < tail; ++t) {
+        indices[found + t] += static_cast<uint32_t>(i);
+    }
+    return found + tail;
+}
+
+void OverlapMaskAVX2(float boxMinX, float boxMinY, float boxMaxX, float boxMaxY,
+                     const float* minX, const float* minY, const float* maxX, const float* maxY,
+                     size_t count, uint32_t* mask) {
+    const __m256 queryMinX = _mm256_set1_ps(boxMinX);
+    const __m256 queryMinY = _mm256_set1_ps(boxMinY);
+    const __m256 queryMaxX = _mm256_set1_ps(boxMaxX);
+    const __m256 queryMaxY = _mm256_set1_ps(boxMaxY);
+
+    // Whole words of 32 boxes, four groups of eight each
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        uint32_t bits = 0;
+        for (size_t group = 0; group < 32; group += 8) {
+            const size_t j = i + group;
+            const __m256 overlapX = _mm256_and_ps(_mm256_cmp_ps(queryMinX, _mm256_loadu_ps(maxX + j), _CMP_LT_OQ),
+                                                  _mm256_cmp_ps(queryMaxX, _mm256_loadu_ps(minX + j), _CMP_GT_OQ));
+            const __m256 overlapY = _mm256_and_ps(_mm256_cmp_ps(queryMinY, _mm256_loadu_ps(maxY + j), _CMP_LT_OQ),
+                                                  _mm256_cmp_ps(queryMaxY, _mm256_loadu_ps(minY + j), _CMP_GT_OQ));
+            bits |= static_cast<uint32_t>(_mm256_movemask_ps(_mm256_and_ps(overlapX, overlapY))) << group;
+        }
+        mask[i / 32] = bits;
+    }
+    ScalarPhysicsKernels.OverlapMask(boxMinX, boxMinY, boxMaxX, boxMaxY, minX + i, minY + i, maxX + i, maxY + i,
+                                     count - i, mask + i / 32);
+}
+
+} // namespace
+
+const PhysicsKernelTable AVX2PhysicsKernels = {
+    IntegrateVelocitiesAVX2,
+    IntegratePositionsAVX2,
+    FindOverlapsAVX2,
+    OverlapMaskAVX2,
+};
+
+#endif // PHYSICS_KERNELS_X86
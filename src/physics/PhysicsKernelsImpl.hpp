@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define PHYSICS_KERNELS_X86 1
+#else
+    #define PHYSICS_KERNELS_X86 0
+#endif
+
+// One instruction set's kernels; PhysicsKernels forwards to the active table
+struct PhysicsKernelTable {
+    void (*IntegrateVelocities)(float* velocityX, float* velocityY, const float* gravityScale, size_t count,
+                                float gravityDeltaX, float gravityDeltaY, float maxFallSpeed);
+    void (*IntegratePositions)(float* positionX, float* positionY, const float* velocityX, const float* velocityY,
+                               size_t count, float deltaTime);
+    size_t (*FindOverlaps)(float boxMinX, float boxMinY, float boxMaxX, float boxMaxY,
+                           const float* minX, const float* minY, const float* maxX, const float* maxY,
+                           size_t count, uint32_t* indices);
+    void (*OverlapMask)(float boxMinX, float boxMinY, float boxMaxX, float boxMaxY,
+                        const float* minX, const float* minY, const float* maxX, const float* maxY,
+                        size_t count, uint32_t* mask);
+};
+
+extern const PhysicsKernelTable ScalarPhysicsKernels;
+#if PHYSICS_KERNELS_X86
+extern const PhysicsKernelTable SSE2PhysicsKernels;
+// Lives in its own translation unit, the only one built with AVX2 enabled
+extern const PhysicsKernelTable AVX2PhysicsKernels;
+#endif
+
+namespace PhysicsKernelDetail {
+
+// Appends base + i for every set bit i of 'mask', lowest first. Static so
+// the AVX2 translation unit's copy is never the one other units link to.
+static inline size_t AppendMaskIndices(uint32_t mask, uint32_t base, uint32_t* indices, size_t count) {
+    while (mask != 0) {
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long bit;
+        _BitScanForward(&bit, mask);
+#else
+        const uint32_t bit = static_cast<uint32_t>(__builtin_ctz(mask));
+#endif
+        indices[count++] = base + static_cast<uint32_t>(bit);
+        mask &= mask - 1;
+    }
+    return count;
+}
+
+} // namespace PhysicsKernelDetail
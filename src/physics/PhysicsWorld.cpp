@@ -0,0 +1,526 @@
+#include "physics/PhysicsWorld.hpp"
+#include "core/JobSystem.hpp"
+#include "core/Profiler.hpp"
+#include "physics/DynamicAABBTree.hpp"
+#include "physics/PhysicsKernels.hpp"
+#include "physics/SpatialHashBroadphase.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+constexpr uint32_t InvalidDense = ~0u;
+
+uint64_t CellKey(int32_t x, int32_t y) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+}
+
+int32_t CellCoord(float value, float cellSize) {
+    return static_cast<int32_t>(std::floor(value / cellSize));
+}
+
+// Entry and exit time, as fractions of 'delta', of a moving interval
+// [boxMin, boxMax] against a fixed one. False if they can never overlap.
+bool SweepAxis(float boxMin, float boxMax, float delta, float staticMin, float staticMax,
+               float& entry, float& exit) {
+    constexpr float Infinity = std::numeric_limits<float>::infinity();
+    constexpr float Skin = PhysicsWorld::ContactSkin;
+
+    if (delta == 0.0f) {
+        if (boxMax <= staticMin + Skin || boxMin >= staticMax - Skin) {
+            return false;
+        }
+        entry = -Infinity;
+        exit = Infinity;
+        return true;
+    }
+
+    const float entryDistance = delta > 0.0f ? staticMin - boxMax : boxMin - staticMax;
+    const float exitDistance = delta > 0.0f ? staticMax - boxMin : boxMax - staticMin;
+    const float speed = std::fabs(delta);
+    entry = entryDistance / speed;
+    exit = exitDistance / speed;
+
+    // Touching, or sunk in by less than the skin: in contact from the start
+    if (entryDistance < 0.0f && entryDistance > -Skin) {
+        entry = 0.0f;
+    }
+    return true;
+}
+
+// Time of impact in [0, 1] and the surface normal, or false for no hit
+bool SweepBox(const AABB& box, const glm::vec2& delta, const AABB& target, float& time, glm::vec2& normal) {
+    float entryX, exitX, entryY, exitY;
+    if (!SweepAxis(box.Min.x, box.Max.x, delta.x, target.Min.x, target.Max.x, entryX, exitX)) return false;
+    if (!SweepAxis(box.Min.y, box.Max.y, delta.y, target.Min.y, target.Max.y, entryY, exitY)) return false;
+
+    const float entry = std::max(entryX, entryY);
+    const float exit = std::min(exitX, exitY);
+
+    // Negative entry: already overlapping, or moving away
+    if (entry > exit || entry < 0.0f || entry > 1.0f || exit <= 0.0f) {
+        return false;
+    }
+
+    time = entry;
+    if (entryX > entryY) {
+        normal = { delta.x > 0.0f ? -1.0f : 1.0f, 0.0f };
+    } else {
+        normal = { 0.0f, delta.y > 0.0f ? -1.0f : 1.0f };
+    }
+    return true;
+}
+
+} // namespace
+
+PhysicsWorld::PhysicsWorld()
+    : PhysicsWorld(Properties()) {
+}
+
+PhysicsWorld::PhysicsWorld(const Properties& props)
+    : m_Properties(props)
+    , m_Broadphase(CreateBroadphase(props.Broadphase)) {
+}
+
+PhysicsWorld::~PhysicsWorld() = default;
+
+std::unique_ptr<Broadphase> PhysicsWorld::CreateBroadphase(BroadphaseType type) {
+    switch (type) {
+        case BroadphaseType::AABBTree:
+            return std::make_unique<DynamicAABBTree>();
+        case BroadphaseType::SpatialHash:
+        default:
+            return std::make_unique<SpatialHashBroadphase>();
+    }
+}
+
+void PhysicsWorld::SetBroadphase(BroadphaseType type) {
+    if (type == m_Broadphase->GetType()) return;
+
+    m_Broadphase = CreateBroadphase(type);
+    m_Properties.Broadphase = type;
+    for (size_t i = 0; i < m_BodyIds.size(); ++i) {
+        const AABB box = AABB::FromCenter({ m_PositionX[i], m_PositionY[i] }, { m_HalfX[i], m_HalfY[i] });
+        m_ProxyIds[i] = m_Broadphase->CreateProxy(box, m_BodyIds[i]);
+    }
+}
+
+BodyId PhysicsWorld::CreateBody(const BodyDesc& desc) {
+    uint32_t slotIndex;
+    if (!m_FreeSlots.empty()) {
+        slotIndex = m_FreeSlots.back();
+        m_FreeSlots.pop_back();
+    } else {
+        slotIndex = static_cast<uint32_t>(m_Slots.size());
+        m_Slots.emplace_back();
+    }
+
+    BodySlot& slot = m_Slots[slotIndex];
+    slot.Dense = static_cast<uint32_t>(m_BodyIds.size());
+    slot.Alive = true;
+
+    m_PositionX.push_back(desc.Position.x);
+    m_PositionY.push_back(desc.Position.y);
+    m_VelocityX.push_back(desc.Velocity.x);
+    m_VelocityY.push_back(desc.Velocity.y);
+    m_HalfX.push_back(desc.HalfExtents.x);
+    m_HalfY.push_back(desc.HalfExtents.y);
+    m_GravityScale.push_back(desc.GravityScale);
+    m_CorrectionX.push_back(0.0f);
+    m_CorrectionY.push_back(0.0f);
+    m_Contacts.push_back(ContactNone);
+    m_BodyIds.push_back(slotIndex);
+    m_ProxyIds.push_back(m_Broadphase->CreateProxy(AABB::FromCenter(desc.Position, desc.HalfExtents), slotIndex));
+
+    return { slotIndex, slot.Generation };
+}
+
+void PhysicsWorld::DestroyBody(BodyId body) {
+    const uint32_t dense = GetDense(body);
+    if (dense == InvalidDense) return;
+
+    m_Broadphase->DestroyProxy(m_ProxyIds[dense]);
+
+    // Swap-remove from every array, then repoint the moved body's slot
+    const uint32_t last = static_cast<uint32_t>(m_BodyIds.size() - 1);
+    auto swapRemove = [dense](auto& values) {
+        values[dense] = values.back();
+        values.pop_back();
+    };
+    swapRemove(m_PositionX);
+    swapRemove(m_PositionY);
+    swapRemove(m_VelocityX);
+    swapRemove(m_VelocityY);
+    swapRemove(m_HalfX);
+    swapRemove(m_HalfY);
+    swapRemove(m_GravityScale);
+    swapRemove(m_CorrectionX);
+    swapRemove(m_CorrectionY);
+    swapRemove(m_Contacts);
+    swapRemove(m_BodyIds);
+    swapRemove(m_ProxyIds);
+    if (dense != last) {
+        m_Slots[m_BodyIds[dense]].Dense = dense;
+    }
+
+    BodySlot& slot = m_Slots[body.Index];
+    slot.Alive = false;
+    // Skip 0 on wrap-around so the slot never looks unused
+    if (++slot.Generation == 0) {
+        slot.Generation = 1;
+    }
+    m_FreeSlots.push_back(body.Index);
+}
+
+bool PhysicsWorld::IsValid(BodyId body) const {
+    return GetDense(body) != InvalidDense;
+}
+
+uint32_t PhysicsWorld::GetDense(BodyId body) const {
+    if (body.Index >= m_Slots.size()) return InvalidDense;
+    const BodySlot& slot = m_Slots[body.Index];
+    return slot.Alive && slot.Generation == body.Generation ? slot.Dense : InvalidDense;
+}
+
+glm::vec2 PhysicsWorld::GetPosition(BodyId body) const {
+    const uint32_t dense = GetDense(body);
+    return dense == InvalidDense ? glm::vec2(0.0f) : glm::vec2(m_PositionX[dense], m_PositionY[dense]);
+}
+
+void PhysicsWorld::SetPosition(BodyId body, const glm::vec2& position) {
+    const uint32_t dense = GetDense(body);
+    if (dense == InvalidDense) return;
+    m_PositionX[dense] = position.x;
+    m_PositionY[dense] = position.y;
+    m_Broadphase->MoveProxy(m_ProxyIds[dense], AABB::FromCenter(position, { m_HalfX[dense], m_HalfY[dense] }));
+}
+
+glm::vec2 PhysicsWorld::GetVelocity(BodyId body) const {
+    const uint32_t dense = GetDense(body);
+    return dense == InvalidDense ? glm::vec2(0.0f) : glm::vec2(m_VelocityX[dense], m_VelocityY[dense]);
+}
+
+void PhysicsWorld::SetVelocity(BodyId body, const glm::vec2& velocity) {
+    const uint32_t dense = GetDense(body);
+    if (dense == InvalidDense) return;
+    m_VelocityX[dense] = velocity.x;
+    m_VelocityY[dense] = velocity.y;
+}
+
+AABB PhysicsWorld::GetBounds(BodyId body) const {
+    const uint32_t dense = GetDense(body);
+    if (dense == InvalidDense) return {};
+    return AABB::FromCenter({ m_PositionX[dense], m_PositionY[dense] }, { m_HalfX[dense], m_HalfY[dense] });
+}
+
+uint8_t PhysicsWorld::GetContacts(BodyId body) const {
+    const uint32_t dense = GetDense(body);
+    return dense == InvalidDense ? static_cast<uint8_t>(ContactNone) : m_Contacts[dense];
+}
+
+uint32_t PhysicsWorld::AddStatic(const AABB& box, StaticType type) {
+    uint32_t id;
+    if (!m_FreeStatics.empty()) {
+        id = m_FreeStatics.back();
+        m_FreeStatics.pop_back();
+        m_Statics[id] = { box, type, true };
+    } else {
+        id = static_cast<uint32_t>(m_Statics.size());
+        m_Statics.push_back({ box, type, true });
+    }
+
+    const float cellSize = m_Properties.StaticCellSize;
+    for (int32_t y = CellCoord(box.Min.y, cellSize); y <= CellCoord(box.Max.y, cellSize); ++y) {
+        for (int32_t x = CellCoord(box.Min.x, cellSize); x <= CellCoord(box.Max.x, cellSize); ++x) {
+            const uint64_t key = CellKey(x, y);
+            StaticCell& cell = m_StaticGrid[key];
+            cell.Colliders.push_back(id);
+            MarkStaticCellDirty(key, cell);
+        }
+    }
+    return id;
+}
+
+void PhysicsWorld::RemoveStatic(uint32_t id) {
+    if (id >= m_Statics.size() || !m_Statics[id].Alive) return;
+
+    StaticCollider& collider = m_Statics[id];
+    const float cellSize = m_Properties.StaticCellSize;
+    for (int32_t y = CellCoord(collider.Box.Min.y, cellSize); y <= CellCoord(collider.Box.Max.y, cellSize); ++y) {
+        for (int32_t x = CellCoord(collider.Box.Min.x, cellSize); x <= CellCoord(collider.Box.Max.x, cellSize); ++x) {
+            const uint64_t key = CellKey(x, y);
+            auto it = m_StaticGrid.find(key);
+            if (it == m_StaticGrid.end()) continue;
+
+            std::vector<uint32_t>& colliders = it->second.Colliders;
+            colliders.erase(std::find(colliders.begin(), colliders.end(), id));
+            MarkStaticCellDirty(key, it->second);
+        }
+    }
+
+    collider.Alive = false;
+    m_FreeStatics.push_back(id);
+}
+
+void PhysicsWorld::ClearStatics() {
+    m_Statics.clear();
+    m_FreeStatics.clear();
+    m_StaticGrid.clear();
+    m_DirtyStaticCells.clear();
+}
+
+void PhysicsWorld::MarkStaticCellDirty(uint64_t key, StaticCell& cell) {
+    if (!cell.Dirty) {
+        cell.Dirty = true;
+        m_DirtyStaticCells.push_back(key);
+    }
+}
+
+void PhysicsWorld::RefreshStaticCells() {
+    PROFILE_FUNCTION();
+
+    for (uint64_t key : m_DirtyStaticCells) {
+        auto it = m_StaticGrid.find(key);
+        StaticCell& cell = it->second;
+        const size_t count = cell.Colliders.size();
+        if (count == 0) {
+            m_StaticGrid.erase(it);
+            continue;
+        }
+
+        cell.Bounds.resize(count * 4);
+        for (size_t i = 0; i < count; ++i) {
+            const AABB& box = m_Statics[cell.Colliders[i]].Box;
+            cell.Bounds[i] = box.Min.x;
+            cell.Bounds[count + i] = box.Min.y;
+            cell.Bounds[count * 2 + i] = box.Max.x;
+            cell.Bounds[count * 3 + i] = box.Max.y;
+        }
+        cell.Dirty = false;
+    }
+    m_DirtyStaticCells.clear();
+}
+
+template<typename Fn>
+void PhysicsWorld::ForEachStaticCandidate(const AABB& bounds, Fn&& fn) const {
+    // Only colliders overlapping 'bounds' reach fn. A collider spanning
+    // several cells is visited once per cell; testing it again is cheaper
+    // than de-duplicating.
+    constexpr size_t SmallCellSize = 8;
+    constexpr size_t BlockSize = 64;
+    uint32_t hits[BlockSize];
+
+    // Kernels get a copy: letting the caller's box escape into an opaque
+    // call stops the compiler keeping it in registers inside fn
+    const AABB query = bounds;
+
+    const float cellSize = m_Properties.StaticCellSize;
+    for (int32_t y = CellCoord(bounds.Min.y, cellSize); y <= CellCoord(bounds.Max.y, cellSize); ++y) {
+        for (int32_t x = CellCoord(bounds.Min.x, cellSize); x <= CellCoord(bounds.Max.x, cellSize); ++x) {
+            auto it = m_StaticGrid.find(CellKey(x, y));
+            if (it == m_StaticGrid.end()) continue;
+
+            const StaticCell& cell = it->second;
+            const size_t cellCount = cell.Colliders.size();
+            const float* minX = cell.Bounds.data();
+            const float* minY = minX + cellCount;
+            const float* maxX = minY + cellCount;
+            const float* maxY = maxX + cellCount;
+
+            for (size_t begin = 0; begin < cellCount; begin += BlockSize) {
+                const size_t count = std::min(BlockSize, cellCount - begin);
+
+                // A handful of colliders is cheaper to test inline than to
+                // hand to a kernel
+                size_t hitCount = 0;
+                if (count < SmallCellSize) {
+                    for (size_t i = 0; i < count; ++i) {
+                        const size_t c = begin + i;
+                        if (bounds.Min.x < maxX[c] && bounds.Max.x > minX[c] && bounds.Min.y < maxY[c] && bounds.Max.y > minY[c]) {
+                            hits[hitCount++] = static_cast<uint32_t>(i);
+                        }
+                    }
+                } else {
+                    hitCount = PhysicsKernels::FindOverlaps(query, minX + begin, minY + begin,
+                                                            maxX + begin, maxY + begin, count, hits);
+                }
+
+                // Keep this the only call site so fn is inlined
+                for (size_t i = 0; i < hitCount; ++i) {
+                    fn(m_Statics[cell.Colliders[begin + hits[i]]]);
+                }
+            }
+        }
+    }
+}
+
+void PhysicsWorld::Step(float deltaTime) {
+    PROFILE_SCOPE("Physics");
+
+    if (!m_DirtyStaticCells.empty()) {
+        RefreshStaticCells();
+    }
+
+    IntegrateVelocities(deltaTime);
+
+    {
+        PROFILE_SCOPE("SweepBodies");
+        JobSystem::getInstance().ParallelFor(m_BodyIds.size(), m_Properties.BodiesPerJob,
+            [this, deltaTime](size_t begin, size_t end) { SweepBodies(begin, end, deltaTime); });
+    }
+
+    ResolvePenetrations();
+    UpdateBroadphase();
+}
+
+const std::vector<std::pair<BodyId, BodyId>>& PhysicsWorld::FindBodyPairs() {
+    PROFILE_FUNCTION();
+
+    m_Broadphase->FindPairs(m_SlotPairs);
+    m_BodyPairs.clear();
+    for (const BroadphasePair& pair : m_SlotPairs) {
+        m_BodyPairs.push_back({
+            BodyId{ pair.First, m_Slots[pair.First].Generation },
+            BodyId{ pair.Second, m_Slots[pair.Second].Generation },
+        });
+    }
+    return m_BodyPairs;
+}
+
+void PhysicsWorld::IntegrateVelocities(float deltaTime) {
+    PROFILE_FUNCTION();
+
+    PhysicsKernels::IntegrateVelocities(m_VelocityX.data(), m_VelocityY.data(), m_GravityScale.data(),
+                                        m_BodyIds.size(), m_Properties.Gravity * deltaTime, m_Properties.MaxFallSpeed);
+}
+
+void PhysicsWorld::SweepBodies(size_t begin, size_t end, float deltaTime) {
+    for (size_t i = begin; i < end; ++i) {
+        glm::vec2 position{ m_PositionX[i], m_PositionY[i] };
+        glm::vec2 velocity{ m_VelocityX[i], m_VelocityY[i] };
+        const glm::vec2 half{ m_HalfX[i], m_HalfY[i] };
+        glm::vec2 delta = velocity * deltaTime;
+        uint8_t contacts = ContactNone;
+
+        // Overlap at the start of the step (a teleport, a spawn inside a
+        // wall): record the shallowest way out for the resolve pass
+        glm::vec2 correction{ 0.0f };
+        {
+            const AABB box = AABB::FromCenter(position, half).Expanded(-ContactSkin);
+            ForEachStaticCandidate(box, [&](const StaticCollider& collider) {
+                if (collider.Type != StaticType::Solid || !box.Overlaps(collider.Box)) return;
+
+                const float pushLeft = collider.Box.Min.x - (position.x + half.x);
+                const float pushRight = collider.Box.Max.x - (position.x - half.x);
+                const float pushDown = collider.Box.Min.y - (position.y + half.y);
+                const float pushUp = collider.Box.Max.y - (position.y - half.y);
+                const float pushX = -pushLeft < pushRight ? pushLeft : pushRight;
+                const float pushY = -pushDown < pushUp ? pushDown : pushUp;
+                if (std::fabs(pushX) < std::fabs(pushY)) {
+                    if (std::fabs(pushX) > std::fabs(correction.x)) correction.x = pushX;
+                } else if (std::fabs(pushY) > std::fabs(correction.y)) {
+                    correction.y = pushY;
+                }
+            });
+        }
+
+        for (int iteration = 0; iteration < MaxSweepIterations; ++iteration) {
+            if (delta.x == 0.0f && delta.y == 0.0f) break;
+
+            const AABB box = AABB::FromCenter(position, half);
+            const AABB swept = box.Merged({ box.Min + delta, box.Max + delta }).Expanded(ContactSkin);
+
+            float hitTime = 2.0f;
+            glm::vec2 hitNormal{ 0.0f };
+            const AABB* hitBox = nullptr;
+            ForEachStaticCandidate(swept, [&](const StaticCollider& collider) {
+                if (collider.Type == StaticType::OneWay) {
+                    // Only from above, and only if the body started above the top
+                    if (delta.y >= 0.0f || box.Min.y < collider.Box.Max.y - ContactSkin) return;
+                }
+
+                float time;
+                glm::vec2 normal;
+                if (!SweepBox(box, delta, collider.Box, time, normal)) return;
+                if (collider.Type == StaticType::OneWay && normal.y <= 0.0f) return;
+
+                if (time < hitTime) {
+                    hitTime = time;
+                    hitNormal = normal;
+                    hitBox = &collider.Box;
+                }
+            });
+
+            if (!hitBox) {
+                position += delta;
+                break;
+            }
+
+            // Move to the surface, snap flush against it to stop drift, and
+            // slide along it with whatever motion is left
+            position += delta * hitTime;
+            delta *= 1.0f - hitTime;
+            if (hitNormal.y != 0.0f) {
+                position.y = hitNormal.y > 0.0f ? hitBox->Max.y + half.y : hitBox->Min.y - half.y;
+                velocity.y = 0.0f;
+                delta.y = 0.0f;
+                contacts |= hitNormal.y > 0.0f ? ContactGround : ContactCeiling;
+            } else {
+                position.x = hitNormal.x > 0.0f ? hitBox->Max.x + half.x : hitBox->Min.x - half.x;
+                velocity.x = 0.0f;
+                delta.x = 0.0f;
+                contacts |= hitNormal.x > 0.0f ? ContactWallLeft : ContactWallRight;
+            }
+        }
+
+        m_PositionX[i] = position.x;
+        m_PositionY[i] = position.y;
+        m_VelocityX[i] = velocity.x;
+        m_VelocityY[i] = velocity.y;
+        m_CorrectionX[i] = correction.x;
+        m_CorrectionY[i] = correction.y;
+        m_Contacts[i] = contacts;
+    }
+}
+
+void PhysicsWorld::ResolvePenetrations() {
+    PROFILE_FUNCTION();
+
+    const size_t count = m_BodyIds.size();
+    for (size_t i = 0; i < count; ++i) {
+        const float correctionX = m_CorrectionX[i];
+        const float correctionY = m_CorrectionY[i];
+        if (correctionX == 0.0f && correctionY == 0.0f) continue;
+
+        // Push out and drop the velocity that points back in
+        m_PositionX[i] += correctionX;
+        m_PositionY[i] += correctionY;
+        if (correctionY > 0.0f) {
+            m_VelocityY[i] = std::max(m_VelocityY[i], 0.0f);
+            m_Contacts[i] |= ContactGround;
+        } else if (correctionY < 0.0f) {
+            m_VelocityY[i] = std::min(m_VelocityY[i], 0.0f);
+            m_Contacts[i] |= ContactCeiling;
+        }
+        if (correctionX > 0.0f) {
+            m_VelocityX[i] = std::max(m_VelocityX[i], 0.0f);
+            m_Contacts[i] |= ContactWallLeft;
+        } else if (correctionX < 0.0f) {
+            m_VelocityX[i] = std::min(m_VelocityX[i], 0.0f);
+            m_Contacts[i] |= ContactWallRight;
+        }
+        m_CorrectionX[i] = 0.0f;
+        m_CorrectionY[i] = 0.0f;
+    }
+}
+
+void PhysicsWorld::UpdateBroadphase() {
+    PROFILE_FUNCTION();
+
+    const size_t count = m_BodyIds.size();
+    for (size_t i = 0; i < count; ++i) {
+        const AABB box = AABB::FromCenter({ m_PositionX[i], m_PositionY[i] }, { m_HalfX[i], m_HalfY[i] });
+        m_Broadphase->MoveProxy(m_ProxyIds[i], box);
+    }
+}
@@ -0,0 +1,135 @@
+#include "physics/SpatialHashBroadphase.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+uint64_t CellKey(int32_t x, int32_t y) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+}
+
+} // namespace
+
+SpatialHashBroadphase::SpatialHashBroadphase(float cellSize)
+    : m_CellSize(cellSize)
+    , m_InverseCellSize(1.0f / cellSize)
+    , m_ProxyCount(0) {
+}
+
+SpatialHashBroadphase::CellRange SpatialHashBroadphase::GetCellRange(const AABB& bounds) const {
+    return {
+        static_cast<int32_t>(std::floor(bounds.Min.x * m_InverseCellSize)),
+        static_cast<int32_t>(std::floor(bounds.Min.y * m_InverseCellSize)),
+        static_cast<int32_t>(std::floor(bounds.Max.x * m_InverseCellSize)),
+        static_cast<int32_t>(std::floor(bounds.Max.y * m_InverseCellSize)),
+    };
+}
+
+Broadphase::ProxyId SpatialHashBroadphase::CreateProxy(const AABB& bounds, uint32_t userData) {
+    ProxyId proxy;
+    if (!m_FreeProxies.empty()) {
+        proxy = m_FreeProxies.back();
+        m_FreeProxies.pop_back();
+    } else {
+        proxy = static_cast<ProxyId>(m_Proxies.size());
+        m_Proxies.emplace_back();
+    }
+
+    const CellRange cells = GetCellRange(bounds);
+    m_Proxies[proxy] = { bounds, cells, userData, true };
+    Insert(proxy, cells);
+    m_ProxyCount++;
+    return proxy;
+}
+
+void SpatialHashBroadphase::DestroyProxy(ProxyId proxy) {
+    if (proxy >= m_Proxies.size() || !m_Proxies[proxy].Alive) return;
+
+    Remove(proxy, m_Proxies[proxy].Cells);
+    m_Proxies[proxy].Alive = false;
+    m_FreeProxies.push_back(proxy);
+    m_ProxyCount--;
+}
+
+void SpatialHashBroadphase::MoveProxy(ProxyId proxy, const AABB& bounds) {
+    Proxy& entry = m_Proxies[proxy];
+    entry.Bounds = bounds;
+
+    // Most moves stay within the same cells
+    const CellRange cells = GetCellRange(bounds);
+    if (cells == entry.Cells) return;
+
+    Remove(proxy, entry.Cells);
+    Insert(proxy, cells);
+    entry.Cells = cells;
+}
+
+void SpatialHashBroadphase::Clear() {
+    for (auto& [key, proxies] : m_Cells) {
+        proxies.clear();
+    }
+    m_Proxies.clear();
+    m_FreeProxies.clear();
+    m_ProxyCount = 0;
+}
+
+void SpatialHashBroadphase::Insert(ProxyId proxy, const CellRange& cells) {
+    for (int32_t y = cells.MinY; y <= cells.MaxY; ++y) {
+        for (int32_t x = cells.MinX; x <= cells.MaxX; ++x) {
+            m_Cells[CellKey(x, y)].push_back(proxy);
+        }
+    }
+}
+
+void SpatialHashBroadphase::Remove(ProxyId proxy, const CellRange& cells) {
+    for (int32_t y = cells.MinY; y <= cells.MaxY; ++y) {
+        for (int32_t x = cells.MinX; x <= cells.MaxX; ++x) {
+            std::vector<ProxyId>& proxies = m_Cells[CellKey(x, y)];
+            auto it = std::find(proxies.begin(), proxies.end(), proxy);
+            if (it != proxies.end()) {
+                *it = proxies.back();
+                proxies.pop_back();
+            }
+        }
+    }
+}
+
+void SpatialHashBroadphase::Query(const AABB& region, QueryCallback callback, void* context) const {
+    const CellRange range = GetCellRange(region);
+    for (int32_t y = range.MinY; y <= range.MaxY; ++y) {
+        for (int32_t x = range.MinX; x <= range.MaxX; ++x) {
+            auto it = m_Cells.find(CellKey(x, y));
+            if (it == m_Cells.end()) continue;
+
+            for (ProxyId proxy : it->second) {
+                const Proxy& entry = m_Proxies[proxy];
+
+                // Report from the first cell the proxy and region share only
+                if (x != std::max(entry.Cells.MinX, range.MinX) || y != std::max(entry.Cells.MinY, range.MinY)) continue;
+                if (!entry.Bounds.Overlaps(region)) continue;
+                if (!callback(context, entry.UserData)) return;
+            }
+        }
+    }
+}
+
+void SpatialHashBroadphase::FindPairs(std::vector<BroadphasePair>& pairs) const {
+    pairs.clear();
+    for (const auto& [key, proxies] : m_Cells) {
+        const int32_t cellX = static_cast<int32_t>(static_cast<uint32_t>(key >> 32));
+        const int32_t cellY = static_cast<int32_t>(static_cast<uint32_t>(key));
+
+        for (size_t i = 0; i < proxies.size(); ++i) {
+            const Proxy& a = m_Proxies[proxies[i]];
+            for (size_t j = i + 1; j < proxies.size(); ++j) {
+                const Proxy& b = m_Proxies[proxies[j]];
+
+                // Each pair is reported from the first cell both occupy
+                if (cellX != std::max(a.Cells.MinX, b.Cells.MinX) || cellY != std::max(a.Cells.MinY, b.Cells.MinY)) continue;
+                if (!a.Bounds.Overlaps(b.Bounds)) continue;
+
+                pairs.push_back({ std::min(a.UserData, b.UserData), std::max(a.UserData, b.UserData) });
+            }
+        }
+    }
+}
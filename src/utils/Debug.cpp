@@ -24,6 +24,6 @@ void Debug::HandleAssertionFailure(const std::string& message, const char* file,
         assertMessage += "\nMessage: " + message;
     }
     
-    LOG_CRITICAL(assertMessage);
+    LOG_CRITICAL("{}", assertMessage);
     Break();
 }
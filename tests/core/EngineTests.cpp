@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+#include "core/Engine.hpp"
+#include <vector>
+
+TEST(EngineTests, SimulationOnlyRunNeedsNoGraphics) {
+    Engine::Properties props;
+    props.WindowMode = Window::Mode::None;
+
+    Engine engine;
+    ASSERT_TRUE(engine.Init(props));
+    EXPECT_FALSE(engine.GetWindow()->HasContext());
+    EXPECT_EQ(engine.RunFrames(240), 240u);
+}
+
+TEST(EngineTests, FixedStepRunsAreDeterministic) {
+    Engine::Properties props;
+    props.WindowMode = Window::Mode::None;
+
+    float positions[2][2];
+    for (auto& position : positions) {
+        Engine engine;
+        ASSERT_TRUE(engine.Init(props));
+        engine.RunFrames(600);
+        position[0] = engine.GetPlayerX();
+        position[1] = engine.GetPlayerY();
+    }
+
+    // Bitwise equal, not just close: simulated time never depends on wall time
+    EXPECT_EQ(positions[0][0], positions[1][0]);
+    EXPECT_EQ(positions[0][1], positions[1][1]);
+}
+
+TEST(EngineTests, SurfacelessRendersOffscreen) {
+    Engine::Properties props;
+    props.WindowMode = Window::Mode::Surfaceless;
+
+    Engine engine;
+    if (!engine.Init(props)) {
+        GTEST_SKIP() << "No EGL surfaceless support";
+    }
+    EXPECT_EQ(engine.RunFrames(3), 3u);
+
+    const Window* window = engine.GetWindow();
+    std::vector<uint8_t> pixels;
+    ASSERT_TRUE(window->ReadPixels(pixels));
+
+    // Rows are bottom first: the ground covers the bottom, the sky the top
+    const size_t width = window->GetWidth();
+    const uint8_t* ground = &pixels[(10 * width + 10) * 4];
+    const uint8_t* sky = &pixels[((window->GetHeight() - 10) * width + 10) * 4];
+    EXPECT_NEAR(ground[0], 77, 2);
+    EXPECT_NEAR(ground[1], 179, 2);
+    EXPECT_NEAR(sky[0], 102, 2);
+    EXPECT_NEAR(sky[2], 255, 2);
+}
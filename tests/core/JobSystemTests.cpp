@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+#include "core/JobSystem.hpp"
+#include "core/WorkStealingDeque.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace {
+
+class JobSystemTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_TRUE(JobSystem::getInstance().Init(3));
+    }
+
+    void TearDown() override {
+        JobSystem::getInstance().Shutdown();
+    }
+};
+
+TEST(WorkStealingDequeTests, OwnerIsLifoThievesAreFifo) {
+    WorkStealingDeque<int, 4> deque;
+    EXPECT_TRUE(deque.Push(1));
+    EXPECT_TRUE(deque.Push(2));
+    EXPECT_TRUE(deque.Push(3));
+    EXPECT_TRUE(deque.Push(4));
+    EXPECT_FALSE(deque.Push(5));
+
+    int item = 0;
+    ASSERT_TRUE(deque.Pop(item));
+    EXPECT_EQ(item, 4);
+    ASSERT_TRUE(deque.Steal(item));
+    EXPECT_EQ(item, 1);
+    ASSERT_TRUE(deque.Pop(item));
+    EXPECT_EQ(item, 3);
+    ASSERT_TRUE(deque.Steal(item));
+    EXPECT_EQ(item, 2);
+    EXPECT_FALSE(deque.Pop(item));
+    EXPECT_FALSE(deque.Steal(item));
+}
+
+TEST(WorkStealingDequeTests, EveryItemIsTakenExactlyOnce) {
+    constexpr int ItemCount = 200000;
+    WorkStealingDeque<int, 1024> deque;
+    std::vector<std::atomic<int>> taken(ItemCount);
+    std::atomic<bool> done{ false };
+
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < 3; ++t) {
+        thieves.emplace_back([&] {
+            int item;
+            while (!done.load()) {
+                if (deque.Steal(item)) taken[item].fetch_add(1);
+            }
+        });
+    }
+
+    int item;
+    for (int i = 0; i < ItemCount; ++i) {
+        while (!deque.Push(i)) {
+            if (deque.Pop(item)) taken[item].fetch_add(1);
+        }
+        if (i % 3 == 0 && deque.Pop(item)) taken[item].fetch_add(1);
+    }
+    while (deque.Pop(item)) taken[item].fetch_add(1);
+    done.store(true);
+    for (std::thread& thief : thieves) thief.join();
+
+    for (int i = 0; i < ItemCount; ++i) {
+        ASSERT_EQ(taken[i].load(), 1) << "item " << i;
+    }
+}
+
+TEST_F(JobSystemTest, RunsEveryJob) {
+    JobSystem& jobs = JobSystem::getInstance();
+    EXPECT_EQ(jobs.GetWorkerCount(), 3u);
+
+    std::atomic<int> counter{ 0 };
+    JobCounter done;
+    for (int i = 0; i < 10000; ++i) {
+        jobs.Run([&counter] { counter.fetch_add(1, std::memory_order_relaxed); }, &done);
+    }
+    jobs.Wait(done);
+    EXPECT_TRUE(done.IsDone());
+    EXPECT_EQ(counter.load(), 10000);
+}
+
+TEST_F(JobSystemTest, ParallelForCoversTheRangeOnce) {
+    std::vector<int> hits(100003, 0);
+    JobSystem::getInstance().ParallelFor(hits.size(), 0, [&hits](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) hits[i]++;
+    });
+
+    for (size_t i = 0; i < hits.size(); ++i) {
+        ASSERT_EQ(hits[i], 1) << "index " << i;
+    }
+}
+
+TEST_F(JobSystemTest, DependentJobsWaitForTheirDependency) {
+    JobSystem& jobs = JobSystem::getInstance();
+    std::vector<int> values(4096, 0);
+    std::atomic<bool> orderViolated{ false };
+
+    // Three stages, each reading what the previous one wrote
+    JobCounter first;
+    JobCounter second;
+    JobCounter third;
+    jobs.ParallelFor(values.size(), 64, [&values](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) values[i] = 1;
+    }, first);
+    jobs.ParallelFor(values.size(), 64, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            if (values[(i * 7) % values.size()] < 1) orderViolated = true;
+        }
+        for (size_t i = begin; i < end; ++i) values[i] += 1;
+    }, second, &first);
+    jobs.Run([&] {
+        for (int value : values) {
+            if (value != 2) orderViolated = true;
+        }
+    }, &third, &second);
+
+    jobs.Wait(third);
+    EXPECT_TRUE(first.IsDone());
+    EXPECT_TRUE(second.IsDone());
+    EXPECT_FALSE(orderViolated.load());
+}
+
+TEST_F(JobSystemTest, JobsCanBeScheduledFromOtherThreads) {
+    JobSystem& jobs = JobSystem::getInstance();
+    std::atomic<int> counter{ 0 };
+    JobCounter done;
+
+    std::thread producer([&] {
+        for (int i = 0; i < 1000; ++i) {
+            jobs.Run([&counter] { counter.fetch_add(1); }, &done);
+        }
+    });
+    producer.join();
+
+    jobs.Wait(done);
+    EXPECT_EQ(counter.load(), 1000);
+}
+
+TEST_F(JobSystemTest, NestedJobsCanWait) {
+    JobSystem& jobs = JobSystem::getInstance();
+    std::atomic<int> leaves{ 0 };
+    JobCounter outer;
+    for (int i = 0; i < 64; ++i) {
+        jobs.Run([&jobs, &leaves] {
+            jobs.ParallelFor(256, 16, [&leaves](size_t begin, size_t end) {
+                leaves.fetch_add(static_cast<int>(end - begin));
+            });
+        }, &outer);
+    }
+    jobs.Wait(outer);
+    EXPECT_EQ(leaves.load(), 64 * 256);
+}
+
+TEST(JobSystemTests, RunsInlineWithoutInit) {
+    JobSystem& jobs = JobSystem::getInstance();
+    ASSERT_FALSE(jobs.IsRunning());
+
+    int value = 0;
+    JobCounter done;
+    jobs.Run([&value] { value = 42; }, &done);
+    EXPECT_EQ(value, 42);
+    EXPECT_TRUE(done.IsDone());
+}
+
+} // namespace
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include "core/Logger.hpp"
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(LoggerTests, RecordPacksArgumentsCompactly) {
+    static constexpr LogFormat format("x={} name={}");
+    LogRecordBuilder record(LogLevel::Info, &format, 123);
+    record.Add(42);
+    record.Add(std::string("player"));
+    const uint8_t* data = record.Finish();
+
+    LogRecordHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    EXPECT_EQ(header.Size % 8, 0u);
+    EXPECT_EQ(header.Size, record.GetSize());
+    EXPECT_EQ(header.Level, static_cast<uint8_t>(LogLevel::Info));
+    EXPECT_EQ(header.ArgCount, 2);
+    EXPECT_EQ(header.Timestamp, 123u);
+    EXPECT_EQ(header.Format, &format);  // Parsed formats are stored by pointer
+    EXPECT_EQ(header.Flags & LogRecordHeader::Truncated, 0);
+
+    // Header + tagged int64 + tagged (length, "player"), padded
+    EXPECT_LE(header.Size, sizeof(LogRecordHeader) + 9 + 11 + 7);
+}
+
+TEST(LoggerTests, FormatIsParsedAtCompileTime) {
+    static constexpr LogFormat format("x={:>8.2f} {{}} {}");
+    static_assert(format.IsValid());
+    static_assert(format.GetArgCount() == 2);
+    static_assert(format.GetSegmentCount() == 6);  // "x=", field, " {", "}", " ", field
+    static_assert(format.GetSegment(1).IsArg);
+    static_assert(format.GetSegment(1).Spec.Align == '>');
+    static_assert(format.GetSegment(1).Spec.Width == 8);
+    static_assert(format.GetSegment(1).Spec.Precision == 2);
+    static_assert(format.GetSegment(1).Spec.Type == 'f');
+    static_assert(format.GetSegment(2).Length == 2);
+
+    static_assert(!LogFormat("{").IsValid());
+    static_assert(!LogFormat("}").IsValid());
+    static_assert(!LogFormat("{:q}").IsValid());
+    static_assert(!LogFormat("{:.}").IsValid());
+    SUCCEED();
+}
+
+TEST(LoggerTests, FormatSpecsAreApplied) {
+    Logger::Shutdown();
+
+    Logger::Config config;
+    config.Async = false;
+    Logger::Init(config);
+
+    testing::internal::CaptureStdout();
+    LOG_INFO("[{:>6.2f}] [{:<4}] [{:*^7}] [{:04x}] [{:.3}] {{ok}}", 3.14159, 7, "ab", 255u, "truncate");
+    Logger::Log(LogLevel::Info, std::string("runtime {} {}"), 1);
+    Logger::Info("plain {braces}");
+    const std::string output = testing::internal::GetCapturedStdout();
+    Logger::Shutdown();
+
+    EXPECT_NE(output.find("[  3.14] [7   ] [**ab***] [00ff] [tru] {ok}\n"), std::string::npos);
+    EXPECT_NE(output.find("runtime 1 {}\n"), std::string::npos);  // Missing arguments keep their field
+    EXPECT_NE(output.find("plain {braces}\n"), std::string::npos);
+}
+
+TEST(LoggerTests, OversizedRecordIsTruncated) {
+    LogRecordBuilder record(LogLevel::Warning, nullptr, 0);
+    const std::string huge(LogRecordBuilder::MaxRecordSize * 2, 'a');
+    record.SetInlineFormat(huge.data(), huge.size());
+    record.Add(1);
+
+    LogRecordHeader header;
+    std::memcpy(&header, record.Finish(), sizeof(header));
+    EXPECT_LE(record.GetSize(), LogRecordBuilder::MaxRecordSize);
+    EXPECT_NE(header.Flags & LogRecordHeader::Truncated, 0);
+    EXPECT_NE(header.Flags & LogRecordHeader::InlineFormat, 0);
+}
+
+TEST(LoggerTests, BlockPolicyNeverDrops) {
+    Logger::Shutdown();
+
+    Logger::Config config;
+    config.Overflow = LogOverflowPolicy::Block;
+    config.RingSize = 4096;
+    Logger::Init(config);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([t] {
+            for (int i = 0; i < 2000; ++i) {
+                LOG_TRACE("thread {} message {}", t, i);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    Logger::Flush();
+    EXPECT_EQ(Logger::GetDroppedCount(), 0u);
+    Logger::Shutdown();
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include "core/Profiler.hpp"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace {
+
+const ProfileZone* FindZone(const ProfileFrame& frame, const char* name) {
+    for (const ProfileZone& zone : frame.Zones) {
+        if (std::strcmp(zone.Name, name) == 0) return &zone;
+    }
+    return nullptr;
+}
+
+} // namespace
+
+TEST(ProfilerTests, FrameBuildsMergedZoneTree) {
+    Profiler::Init();
+
+    Profiler::BeginFrame();
+    {
+        PROFILE_SCOPE("Outer");
+        for (int i = 0; i < 3; ++i) {
+            PROFILE_SCOPE("Inner");
+        }
+        PROFILE_SCOPE("Leaf");
+    }
+    Profiler::EndFrame();
+
+    const ProfileFrame& frame = Profiler::GetLastFrame();
+    ASSERT_EQ(frame.Zones.size(), 3u);
+
+    // Pre-order: the parent comes first, children in call order
+    EXPECT_STREQ(frame.Zones[0].Name, "Outer");
+    EXPECT_STREQ(frame.Zones[1].Name, "Inner");
+    EXPECT_STREQ(frame.Zones[2].Name, "Leaf");
+
+    const ProfileZone* outer = FindZone(frame, "Outer");
+    const ProfileZone* inner = FindZone(frame, "Inner");
+    EXPECT_EQ(outer->Parent, ProfileZone::NoParent);
+    EXPECT_EQ(inner->Parent, 0u);
+    EXPECT_EQ(inner->Depth, 1u);
+    EXPECT_EQ(inner->CallCount, 3u);
+    EXPECT_GE(outer->TotalMs, inner->TotalMs);
+    EXPECT_LE(outer->SelfMs, outer->TotalMs);
+    EXPECT_GE(frame.DurationMs, outer->TotalMs);
+
+    // The next frame starts empty
+    Profiler::BeginFrame();
+    Profiler::EndFrame();
+    EXPECT_TRUE(Profiler::GetLastFrame().Zones.empty());
+
+    Profiler::Shutdown();
+}
+
+TEST(ProfilerTests, ZonesFromOtherThreadsAreCollected) {
+    Profiler::Init();
+
+    Profiler::BeginFrame();
+    std::thread worker([] {
+        Profiler::SetThreadName("Worker");
+        PROFILE_SCOPE("WorkerZone");
+    });
+    worker.join();
+    {
+        PROFILE_SCOPE("MainZone");
+    }
+    Profiler::EndFrame();
+
+    const ProfileFrame& frame = Profiler::GetLastFrame();
+    const ProfileZone* workerZone = FindZone(frame, "WorkerZone");
+    const ProfileZone* mainZone = FindZone(frame, "MainZone");
+    ASSERT_NE(workerZone, nullptr);
+    ASSERT_NE(mainZone, nullptr);
+    EXPECT_NE(workerZone->ThreadId, mainZone->ThreadId);
+    EXPECT_EQ(workerZone->Parent, ProfileZone::NoParent);
+
+    Profiler::Shutdown();
+}
+
+TEST(ProfilerTests, CaptureExportsChromeTrace) {
+    Profiler::Init();
+    Profiler::SetThreadName("Main");
+
+    Profiler::BeginCapture();
+    for (int frame = 0; frame < 2; ++frame) {
+        Profiler::BeginFrame();
+        {
+            PROFILE_SCOPE("Quoted \"zone\"");
+        }
+        Profiler::EndFrame();
+    }
+    Profiler::EndCapture();
+
+    // Frames after EndCapture are not kept
+    Profiler::BeginFrame();
+    {
+        PROFILE_SCOPE("Ignored");
+    }
+    Profiler::EndFrame();
+    EXPECT_EQ(Profiler::GetCapturedEventCount(), 2u);
+
+    const std::string path = "profiler_test_capture.json";
+    ASSERT_TRUE(Profiler::ExportChromeTrace(path));
+
+    std::ifstream file(path);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    const std::string json = contents.str();
+    std::remove(path.c_str());
+
+    EXPECT_NE(json.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"Quoted \\\"zone\\\"\""), std::string::npos);
+    EXPECT_NE(json.find("\"thread_name\""), std::string::npos);
+    EXPECT_EQ(json.find("Ignored"), std::string::npos);
+
+    Profiler::Shutdown();
+}
@@ -101,4 +101,43 @@ TEST_F(ResourceManagerTest, ResourceDataPersistence) {
     EXPECT_EQ(sameResource->getTestData(), "test data");
 }
 
+TEST_F(ResourceManagerTest, HandleResolvesToResource) {
+    auto& manager = ResourceManager::getInstance();
+
+    Handle<TestResource> handle = manager.loadResource<TestResource>("test1", "test_resource.txt");
+    ASSERT_TRUE(handle.IsValid());
+    EXPECT_EQ(manager.getHandle<TestResource>("test1"), handle);
+
+    TestResource* resource = manager.get(handle);
+    ASSERT_NE(resource, nullptr);
+    EXPECT_EQ(resource, manager.getResource<TestResource>("test1").get());
+
+    // Failed loads hand back an invalid handle
+    EXPECT_FALSE(manager.loadResource<TestResource>("test2", "nonexistent.txt").IsValid());
+    EXPECT_FALSE(manager.getHandle<TestResource>("test2").IsValid());
+
+    manager.clearResources<TestResource>();
+}
+
+TEST_F(ResourceManagerTest, StaleHandleAfterRemove) {
+    auto& manager = ResourceManager::getInstance();
+
+    Handle<TestResource> first = manager.loadResource<TestResource>("test1", "test_resource.txt");
+    ASSERT_TRUE(manager.isValid(first));
+
+    manager.removeResource<TestResource>("test1");
+    EXPECT_FALSE(manager.isValid(first));
+    EXPECT_EQ(manager.get(first), nullptr);
+
+    // The freed slot is reused under a new generation; the old handle stays dead
+    Handle<TestResource> second = manager.loadResource<TestResource>("test2", "test_resource.txt");
+    ASSERT_TRUE(manager.isValid(second));
+    EXPECT_EQ(second.Index, first.Index);
+    EXPECT_NE(second.Generation, first.Generation);
+    EXPECT_EQ(manager.get(first), nullptr);
+
+    manager.clearResources<TestResource>();
+    EXPECT_FALSE(manager.isValid(second));
+}
+
 } // namespace
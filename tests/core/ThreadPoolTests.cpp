@@ -0,0 +1,36 @@
+#include <gtest/gtest.h>
+#include "core/ThreadPool.hpp"
+#include <atomic>
+
+TEST(ThreadPoolTests, RunsEveryTask) {
+    ThreadPool pool;
+    ASSERT_TRUE(pool.Init(4));
+    EXPECT_EQ(pool.GetThreadCount(), 4u);
+
+    std::atomic<int> counter{ 0 };
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_TRUE(pool.Enqueue([&counter] { counter.fetch_add(1, std::memory_order_relaxed); }));
+    }
+
+    pool.WaitIdle();
+    EXPECT_EQ(counter.load(), 1000);
+}
+
+TEST(ThreadPoolTests, ShutdownDrainsQueuedTasks) {
+    std::atomic<int> counter{ 0 };
+    {
+        ThreadPool pool;
+        ASSERT_TRUE(pool.Init(1));
+        for (int i = 0; i < 100; ++i) {
+            pool.Enqueue([&counter] { counter.fetch_add(1, std::memory_order_relaxed); });
+        }
+        pool.Shutdown();
+        EXPECT_FALSE(pool.IsRunning());
+    }
+    EXPECT_EQ(counter.load(), 100);
+}
+
+TEST(ThreadPoolTests, RejectsTasksWhenNotRunning) {
+    ThreadPool pool;
+    EXPECT_FALSE(pool.Enqueue([] {}));
+}
@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+#include "ecs/World.hpp"
+#include <vector>
+
+namespace {
+
+struct Position {
+    float X;
+    float Y;
+};
+
+struct Speed {
+    float Value;
+};
+
+struct Health {
+    int Value;
+};
+
+struct Frozen {};
+
+struct LargestComponent {
+    uint8_t Bytes[ComponentRegistry::MaxComponentSize];
+};
+
+struct OtherLargestComponent {
+    uint8_t Bytes[ComponentRegistry::MaxComponentSize];
+};
+
+TEST(WorldTests, CreateAndDestroyEntities) {
+    World world;
+    Entity a = world.CreateEntity(Position{ 1.0f, 2.0f });
+    Entity b = world.CreateEntity(Position{ 3.0f, 4.0f }, Speed{ 5.0f });
+    EXPECT_EQ(world.GetEntityCount(), 2u);
+    EXPECT_TRUE(world.IsAlive(a));
+
+    ASSERT_NE(world.GetComponent<Position>(b), nullptr);
+    EXPECT_FLOAT_EQ(world.GetComponent<Position>(b)->X, 3.0f);
+    EXPECT_FLOAT_EQ(world.GetComponent<Speed>(b)->Value, 5.0f);
+    EXPECT_EQ(world.GetComponent<Speed>(a), nullptr);
+
+    world.DestroyEntity(a);
+    EXPECT_FALSE(world.IsAlive(a));
+    EXPECT_EQ(world.GetComponent<Position>(a), nullptr);
+
+    // The slot is reused under a new generation; the old ID stays dead
+    Entity c = world.CreateEntity(Position{ 0.0f, 0.0f });
+    EXPECT_EQ(c.Index, a.Index);
+    EXPECT_NE(c.Generation, a.Generation);
+    EXPECT_FALSE(world.IsAlive(a));
+    EXPECT_FALSE(world.IsAlive(Entity{}));
+}
+
+TEST(WorldTests, SwapRemoveKeepsOtherEntitiesIntact) {
+    World world;
+    std::vector<Entity> entities;
+    for (int i = 0; i < 2000; ++i) {
+        entities.push_back(world.CreateEntity(Health{ i }));
+    }
+
+    // Spans several chunks; every removal moves another entity
+    for (int i = 0; i < 2000; i += 3) {
+        world.DestroyEntity(entities[i]);
+    }
+
+    for (int i = 0; i < 2000; ++i) {
+        if (i % 3 == 0) {
+            EXPECT_FALSE(world.IsAlive(entities[i]));
+        } else {
+            ASSERT_NE(world.GetComponent<Health>(entities[i]), nullptr);
+            EXPECT_EQ(world.GetComponent<Health>(entities[i])->Value, i);
+        }
+    }
+}
+
+TEST(WorldTests, AddAndRemoveComponentsMoveBetweenArchetypes) {
+    World world;
+    Entity entity = world.CreateEntity(Position{ 1.0f, 2.0f });
+
+    world.AddComponent(entity, Speed{ 3.0f });
+    EXPECT_TRUE(world.HasComponent<Speed>(entity));
+    EXPECT_FLOAT_EQ(world.GetComponent<Position>(entity)->Y, 2.0f);
+
+    world.AddComponent(entity, Speed{ 4.0f });
+    EXPECT_FLOAT_EQ(world.GetComponent<Speed>(entity)->Value, 4.0f);
+
+    world.RemoveComponent<Position>(entity);
+    EXPECT_FALSE(world.HasComponent<Position>(entity));
+    EXPECT_FLOAT_EQ(world.GetComponent<Speed>(entity)->Value, 4.0f);
+}
+
+TEST(WorldTests, QueriesMatchArchetypesCreatedLater) {
+    World world;
+    auto moving = world.GetQuery<Position, const Speed>(MakeComponentMask<Frozen>());
+    EXPECT_EQ(moving.Count(), 0u);
+
+    world.CreateEntity(Position{ 0.0f, 0.0f }, Speed{ 1.0f });
+    world.CreateEntity(Position{ 0.0f, 0.0f }, Speed{ 2.0f }, Health{ 10 });
+    world.CreateEntity(Position{ 0.0f, 0.0f }, Speed{ 3.0f }, Frozen{});
+    world.CreateEntity(Position{ 0.0f, 0.0f });
+    EXPECT_EQ(moving.Count(), 2u);
+
+    moving.ForEach([](Position& position, const Speed& speed) {
+        position.X += speed.Value;
+    });
+
+    float total = 0.0f;
+    world.GetQuery<const Position>().ForEach([&total](Entity entity, const Position& position) {
+        EXPECT_TRUE(entity.IsValid());
+        total += position.X;
+    });
+    EXPECT_FLOAT_EQ(total, 3.0f);
+}
+
+TEST(WorldTests, ChunksAreContiguousAndCacheLineAligned) {
+    World world;
+    for (int i = 0; i < 5000; ++i) {
+        world.CreateEntity(Position{ static_cast<float>(i), 0.0f }, Speed{ 1.0f });
+    }
+
+    size_t visited = 0;
+    size_t chunks = 0;
+    world.GetQuery<const Position, const Speed>().ForEachChunk(
+        [&](uint32_t count, const Entity* entities, const Position* positions, const Speed* speeds) {
+            EXPECT_LE(count * (sizeof(Entity) + sizeof(Position) + sizeof(Speed)), Archetype::ChunkSize);
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(positions) % Archetype::ColumnAlignment, 0u);
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(speeds) % Archetype::ColumnAlignment, 0u);
+            EXPECT_TRUE(entities[count - 1].IsValid());
+            visited += count;
+            chunks++;
+        });
+    EXPECT_EQ(visited, 5000u);
+    EXPECT_GT(chunks, 1u);
+}
+
+TEST(WorldTests, LargestComponentStillFitsAChunk) {
+    World world;
+    for (int i = 0; i < 3; ++i) {
+        LargestComponent large{};
+        large.Bytes[ComponentRegistry::MaxComponentSize - 1] = static_cast<uint8_t>(i + 1);
+        world.CreateEntity(large, Position{ static_cast<float>(i), 0.0f });
+    }
+
+    size_t visited = 0;
+    world.GetQuery<const LargestComponent, const Position>().ForEachChunk(
+        [&](uint32_t count, const Entity*, const LargestComponent* large, const Position* positions) {
+            EXPECT_GE(count, 1u);
+            for (uint32_t i = 0; i < count; ++i) {
+                EXPECT_EQ(large[i].Bytes[ComponentRegistry::MaxComponentSize - 1],
+                          static_cast<uint8_t>(positions[i].X) + 1);
+            }
+            visited += count;
+        });
+    EXPECT_EQ(visited, 3u);
+}
+
+TEST(WorldTests, SignatureTooLargeForAChunkIsFatal) {
+    // Each fits a chunk alone, but not both in one row; Release builds too
+    EXPECT_DEATH({
+        World world;
+        world.CreateEntity(LargestComponent{}, OtherLargestComponent{});
+    }, "");
+}
+
+} // namespace
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+#include "graphics/Camera2D.hpp"
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+
+glm::vec4 Transform(const glm::mat4& matrix, const glm::vec2& point) {
+    return matrix * glm::vec4(point.x, point.y, 0.0f, 1.0f);
+}
+
+TEST(Camera2DTests, ViewBoundsFollowPositionAndZoom) {
+    Camera2D camera(800.0f, 600.0f);
+    camera.SetPosition({ 100.0f, 50.0f });
+    EXPECT_EQ(camera.GetViewBounds().Min, glm::vec2(-300.0f, -250.0f));
+    EXPECT_EQ(camera.GetViewBounds().Max, glm::vec2(500.0f, 350.0f));
+
+    // Two pixels per unit halves what fits on screen
+    camera.SetZoom(2.0f);
+    EXPECT_EQ(camera.GetViewBounds().Min, glm::vec2(-100.0f, -100.0f));
+    EXPECT_EQ(camera.GetViewBounds().Max, glm::vec2(300.0f, 200.0f));
+
+    // The view corners land on the clip-space corners
+    const glm::mat4& viewProjection = camera.GetViewProjectionMatrix();
+    const glm::vec4 min = Transform(viewProjection, camera.GetViewBounds().Min);
+    const glm::vec4 max = Transform(viewProjection, camera.GetViewBounds().Max);
+    EXPECT_NEAR(min.x, -1.0f, 1e-5f);
+    EXPECT_NEAR(min.y, -1.0f, 1e-5f);
+    EXPECT_NEAR(max.x, 1.0f, 1e-5f);
+    EXPECT_NEAR(max.y, 1.0f, 1e-5f);
+}
+
+TEST(Camera2DTests, MatricesAreCachedUntilChanged) {
+    Camera2D camera(640.0f, 360.0f);
+    camera.SetPosition({ 10.0f, 20.0f });
+    const glm::mat4 viewProjection = camera.GetViewProjectionMatrix();
+    EXPECT_EQ(viewProjection, camera.GetProjectionMatrix() * camera.GetViewMatrix());
+
+    // Setting the same values keeps the cache
+    const glm::mat4* cached = &camera.GetViewProjectionMatrix();
+    camera.SetPosition({ 10.0f, 20.0f });
+    camera.SetViewportSize(640.0f, 360.0f);
+    EXPECT_EQ(&camera.GetViewProjectionMatrix(), cached);
+    EXPECT_EQ(camera.GetViewProjectionMatrix(), viewProjection);
+
+    // A resize changes only the projection
+    const glm::mat4 view = camera.GetViewMatrix();
+    camera.SetViewportSize(1280.0f, 720.0f);
+    EXPECT_EQ(camera.GetViewMatrix(), view);
+    EXPECT_NE(camera.GetViewProjectionMatrix(), viewProjection);
+    EXPECT_EQ(camera.GetViewProjectionMatrix(), camera.GetProjectionMatrix() * camera.GetViewMatrix());
+}
+
+TEST(Camera2DTests, PixelSnapRoundsToWholePixels) {
+    Camera2D camera(801.0f, 601.0f);
+    camera.SetZoom(3.0f);
+    camera.SetPosition({ 10.4f, -7.3f });
+    EXPECT_EQ(camera.GetRenderPosition(), camera.GetPosition());
+
+    camera.SetPixelSnap(true);
+    const glm::vec2 snapped = camera.GetRenderPosition();
+    EXPECT_FLOAT_EQ(snapped.x * 3.0f, 31.0f);
+    EXPECT_FLOAT_EQ(snapped.y * 3.0f, -22.0f);
+    // The unsnapped position is kept
+    EXPECT_EQ(camera.GetPosition(), glm::vec2(10.4f, -7.3f));
+
+    // Odd viewport sizes still put pixel edges on whole numbers
+    const glm::vec2 screen = camera.WorldToScreen(glm::vec2(4.0f, 2.0f));
+    EXPECT_FLOAT_EQ(screen.x, std::round(screen.x));
+    EXPECT_FLOAT_EQ(screen.y, std::round(screen.y));
+    const glm::vec2 world = camera.ScreenToWorld(screen);
+    EXPECT_NEAR(world.x, 4.0f, 1e-4f);
+    EXPECT_NEAR(world.y, 2.0f, 1e-4f);
+}
+
+TEST(Camera2DTests, ScreenCoordinatesStartTopLeft) {
+    Camera2D camera(800.0f, 600.0f);
+    camera.SetPosition({ 400.0f, 300.0f });
+    EXPECT_EQ(camera.ScreenToWorld({ 0.0f, 0.0f }), glm::vec2(0.0f, 600.0f));
+    EXPECT_EQ(camera.ScreenToWorld({ 800.0f, 600.0f }), glm::vec2(800.0f, 0.0f));
+    EXPECT_EQ(camera.WorldToScreen({ 100.0f, 500.0f }), glm::vec2(100.0f, 100.0f));
+}
+
+TEST(Camera2DTests, FollowRespectsTheDeadzone) {
+    Camera2D camera(800.0f, 600.0f);
+    camera.SetDeadzone({ 50.0f, 20.0f });
+
+    // Inside the deadzone nothing moves
+    camera.Follow({ 40.0f, -15.0f }, 1.0f / 60.0f);
+    EXPECT_EQ(camera.GetPosition(), glm::vec2(0.0f));
+
+    // With no smoothing the target ends up on the deadzone edge
+    camera.Follow({ 130.0f, -60.0f }, 1.0f / 60.0f);
+    EXPECT_EQ(camera.GetPosition(), glm::vec2(80.0f, -40.0f));
+
+    // Smoothed: closes the same share of the gap however the frame is sliced
+    Camera2D coarse(800.0f, 600.0f);
+    Camera2D fine(800.0f, 600.0f);
+    coarse.SetFollowSpeed(5.0f);
+    fine.SetFollowSpeed(5.0f);
+    coarse.Follow({ 100.0f, 0.0f }, 0.1f);
+    for (int i = 0; i < 10; ++i) {
+        fine.Follow({ 100.0f, 0.0f }, 0.01f);
+    }
+    EXPECT_GT(coarse.GetPosition().x, 0.0f);
+    EXPECT_LT(coarse.GetPosition().x, 100.0f);
+    EXPECT_NEAR(fine.GetPosition().x, coarse.GetPosition().x, 1e-3f);
+}
+
+TEST(Camera2DTests, CullMatchesIsVisible) {
+    // Not a multiple of 32, so the last mask word is partial
+    constexpr size_t Count = 1000;
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> position(-2000.0f, 2000.0f);
+    std::uniform_real_distribution<float> size(1.0f, 100.0f);
+    std::vector<float> minX(Count), minY(Count), maxX(Count), maxY(Count);
+    for (size_t i = 0; i < Count; ++i) {
+        minX[i] = position(rng);
+        minY[i] = position(rng);
+        maxX[i] = minX[i] + size(rng);
+        maxY[i] = minY[i] + size(rng);
+    }
+
+    Camera2D camera(1280.0f, 720.0f);
+    camera.SetPosition({ 200.0f, -100.0f });
+    std::vector<uint32_t> mask(Camera2D::GetMaskWordCount(Count), 0xFFFFFFFFu);
+    const size_t visible = camera.Cull(minX.data(), minY.data(), maxX.data(), maxY.data(), Count, mask.data());
+
+    size_t expected = 0;
+    for (size_t i = 0; i < Count; ++i) {
+        const bool inView = camera.IsVisible({ { minX[i], minY[i] }, { maxX[i], maxY[i] } });
+        EXPECT_EQ(((mask[i / 32] >> (i % 32)) & 1u) != 0, inView) << "box " << i;
+        expected += inView;
+    }
+    EXPECT_EQ(visible, expected);
+    EXPECT_GT(visible, 0u);
+    EXPECT_LT(visible, Count);
+    // Bits past the last box are clear
+    EXPECT_EQ(mask.back() >> (Count % 32), 0u);
+}
+
+} // namespace
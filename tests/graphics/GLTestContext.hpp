@@ -0,0 +1,44 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+// Hidden GLFW window whose GL context stays current while this object
+// lives. Any driver with the requested core profile works, including Mesa
+// llvmpipe (LIBGL_ALWAYS_SOFTWARE=1). Fixtures call GTEST_SKIP() when
+// IsAvailable() is false, so headless machines skip GL tests instead of
+// crashing in them.
+class GLTestContext {
+public:
+    explicit GLTestContext(const char* title, int major = 3, int minor = 3) {
+        if (!glfwInit()) return;
+
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, major);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, minor);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+        m_Window = glfwCreateWindow(64, 64, title, nullptr, nullptr);
+        if (!m_Window) return;
+
+        glfwMakeContextCurrent(m_Window);
+        if (!gladLoadGLLoader(reinterpret_cast<GLADloadproc>(glfwGetProcAddress))) {
+            glfwDestroyWindow(m_Window);
+            m_Window = nullptr;
+        }
+    }
+
+    ~GLTestContext() {
+        if (m_Window) glfwDestroyWindow(m_Window);
+        glfwTerminate();
+    }
+
+    // Delete copy constructor and assignment operator
+    GLTestContext(const GLTestContext&) = delete;
+    GLTestContext& operator=(const GLTestContext&) = delete;
+
+    bool IsAvailable() const { return m_Window != nullptr; }
+
+private:
+    GLFWwindow* m_Window = nullptr;
+};
@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+#include "graphics/ParticleSystem.hpp"
+#include "graphics/RenderBackend.hpp"
+#include "graphics/RenderQueue.hpp"
+#include "core/JobSystem.hpp"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+// No randomness, gravity or drag unless a test asks for them
+ParticleEmitter::Properties StillProperties() {
+    ParticleEmitter::Properties props;
+    props.MaxParticles = 1000;
+    props.Velocity = glm::vec2(10.0f, 0.0f);
+    props.VelocityVariation = glm::vec2(0.0f);
+    props.Gravity = glm::vec2(0.0f);
+    props.Lifetime = 1.0f;
+    props.Size = 8.0f;
+    props.SizeEndScale = 0.0f;
+    props.ColorBegin = glm::vec4(1.0f);
+    props.ColorEnd = glm::vec4(1.0f, 1.0f, 1.0f, 0.0f);
+    return props;
+}
+
+bool BitEqual(const float* a, const float* b, size_t count) {
+    return std::memcmp(a, b, count * sizeof(float)) == 0;
+}
+
+TEST(ParticleSystemTests, EmitStopsAtCapacity) {
+    ParticleEmitter::Properties props = StillProperties();
+    props.MaxParticles = 100;
+    ParticleEmitter emitter(props);
+
+    EXPECT_EQ(emitter.Emit(60, glm::vec2(0.0f)), 60u);
+    EXPECT_EQ(emitter.Emit(60, glm::vec2(0.0f)), 40u);
+    EXPECT_EQ(emitter.GetCount(), 100u);
+    EXPECT_EQ(emitter.GetStats().Emitted, 100u);
+    EXPECT_EQ(emitter.GetStats().Dropped, 20u);
+}
+
+TEST(ParticleSystemTests, ParticlesMoveAndFadeOverTheirLife) {
+    ParticleEmitter::Properties props = StillProperties();
+    props.Drag = 0.5f;
+    props.Gravity = glm::vec2(0.0f, -10.0f);
+    ParticleEmitter emitter(props);
+    emitter.Emit(3, glm::vec2(100.0f, 50.0f));
+
+    emitter.Update(0.5f);
+    ASSERT_EQ(emitter.GetCount(), 3u);
+    // Velocity is damped and pulled down first, then moves the particle
+    EXPECT_FLOAT_EQ(emitter.GetVelocityX()[0], 7.5f);
+    EXPECT_FLOAT_EQ(emitter.GetVelocityY()[0], -5.0f);
+    EXPECT_FLOAT_EQ(emitter.GetPositionX()[0], 103.75f);
+    EXPECT_FLOAT_EQ(emitter.GetPositionY()[0], 47.5f);
+
+    // Halfway through its life
+    EXPECT_FLOAT_EQ(emitter.GetLife()[0], 0.5f);
+    EXPECT_FLOAT_EQ(emitter.GetSize()[0], 4.0f);
+    EXPECT_FLOAT_EQ(emitter.GetColor(0).a, 0.5f);
+    EXPECT_FLOAT_EQ(emitter.GetColor(0).r, 1.0f);
+
+    emitter.Update(0.5f);
+    EXPECT_EQ(emitter.GetCount(), 0u);
+    EXPECT_EQ(emitter.GetStats().Expired, 3u);
+}
+
+TEST(ParticleSystemTests, DeadParticlesAreSwappedOut) {
+    ParticleEmitter::Properties props = StillProperties();
+    props.LifetimeVariation = 0.9f;
+    props.VelocityVariation = glm::vec2(20.0f);
+    ParticleEmitter emitter(props);
+    emitter.Emit(500, glm::vec2(0.0f));
+
+    std::vector<float> expectedLife;
+    for (size_t i = 0; i < emitter.GetCount(); ++i) {
+        if (emitter.GetLife()[i] > 0.4f) expectedLife.push_back(emitter.GetLife()[i] - 0.4f);
+    }
+    ASSERT_GT(expectedLife.size(), 0u);
+    ASSERT_LT(expectedLife.size(), 500u);
+
+    emitter.Update(0.4f);
+    ASSERT_EQ(emitter.GetCount(), expectedLife.size());
+    EXPECT_EQ(emitter.GetStats().Expired, 500u - expectedLife.size());
+
+    // Survivors keep their own values, whatever slot they moved to
+    std::vector<float> life(emitter.GetLife(), emitter.GetLife() + emitter.GetCount());
+    std::sort(life.begin(), life.end());
+    std::sort(expectedLife.begin(), expectedLife.end());
+    for (size_t i = 0; i < life.size(); ++i) {
+        EXPECT_FLOAT_EQ(life[i], expectedLife[i]);
+    }
+    for (size_t i = 0; i < emitter.GetCount(); ++i) {
+        EXPECT_NEAR(emitter.GetPositionY()[i] / emitter.GetVelocityY()[i], 0.4f, 1e-4f);
+    }
+}
+
+TEST(ParticleSystemTests, ParallelUpdateMatchesSerial) {
+    ParticleEmitter::Properties props = StillProperties();
+    props.MaxParticles = 50000;
+    props.LifetimeVariation = 0.5f;
+    props.VelocityVariation = glm::vec2(100.0f);
+    props.PositionVariation = glm::vec2(50.0f);
+    props.Gravity = glm::vec2(0.0f, -300.0f);
+    props.Drag = 0.1f;
+    props.SizeEndScale = 0.25f;
+
+    ParticleEmitter serial(props);
+    props.ParticlesPerJob = 1024;
+    ParticleEmitter parallel(props);
+
+    JobSystem::getInstance().Init(4);
+    for (int frame = 0; frame < 30; ++frame) {
+        serial.Emit(2000, glm::vec2(0.0f));
+        parallel.Emit(2000, glm::vec2(0.0f));
+        serial.Update(1.0f / 60.0f);
+        parallel.Update(1.0f / 60.0f);
+    }
+    JobSystem::getInstance().Shutdown();
+
+    const size_t count = serial.GetCount();
+    ASSERT_EQ(parallel.GetCount(), count);
+    ASSERT_GT(count, 1024u);
+    EXPECT_TRUE(BitEqual(serial.GetPositionX(), parallel.GetPositionX(), count));
+    EXPECT_TRUE(BitEqual(serial.GetPositionY(), parallel.GetPositionY(), count));
+    EXPECT_TRUE(BitEqual(serial.GetVelocityY(), parallel.GetVelocityY(), count));
+    EXPECT_TRUE(BitEqual(serial.GetLife(), parallel.GetLife(), count));
+    EXPECT_TRUE(BitEqual(serial.GetSize(), parallel.GetSize(), count));
+}
+
+TEST(ParticleSystemTests, SystemRunsItsEmitters) {
+    ParticleSystem system;
+    ParticleEmitter::Properties props = StillProperties();
+    props.EmissionRate = 120.0f;
+    props.Lifetime = 10.0f;
+    ParticleEmitter& fountain = system.CreateEmitter(props);
+    ParticleEmitter& burst = system.CreateEmitter(StillProperties());
+    burst.Emit(10);
+
+    for (int step = 0; step < 4; ++step) {
+        system.Update(0.25f);
+    }
+    EXPECT_EQ(fountain.GetCount(), 120u);
+    EXPECT_EQ(burst.GetCount(), 0u);  // Lived one second
+    EXPECT_EQ(system.GetParticleCount(), 120u);
+
+    system.DestroyEmitter(burst);
+    EXPECT_EQ(system.GetEmitterCount(), 1u);
+}
+
+TEST(ParticleSystemTests, OneCommandPerNonEmptyEmitter) {
+    ParticleSystem system;
+    for (int i = 0; i < 3; ++i) {
+        system.CreateEmitter(StillProperties()).Emit(50 + i);
+    }
+    system.CreateEmitter(StillProperties());  // Never emits
+    ParticleEmitter& drained = system.CreateEmitter(StillProperties());
+    drained.Emit(10);
+    drained.Update(2.0f);
+
+    RenderQueue queue;
+    system.Submit(queue, 2);
+    ASSERT_EQ(queue.GetCommandCount(), 3u);
+    for (size_t i = 0; i < 3; ++i) {
+        const RenderCommand* command = queue.GetCommand(queue.GetEntries()[i]);
+        ASSERT_EQ(command->Type, RenderCommandType::InstancedQuads);
+        EXPECT_EQ(static_cast<const InstancedQuadsCommand*>(command)->Count, 50u + i);
+    }
+}
+
+TEST(ParticleSystemTests, LargeEmitterFitsTheBackendQueue) {
+    ParticleEmitter::Properties props = StillProperties();
+    props.MaxParticles = 200000;
+    ParticleEmitter emitter(props);
+    ASSERT_EQ(emitter.Emit(200000), 200000u);
+
+    // The queue the engine records into, at its default size
+    RenderBackend backend;
+    RenderQueue& queue = backend.GetSubmissionQueue();
+    emitter.Submit(queue, 0);
+
+    ASSERT_EQ(queue.GetCommandCount(), 1u);
+    EXPECT_EQ(queue.GetDroppedCount(), 0u);
+    const auto* command = static_cast<const InstancedQuadsCommand*>(queue.GetCommand(queue.GetEntries()[0]));
+    EXPECT_EQ(command->Count, 200000u);
+    EXPECT_FLOAT_EQ(queue.GetInstances(*command)[199999].Size.x, props.Size);
+}
+
+} // namespace
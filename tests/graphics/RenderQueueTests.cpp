@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include "graphics/RenderQueue.hpp"
+
+namespace {
+
+const QuadCommand* GetQuad(const RenderQueue& queue, size_t index) {
+    return static_cast<const QuadCommand*>(queue.GetCommand(queue.GetEntries()[index]));
+}
+
+} // namespace
+
+TEST(RenderQueueTests, SortKeyFieldOrder) {
+    // Layer dominates shader, shader dominates texture, texture dominates depth
+    EXPECT_LT(RenderKey::Make(0, 9, 9, 1.0f), RenderKey::Make(1, 0, 0, 0.0f));
+    EXPECT_LT(RenderKey::Make(1, 0, 9, 1.0f), RenderKey::Make(1, 1, 0, 0.0f));
+    EXPECT_LT(RenderKey::Make(1, 1, 0, 1.0f), RenderKey::Make(1, 1, 1, 0.0f));
+    EXPECT_LT(RenderKey::Make(1, 1, 1, 0.25f), RenderKey::Make(1, 1, 1, 0.75f));
+    EXPECT_EQ(RenderKey::GetLayer(RenderKey::Make(200, 1, 1, 0.5f)), 200);
+}
+
+TEST(RenderQueueTests, SortsByLayerThenDepth) {
+    RenderQueue queue;
+    queue.SubmitQuad(2, 0.5f, { 2.0f, 0.0f }, { 1.0f, 1.0f }, glm::vec4(1.0f));
+    queue.SubmitQuad(0, 0.9f, { 1.0f, 0.0f }, { 1.0f, 1.0f }, glm::vec4(1.0f));
+    queue.SubmitQuad(0, 0.1f, { 0.0f, 0.0f }, { 1.0f, 1.0f }, glm::vec4(1.0f));
+    queue.SubmitQuad(1, 0.0f, { 3.0f, 0.0f }, { 1.0f, 1.0f }, glm::vec4(1.0f));
+    ASSERT_EQ(queue.GetCommandCount(), 4u);
+
+    queue.Sort();
+
+    EXPECT_FLOAT_EQ(GetQuad(queue, 0)->Position.x, 0.0f);
+    EXPECT_FLOAT_EQ(GetQuad(queue, 1)->Position.x, 1.0f);
+    EXPECT_FLOAT_EQ(GetQuad(queue, 2)->Position.x, 3.0f);
+    EXPECT_FLOAT_EQ(GetQuad(queue, 3)->Position.x, 2.0f);
+}
+
+TEST(RenderQueueTests, SortIsStableForEqualKeys) {
+    RenderQueue queue;
+    for (int i = 0; i < 1000; ++i) {
+        // Alternate layers so the sort has real work to do
+        queue.SubmitQuad(static_cast<uint8_t>(i % 2), 0.0f, { static_cast<float>(i), 0.0f },
+                         { 1.0f, 1.0f }, glm::vec4(1.0f));
+    }
+
+    queue.Sort();
+
+    for (size_t i = 1; i < 500; ++i) {
+        EXPECT_LT(GetQuad(queue, i - 1)->Position.x, GetQuad(queue, i)->Position.x);
+    }
+    EXPECT_EQ(static_cast<int>(GetQuad(queue, 500)->Position.x) % 2, 1);
+}
+
+TEST(RenderQueueTests, InstancesAreCopiedIntoTheQueue) {
+    RenderQueue queue;
+    {
+        std::vector<QuadInstance> instances(16, QuadInstance({ 1.0f, 2.0f }, { 3.0f, 4.0f }));
+        queue.SubmitInstancedQuads(0, 0.0f, instances.data(), instances.size());
+    }
+
+    ASSERT_EQ(queue.GetCommandCount(), 1u);
+    const auto* command = static_cast<const InstancedQuadsCommand*>(queue.GetCommand(queue.GetEntries()[0]));
+    EXPECT_EQ(command->Type, RenderCommandType::InstancedQuads);
+    EXPECT_EQ(command->Count, 16u);
+    EXPECT_FLOAT_EQ(queue.GetInstances(*command)[15].Size.y, 4.0f);
+}
+
+TEST(RenderQueueTests, InstancesDoNotNeedArenaSpace) {
+    // Room for a few command packets but nowhere near the instance data
+    RenderQueue queue(1024);
+    const std::vector<QuadInstance> instances(10000, QuadInstance({ 1.0f, 2.0f }, { 3.0f, 4.0f }));
+    queue.SubmitInstancedQuads(0, 0.0f, instances.data(), instances.size());
+    queue.SubmitInstancedQuads(1, 0.0f, instances.data(), 5);
+
+    ASSERT_EQ(queue.GetCommandCount(), 2u);
+    EXPECT_EQ(queue.GetDroppedCount(), 0u);
+    const auto* second = static_cast<const InstancedQuadsCommand*>(queue.GetCommand(queue.GetEntries()[1]));
+    EXPECT_EQ(second->FirstInstance, 10000u);
+    EXPECT_FLOAT_EQ(queue.GetInstances(*second)[4].Position.x, 1.0f);
+}
+
+TEST(RenderQueueTests, DropsCommandsWhenArenaIsFull) {
+    RenderQueue queue(sizeof(QuadCommand) * 4);
+    for (int i = 0; i < 8; ++i) {
+        queue.SubmitQuad(0, 0.0f, { 0.0f, 0.0f }, { 1.0f, 1.0f }, glm::vec4(1.0f));
+    }
+
+    EXPECT_LE(queue.GetCommandCount(), 4u);
+    EXPECT_GT(queue.GetDroppedCount(), 0u);
+
+    queue.Reset();
+    EXPECT_EQ(queue.GetCommandCount(), 0u);
+    EXPECT_EQ(queue.GetDroppedCount(), 0u);
+}
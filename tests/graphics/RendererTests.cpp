@@ -1,19 +1,33 @@
 #include <gtest/gtest.h>
+#include "GLTestContext.hpp"
 #include "graphics/Renderer.hpp"
+#include "graphics/Camera2D.hpp"
+#include "graphics/GLStateCache.hpp"
+#include <glad/glad.h>
 #include <glm/gtc/matrix_transform.hpp>
+#include <memory>
 
+// Needs a GL 3.3+ context (Mesa llvmpipe works); skipped when none exists
 class RendererTests : public ::testing::Test {
 protected:
     void SetUp() override {
+        context = std::make_unique<GLTestContext>("RendererTests");
+        if (!context->IsAvailable()) {
+            GTEST_SKIP() << "No GL context available";
+        }
         renderer = &Renderer::getInstance();
         renderer->Init();
     }
 
     void TearDown() override {
-        renderer->Shutdown();
+        if (context->IsAvailable()) {
+            renderer->Shutdown();
+        }
+        context.reset();
     }
 
-    Renderer* renderer;
+    std::unique_ptr<GLTestContext> context;
+    Renderer* renderer = nullptr;
 };
 
 TEST_F(RendererTests, Initialization) {
@@ -35,3 +49,96 @@ TEST_F(RendererTests, ProjectionMatrix) {
     // Verify that the matrix was set correctly
     EXPECT_EQ(renderer->GetProjectionMatrix(), projection);
 }
+
+TEST_F(RendererTests, BatchedRectanglesShareDrawCalls) {
+    auto& batch = renderer->GetSpriteBatch();
+    batch.ResetStats();
+
+    const int quadCount = 100000;
+    renderer->BeginScene();
+    for (int i = 0; i < quadCount; ++i) {
+        renderer->DrawRectangle({ static_cast<float>(i % 800), static_cast<float>(i / 800) },
+                                { 4.0f, 4.0f }, { 1.0f, 0.0f, 0.0f, 1.0f });
+    }
+    renderer->EndScene();
+
+    EXPECT_EQ(batch.GetStats().QuadCount, static_cast<uint32_t>(quadCount));
+    EXPECT_EQ(batch.GetStats().DrawCalls, (quadCount + SpriteBatch::MaxQuads - 1) / SpriteBatch::MaxQuads);
+}
+
+TEST_F(RendererTests, DrawQuadsInstanced) {
+    auto& cache = GLStateCache::getInstance();
+    auto& batch = renderer->GetSpriteBatch();
+    std::vector<QuadInstance> instances;
+    for (int i = 0; i < 5000; ++i) {
+        instances.emplace_back(glm::vec2(static_cast<float>(i % 100), static_cast<float>(i / 100)),
+                               glm::vec2(1.0f), glm::vec4(0.0f, 1.0f, 0.0f, 1.0f));
+    }
+
+    // Only errors raised by the draw itself count
+    while (glGetError() != GL_NO_ERROR) {}
+    renderer->DrawQuadsInstanced(instances);
+    EXPECT_EQ(glGetError(), static_cast<GLenum>(GL_NO_ERROR));
+
+    // Drawing with no texture falls back to the white texture: binding it
+    // explicitly afterwards is redundant
+    renderer->BeginFrame();
+    renderer->DrawQuadsInstanced(instances.data(), instances.size(), &batch.GetWhiteTexture());
+    EXPECT_EQ(cache.GetStats().Issued, 0u);
+    EXPECT_GT(cache.GetStats().Skipped, 0u);
+
+    // Empty spans are a no-op: nothing is bound and pending quads stay batched
+    renderer->BeginFrame();
+    renderer->BeginScene();
+    renderer->DrawRectangle({ 0.0f, 0.0f }, { 1.0f, 1.0f }, glm::vec4(1.0f));
+    const GLStateCache::Stats cacheBefore = cache.GetStats();
+    const SpriteBatch::Stats batchBefore = batch.GetStats();
+    renderer->DrawQuadsInstanced(nullptr, 0);
+    renderer->DrawQuadsInstanced(instances.data(), 0);
+    EXPECT_EQ(cache.GetStats().Issued, cacheBefore.Issued);
+    EXPECT_EQ(cache.GetStats().Skipped, cacheBefore.Skipped);
+    EXPECT_EQ(batch.GetStats().DrawCalls, batchBefore.DrawCalls);
+    EXPECT_EQ(batch.GetStats().QuadCount, batchBefore.QuadCount);
+    renderer->EndScene();
+}
+
+TEST_F(RendererTests, StateCacheSkipsRedundantBinds) {
+    auto& cache = GLStateCache::getInstance();
+    const glm::vec4 red(1.0f, 0.0f, 0.0f, 1.0f);
+
+    // Warm up so the program, VAO and texture are already bound
+    renderer->DrawRectangle({ 0.0f, 0.0f }, { 1.0f, 1.0f }, red);
+
+    renderer->BeginFrame();
+    EXPECT_EQ(cache.GetStats().Issued, 0u);
+    EXPECT_EQ(cache.GetStats().Skipped, 0u);
+
+    // Same shader, VAO and texture as the previous draw: every bind is redundant
+    renderer->DrawRectangle({ 0.0f, 0.0f }, { 1.0f, 1.0f }, red);
+    EXPECT_EQ(cache.GetStats().Issued, 0u);
+    EXPECT_GT(cache.GetStats().Skipped, 0u);
+}
+
+TEST_F(RendererTests, CameraCullsOffscreenRectangles) {
+    Camera2D camera(800.0f, 600.0f);
+    camera.SetPosition({ 400.0f, 300.0f });
+    renderer->SetCamera(camera);
+    EXPECT_EQ(renderer->GetProjectionMatrix(), camera.GetProjectionMatrix());
+    EXPECT_EQ(renderer->GetViewMatrix(), camera.GetViewMatrix());
+
+    auto& batch = renderer->GetSpriteBatch();
+    batch.ResetStats();
+    renderer->BeginFrame();
+    renderer->BeginScene();
+    renderer->DrawRectangle({ 100.0f, 100.0f }, { 10.0f, 10.0f }, glm::vec4(1.0f));
+    renderer->DrawRectangle({ 798.0f, 300.0f }, { 10.0f, 10.0f }, glm::vec4(1.0f));  // Straddles the edge
+    renderer->DrawRectangle({ -50.0f, 100.0f }, { 10.0f, 10.0f }, glm::vec4(1.0f));
+    renderer->DrawRectangle({ 400.0f, 900.0f }, { 10.0f, 10.0f }, glm::vec4(1.0f));
+    renderer->EndScene();
+    EXPECT_EQ(batch.GetStats().QuadCount, 2u);
+    EXPECT_EQ(renderer->GetCulledCount(), 2u);
+
+    // Raw matrices carry no view bounds, so nothing is culled
+    renderer->SetViewMatrix(glm::mat4(1.0f));
+    EXPECT_TRUE(renderer->IsVisible({ { -1e6f, -1e6f }, { -1e6f + 1.0f, -1e6f + 1.0f } }));
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include "graphics/SkylinePacker.hpp"
+#include "graphics/AtlasBuilder.hpp"
+#include "graphics/AtlasFormat.hpp"
+#include "core/MappedFile.hpp"
+#include "utils/Hash.hpp"
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+bool Overlaps(const SkylinePacker::Rect& a, const SkylinePacker::Rect& b) {
+    return a.X < b.X + b.Width && b.X < a.X + a.Width &&
+           a.Y < b.Y + b.Height && b.Y < a.Y + a.Height;
+}
+
+} // namespace
+
+TEST(TextureAtlasTests, SkylinePackerPlacesWithoutOverlap) {
+    SkylinePacker packer(256, 256, 1);
+    std::vector<SkylinePacker::Rect> placed;
+
+    for (int i = 0; i < 200; ++i) {
+        const int width = 4 + (i * 7) % 29;
+        const int height = 4 + (i * 13) % 23;
+        SkylinePacker::Rect rect;
+        if (!packer.Pack(width, height, rect)) break;
+
+        EXPECT_EQ(rect.Width, width);
+        EXPECT_EQ(rect.Height, height);
+        EXPECT_GE(rect.X, 0);
+        EXPECT_GE(rect.Y, 0);
+        EXPECT_LE(rect.X + rect.Width, 256);
+        EXPECT_LE(rect.Y + rect.Height, 256);
+        for (const auto& other : placed) {
+            EXPECT_FALSE(Overlaps(rect, other));
+        }
+        placed.push_back(rect);
+    }
+
+    EXPECT_GT(placed.size(), 50u);
+    EXPECT_GT(packer.GetOccupancy(), 0.5f);
+}
+
+TEST(TextureAtlasTests, SkylinePackerRejectsOversizeRect) {
+    SkylinePacker packer(64, 64, 1);
+    SkylinePacker::Rect rect;
+    EXPECT_FALSE(packer.Pack(65, 10, rect));
+    EXPECT_FALSE(packer.Pack(10, 65, rect));
+    // A rect that exactly fills the page needs no gutter at the edges
+    EXPECT_TRUE(packer.Pack(64, 64, rect));
+    EXPECT_FALSE(packer.Pack(1, 1, rect));
+}
+
+TEST(TextureAtlasTests, BuilderSpillsOntoNewPages) {
+    std::vector<unsigned char> pixels(32 * 32 * 4, 255);
+    std::vector<AtlasBuilder::Image> images;
+    for (int i = 0; i < 6; ++i) {
+        images.push_back({ "sprite" + std::to_string(i), 32, 32, pixels.data() });
+    }
+
+    // Four 32x32 sprites fill a 64x64 page; the rest need a second one
+    AtlasBuilder builder(64, 0);
+    ASSERT_TRUE(builder.Build(images));
+    EXPECT_EQ(builder.GetRegions().size(), 6u);
+    EXPECT_EQ(builder.GetPages().size(), 2u);
+
+    AtlasBuilder tooSmall(16, 0);
+    EXPECT_FALSE(tooSmall.Build(images));
+}
+
+TEST(TextureAtlasTests, IndexRoundTripsThroughMappedFile) {
+    std::vector<unsigned char> red(8 * 4 * 4, 0);
+    std::vector<unsigned char> blue(4 * 8 * 4, 0);
+    std::vector<AtlasBuilder::Image> images = {
+        { "player_idle", 8, 4, red.data() },
+        { "coin", 4, 8, blue.data() },
+    };
+
+    AtlasBuilder builder(32, 1);
+    ASSERT_TRUE(builder.Build(images));
+
+    const std::string path = "texture_atlas_test.atlas";
+    ASSERT_TRUE(builder.WriteIndex(path, { "texture_atlas_test_0.tga" }));
+
+    MappedFile file;
+    ASSERT_TRUE(file.Open(path));
+    const uint8_t* data = file.GetData();
+
+    AtlasFileHeader header;
+    ASSERT_GE(file.GetSize(), sizeof(header));
+    std::memcpy(&header, data, sizeof(header));
+    EXPECT_EQ(std::memcmp(header.Magic, AtlasFormat::Magic, 4), 0);
+    EXPECT_EQ(header.Version, AtlasFormat::Version);
+    EXPECT_EQ(header.PageCount, 1u);
+    ASSERT_EQ(header.RegionCount, 2u);
+    EXPECT_EQ(header.RegionTableOffset % 8, 0u);
+
+    const auto* regions = reinterpret_cast<const AtlasRegionEntry*>(data + header.RegionTableOffset);
+    const char* strings = reinterpret_cast<const char*>(data + header.StringTableOffset);
+    EXPECT_LT(regions[0].NameHash, regions[1].NameHash);
+
+    for (uint32_t i = 0; i < header.RegionCount; ++i) {
+        const std::string name = strings + regions[i].NameOffset;
+        EXPECT_EQ(regions[i].NameHash, HashString(name));
+        if (name == "player_idle") {
+            EXPECT_EQ(regions[i].Width, 8u);
+            EXPECT_EQ(regions[i].Height, 4u);
+            EXPECT_FLOAT_EQ(regions[i].U1 - regions[i].U0, 8.0f / 32.0f);
+        } else {
+            EXPECT_EQ(name, "coin");
+            EXPECT_FLOAT_EQ(regions[i].V1 - regions[i].V0, 8.0f / 32.0f);
+        }
+    }
+
+    file.Close();
+    std::remove(path.c_str());
+}
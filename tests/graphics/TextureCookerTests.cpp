@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include "graphics/TextureCooker.hpp"
+#include "graphics/TextureFormat.hpp"
+#include "graphics/Texture.hpp"
+#include "core/MappedFile.hpp"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+TEST(TextureCookerTests, MipChainHalvesDownToOnePixel) {
+    std::vector<unsigned char> pixels(5 * 3 * 4, 100);
+    auto mips = TextureCooker::BuildMipChain(pixels.data(), 5, 3, 4);
+
+    ASSERT_EQ(mips.size(), 3u);
+    EXPECT_EQ(mips[0].Width, 5);
+    EXPECT_EQ(mips[0].Height, 3);
+    EXPECT_EQ(mips[1].Width, 2);
+    EXPECT_EQ(mips[1].Height, 1);
+    EXPECT_EQ(mips[2].Width, 1);
+    EXPECT_EQ(mips[2].Height, 1);
+    EXPECT_EQ(mips[2].Pixels.size(), 4u);
+
+    // A flat image stays flat at every level
+    for (const auto& mip : mips) {
+        for (unsigned char value : mip.Pixels) {
+            EXPECT_EQ(value, 100);
+        }
+    }
+}
+
+TEST(TextureCookerTests, MipChainAveragesBoxes) {
+    // 2x2 single-channel image
+    const unsigned char pixels[] = { 0, 100, 200, 100 };
+    auto mips = TextureCooker::BuildMipChain(pixels, 2, 2, 1);
+
+    ASSERT_EQ(mips.size(), 2u);
+    EXPECT_EQ(mips[1].Pixels[0], 100);
+}
+
+TEST(TextureCookerTests, WrittenFileIsUploadReady) {
+    std::vector<unsigned char> pixels(8 * 4 * 3);
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        pixels[i] = static_cast<unsigned char>(i);
+    }
+    auto mips = TextureCooker::BuildMipChain(pixels.data(), 8, 4, 3);
+
+    const std::string path = std::string("texture_cooker_test") + TextureFormat::Extension;
+    ASSERT_TRUE(TextureCooker::Write(path, mips, 3, false));
+
+    MappedFile file;
+    ASSERT_TRUE(file.Open(path));
+
+    TextureFileHeader header;
+    std::memcpy(&header, file.GetData(), sizeof(header));
+    EXPECT_EQ(std::memcmp(header.Magic, TextureFormat::Magic, 4), 0);
+    EXPECT_EQ(header.Width, 8u);
+    EXPECT_EQ(header.Height, 4u);
+    EXPECT_EQ(header.Channels, 3u);
+    EXPECT_EQ(header.Compression, static_cast<uint32_t>(TextureFormat::Compression::None));
+    ASSERT_EQ(header.MipCount, mips.size());
+
+    const auto* entries = reinterpret_cast<const TextureMipEntry*>(file.GetData() + sizeof(header));
+    for (uint32_t level = 0; level < header.MipCount; ++level) {
+        EXPECT_EQ(entries[level].Offset % 16, 0u);
+        EXPECT_EQ(entries[level].Width, static_cast<uint32_t>(mips[level].Width));
+        ASSERT_EQ(entries[level].Size, mips[level].Pixels.size());
+        ASSERT_LE(entries[level].Offset + entries[level].StoredSize, file.GetSize());
+        EXPECT_EQ(std::memcmp(file.GetData() + entries[level].Offset, mips[level].Pixels.data(), entries[level].Size), 0);
+    }
+
+    file.Close();
+    std::remove(path.c_str());
+}
+
+TEST(TextureCookerTests, LoadRejectsMipOffsetThatWraps) {
+    std::vector<unsigned char> pixels(8 * 4 * 3, 50);
+    auto mips = TextureCooker::BuildMipChain(pixels.data(), 8, 4, 3);
+
+    const std::string path = std::string("texture_cooker_corrupt_test") + TextureFormat::Extension;
+    ASSERT_TRUE(TextureCooker::Write(path, mips, 3, false));
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        // Offset + StoredSize wraps around to a small number that looks in bounds
+        TextureMipEntry entry;
+        file.seekg(sizeof(TextureFileHeader));
+        file.read(reinterpret_cast<char*>(&entry), sizeof(entry));
+        entry.Offset = ~uint64_t(0) - 15;
+        file.seekp(sizeof(TextureFileHeader));
+        file.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+    }
+
+    // Rejected while validating, before any GL call
+    Texture texture;
+    EXPECT_FALSE(texture.LoadFromContainer(path));
+    EXPECT_EQ(texture.GetID(), 0u);
+
+    std::remove(path.c_str());
+}
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 #include "graphics/Texture.hpp"
+#include "graphics/AsyncTextureLoader.hpp"
+#include "core/ResourceManager.hpp"
+#include <chrono>
 
 class TextureTests : public ::testing::Test {
 protected:
@@ -25,3 +28,20 @@ TEST_F(TextureTests, InvalidTextureLoading) {
     EXPECT_FALSE(loaded);
     EXPECT_EQ(texture.GetID(), 0);
 }
+
+TEST_F(TextureTests, AsyncLoadOfMissingFileResolvesToNull) {
+    auto& loader = AsyncTextureLoader::getInstance();
+    ASSERT_TRUE(loader.Init(1));
+
+    // Decoding fails on the worker, so no GL upload is ever needed
+    auto& manager = ResourceManager::getInstance();
+    auto future = manager.loadTextureAsync("missing", "nonexistent.png");
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_EQ(future.get(), nullptr);
+
+    manager.updateAsyncLoads();
+    EXPECT_EQ(manager.getPendingAsyncLoadCount(), 0u);
+    EXPECT_FALSE(manager.hasResource<Texture>("missing"));
+
+    loader.Shutdown();
+}
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+#include "GLTestContext.hpp"
+#include "graphics/TileMap.hpp"
+#include "graphics/Camera2D.hpp"
+#include "graphics/Renderer.hpp"
+#include <memory>
+
+TEST(TilesetTests, TileUVsRunFromTheTopLeft) {
+    Tileset tileset;
+    tileset.UVRect = { 0.5f, 0.0f, 1.0f, 0.5f };
+    tileset.Columns = 2;
+    tileset.Rows = 2;
+
+    // Tile 1 is the top-left cell, tile 4 the bottom-right one
+    EXPECT_EQ(tileset.GetTileUV(1), glm::vec4(0.5f, 0.25f, 0.75f, 0.5f));
+    EXPECT_EQ(tileset.GetTileUV(2), glm::vec4(0.75f, 0.25f, 1.0f, 0.5f));
+    EXPECT_EQ(tileset.GetTileUV(4), glm::vec4(0.75f, 0.0f, 1.0f, 0.25f));
+}
+
+TEST(TileMapEditTests, TileAccessAndCoordinates) {
+    TileMap map(100, 40, 16.0f, { -64.0f, 32.0f });
+    EXPECT_EQ(map.GetChunksX(), 4);
+    EXPECT_EQ(map.GetChunksY(), 2);
+
+    map.SetTile(5, 5, 3);
+    EXPECT_EQ(map.GetTile(5, 5), 3);
+    EXPECT_EQ(map.GetTile(-1, 5), TileMap::EmptyTile);
+    map.SetTile(100, 0, 1);  // Ignored
+
+    EXPECT_EQ(map.WorldToTile({ -64.0f, 32.0f }), glm::ivec2(0, 0));
+    EXPECT_EQ(map.WorldToTile({ -65.0f, 48.0f }), glm::ivec2(-1, 1));
+    EXPECT_EQ(map.TileToWorld(2, 1), glm::vec2(-32.0f, 48.0f));
+}
+
+// Needs a GL 3.3+ context (Mesa llvmpipe works); skipped when none exists
+class TileMapTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        context = std::make_unique<GLTestContext>("TileMapTests");
+        if (!context->IsAvailable()) {
+            GTEST_SKIP() << "No GL context available";
+        }
+        Renderer::getInstance().Init();
+    }
+
+    void TearDown() override {
+        map.reset();
+        if (context->IsAvailable()) {
+            Renderer::getInstance().Shutdown();
+        }
+        context.reset();
+    }
+
+    // 4x3 chunks, every tile solid
+    void CreateFullMap() {
+        map = std::make_unique<TileMap>(4 * TileMap::ChunkSize, 3 * TileMap::ChunkSize, 1.0f);
+        map->Fill(0, 0, map->GetWidth(), map->GetHeight(), 1);
+    }
+
+    std::unique_ptr<GLTestContext> context;
+    std::unique_ptr<TileMap> map;
+};
+
+TEST_F(TileMapTests, DrawsOneCallPerVisibleChunk) {
+    CreateFullMap();
+
+    // Spans chunk columns 1-2 and rows 0-1
+    map->Draw({ 40.0f, 10.0f }, { 70.0f, 40.0f });
+    EXPECT_EQ(map->GetStats().ChunksVisible, 4u);
+    EXPECT_EQ(map->GetStats().DrawCalls, 4u);
+    EXPECT_EQ(map->GetStats().ChunksRebuilt, 4u);
+    EXPECT_EQ(map->GetStats().TilesDrawn, 4u * TileMap::ChunkSize * TileMap::ChunkSize);
+
+    // Outside the map entirely
+    map->ResetStats();
+    map->Draw({ -100.0f, -100.0f }, { -10.0f, -10.0f });
+    EXPECT_EQ(map->GetStats().DrawCalls, 0u);
+}
+
+TEST_F(TileMapTests, DrawsWhatTheCameraSees) {
+    CreateFullMap();
+
+    // 40x20 units around (50, 25): chunk columns 0-2, rows 0-1
+    Camera2D camera(80.0f, 40.0f);
+    camera.SetZoom(2.0f);
+    camera.SetPosition({ 50.0f, 25.0f });
+    map->Draw(camera);
+    EXPECT_EQ(map->GetStats().ChunksVisible, 6u);
+    EXPECT_EQ(map->GetStats().DrawCalls, 6u);
+}
+
+TEST_F(TileMapTests, EditRebuildsOnlyItsChunk) {
+    CreateFullMap();
+    const glm::vec2 viewMin(0.0f), viewMax(1000.0f);
+    map->Draw(viewMin, viewMax);
+    EXPECT_EQ(map->GetStats().ChunksRebuilt, 12u);
+
+    map->ResetStats();
+    map->Draw(viewMin, viewMax);
+    EXPECT_EQ(map->GetStats().ChunksRebuilt, 0u);
+    EXPECT_EQ(map->GetStats().DrawCalls, 12u);
+
+    map->SetTile(70, 40, TileMap::EmptyTile);
+    EXPECT_TRUE(map->IsChunkDirty(2, 1));
+    EXPECT_FALSE(map->IsChunkDirty(1, 1));
+
+    map->ResetStats();
+    map->Draw(viewMin, viewMax);
+    EXPECT_EQ(map->GetStats().ChunksRebuilt, 1u);
+    EXPECT_EQ(map->GetStats().TilesDrawn, 12u * TileMap::ChunkSize * TileMap::ChunkSize - 1);
+}
+
+TEST_F(TileMapTests, EmptyChunksAreSkipped) {
+    map = std::make_unique<TileMap>(4 * TileMap::ChunkSize, TileMap::ChunkSize, 1.0f);
+    map->SetTile(TileMap::ChunkSize + 3, 3, 1);
+
+    map->Draw({ 0.0f, 0.0f }, { 1000.0f, 1000.0f });
+    EXPECT_EQ(map->GetStats().ChunksVisible, 4u);
+    EXPECT_EQ(map->GetStats().DrawCalls, 1u);
+    EXPECT_EQ(map->GetResidentChunkCount(), 1u);
+}
+
+TEST_F(TileMapTests, ResidentChunksStayWithinBudget) {
+    CreateFullMap();
+    map->SetMaxResidentChunks(3);
+
+    // Walk the view across every chunk; the oldest ones are released
+    for (int chunkX = 0; chunkX < map->GetChunksX(); ++chunkX) {
+        const float x = chunkX * TileMap::ChunkSize + 1.0f;
+        map->Draw({ x, 1.0f }, { x + 1.0f, 70.0f });
+        EXPECT_LE(map->GetResidentChunkCount(), 3u);
+    }
+    EXPECT_TRUE(map->IsChunkDirty(0, 0));
+    EXPECT_FALSE(map->IsChunkDirty(3, 2));
+}
@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+#include "level/CollisionBaker.hpp"
+#include "level/LevelCollision.hpp"
+#include "level/LevelCooker.hpp"
+#include "physics/PhysicsWorld.hpp"
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using LevelFormat::Collision;
+
+// Rasterizes baked colliders back onto a tile grid; -1 marks overlaps
+std::vector<int> Rasterize(const std::vector<CollisionBaker::Collider>& colliders, int width, int height) {
+    std::vector<int> grid(static_cast<size_t>(width) * height, 0);
+    for (const CollisionBaker::Collider& collider : colliders) {
+        for (int y = static_cast<int>(collider.Box.Min.y); y < static_cast<int>(collider.Box.Max.y); ++y) {
+            for (int x = static_cast<int>(collider.Box.Min.x); x < static_cast<int>(collider.Box.Max.x); ++x) {
+                int& cell = grid[static_cast<size_t>(y) * width + x];
+                const int type = collider.Type == StaticType::OneWay ? 2 : 1;
+                cell = cell == 0 ? type : -1;
+            }
+        }
+    }
+    return grid;
+}
+
+TEST(CollisionBakerTests, MergesSolidBlocksIntoRectangles) {
+    // 6x4, bottom row first: a 4x2 block with a one-tile bump on top, plus a one-way ledge
+    std::vector<Collision> tiles(24, Collision::None);
+    auto set = [&](int x, int y, Collision type) { tiles[y * 6 + x] = type; };
+    for (int y = 0; y < 2; ++y) {
+        for (int x = 0; x < 4; ++x) set(x, y, Collision::Solid);
+    }
+    set(1, 2, Collision::Solid);
+    set(3, 3, Collision::OneWay);
+    set(4, 3, Collision::OneWay);
+    set(5, 3, Collision::OneWay);
+    set(4, 2, Collision::OneWay);
+
+    std::vector<CollisionBaker::Collider> colliders;
+    CollisionBaker::Bake(tiles.data(), 6, 4, 6, 16.0f, { 100.0f, 200.0f }, colliders);
+
+    ASSERT_EQ(colliders.size(), 4u);
+    EXPECT_EQ(colliders[0].Box.Min, glm::vec2(100.0f, 200.0f));
+    EXPECT_EQ(colliders[0].Box.Max, glm::vec2(164.0f, 232.0f));
+    EXPECT_EQ(colliders[0].Type, StaticType::Solid);
+    EXPECT_EQ(colliders[1].Box.Min, glm::vec2(116.0f, 232.0f));
+    EXPECT_EQ(colliders[1].Box.Max, glm::vec2(132.0f, 248.0f));
+
+    // Stacked one-way tiles each keep their own top
+    EXPECT_EQ(colliders[2].Type, StaticType::OneWay);
+    EXPECT_EQ(colliders[2].Box.Max.y - colliders[2].Box.Min.y, 16.0f);
+    EXPECT_EQ(colliders[3].Type, StaticType::OneWay);
+    EXPECT_EQ(colliders[3].Box.Max.x - colliders[3].Box.Min.x, 48.0f);
+}
+
+TEST(CollisionBakerTests, CoversExactlyTheCollisionTiles) {
+    constexpr int Width = 57;
+    constexpr int Height = 41;
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> type(0, 5);
+    std::vector<Collision> tiles(Width * Height);
+    for (Collision& tile : tiles) {
+        const int roll = type(rng);
+        tile = roll < 3 ? Collision::Solid : roll == 3 ? Collision::OneWay : Collision::None;
+    }
+
+    std::vector<CollisionBaker::Collider> colliders;
+    CollisionBaker::Bake(tiles.data(), Width, Height, Width, 1.0f, glm::vec2(0.0f), colliders);
+
+    const std::vector<int> grid = Rasterize(colliders, Width, Height);
+    for (size_t i = 0; i < tiles.size(); ++i) {
+        ASSERT_EQ(grid[i], static_cast<int>(tiles[i])) << "tile " << i;
+    }
+}
+
+TEST(CollisionBakerTests, TypicalLevelNeedsFarFewerColliders) {
+    // Ground, walls and floating platforms, as a 256x64 level might be laid out
+    constexpr int Width = 256;
+    constexpr int Height = 64;
+    std::vector<Collision> tiles(Width * Height, Collision::None);
+    auto fill = [&](int x0, int y0, int w, int h, Collision type) {
+        for (int y = y0; y < y0 + h; ++y) {
+            for (int x = x0; x < x0 + w; ++x) tiles[y * Width + x] = type;
+        }
+    };
+    fill(0, 0, Width, 4, Collision::Solid);
+    fill(0, 4, 2, 60, Collision::Solid);
+    fill(Width - 2, 4, 2, 60, Collision::Solid);
+    for (int i = 0; i < 12; ++i) {
+        fill(8 + i * 20, 10 + (i % 4) * 10, 8, 2, Collision::Solid);
+        fill(14 + i * 20, 18 + (i % 3) * 12, 5, 1, Collision::OneWay);
+    }
+
+    size_t tileCount = 0;
+    for (Collision tile : tiles) {
+        tileCount += tile != Collision::None;
+    }
+
+    std::vector<CollisionBaker::Collider> colliders;
+    CollisionBaker::Bake(tiles.data(), Width, Height, Width, 16.0f, glm::vec2(0.0f), colliders);
+    EXPECT_LE(colliders.size() * 10, tileCount);
+}
+
+// A 96x48 level in 32-tile sections: solid ground two tiles deep
+class LevelCollisionTests : public ::testing::Test {
+protected:
+    static constexpr float TileSize = 16.0f;
+
+    void SetUp() override {
+        LevelCooker::Level level;
+        level.Width = 96;
+        level.Height = 48;
+        level.TileSize = TileSize;
+        level.Tiles.assign(level.Width * level.Height, 0);
+        level.Collision.assign(level.Tiles.size(), Collision::None);
+        for (int x = 0; x < level.Width; ++x) {
+            level.Collision[x] = Collision::Solid;
+            level.Collision[level.Width + x] = Collision::Solid;
+        }
+
+        path = std::string("level_collision_test") + LevelFormat::Extension;
+        ASSERT_TRUE(LevelCooker::Write(path, level, 32));
+        ASSERT_TRUE(streamer.Open(path));
+    }
+
+    void TearDown() override {
+        streamer.Close();
+        std::remove(path.c_str());
+    }
+
+    std::string path;
+    LevelStreamer streamer;
+};
+
+TEST_F(LevelCollisionTests, SectionsBringTheirBakedColliders) {
+    PhysicsWorld world;
+    LevelCollision collision(world, streamer);
+    streamer.SetOnSectionLoaded([&](const LevelStreamer::Section& section) { collision.OnSectionLoaded(section); });
+    streamer.SetOnSectionUnloaded([&](const LevelStreamer::Section& section) { collision.OnSectionUnloaded(section); });
+
+    // The ground of each section is a single box
+    const LevelStreamer::Section first = streamer.GetSection(0, 0);
+    ASSERT_EQ(first.ColliderCount, 1u);
+    EXPECT_EQ(first.Colliders[0].MaxX, 32 * TileSize);
+    EXPECT_EQ(first.Colliders[0].MaxY, 2 * TileSize);
+
+    streamer.Update({ 0.0f, 0.0f }, { 1000.0f, 100.0f });
+    EXPECT_EQ(collision.GetColliderCount(), 2u);
+    EXPECT_EQ(world.GetStaticCount(), 2u);
+    EXPECT_EQ(collision.GetCollision(40, 1), Collision::Solid);
+    EXPECT_EQ(collision.GetCollision(80, 1), Collision::None);  // Not loaded
+    EXPECT_EQ(collision.GetStats().SectionsRebaked, 0u);
+
+    streamer.SetOnSectionLoaded(nullptr);
+    streamer.SetOnSectionUnloaded(nullptr);
+}
+
+TEST_F(LevelCollisionTests, DestroyedTilesOpenAHole) {
+    PhysicsWorld world;
+    LevelCollision collision(world, streamer);
+    streamer.SetOnSectionLoaded([&](const LevelStreamer::Section& section) { collision.OnSectionLoaded(section); });
+    streamer.SetOnSectionUnloaded([&](const LevelStreamer::Section& section) { collision.OnSectionUnloaded(section); });
+    streamer.Update({ 0.0f, 0.0f }, { 1000.0f, 100.0f });
+
+    // A body resting on the ground of the second section
+    const BodyId body = world.CreateBody({ { 40.5f * TileSize, 2 * TileSize + 6.0f }, { 6.0f, 6.0f } });
+    for (int step = 0; step < 30; ++step) world.Step(1.0f / 60.0f);
+    ASSERT_TRUE(world.IsGrounded(body));
+
+    for (int y = 0; y < 2; ++y) {
+        for (int x = 39; x <= 42; ++x) {
+            EXPECT_TRUE(collision.SetCollision(x, y, Collision::None));
+        }
+    }
+    collision.Update();
+    EXPECT_EQ(collision.GetStats().SectionsRebaked, 1u);
+    // Left and right of the hole; the first section is untouched
+    EXPECT_EQ(collision.GetColliderCount(), 3u);
+
+    for (int step = 0; step < 30; ++step) world.Step(1.0f / 60.0f);
+    EXPECT_LT(world.GetPosition(body).y, 0.0f);
+
+    // Edits outlive unloading the section
+    streamer.Close();
+    EXPECT_EQ(world.GetStaticCount(), 0u);
+    ASSERT_TRUE(streamer.Open(path));
+    streamer.Update({ 0.0f, 0.0f }, { 1000.0f, 100.0f });
+    EXPECT_EQ(collision.GetCollision(40, 0), Collision::None);
+    EXPECT_EQ(collision.GetColliderCount(), 3u);
+
+    streamer.SetOnSectionLoaded(nullptr);
+    streamer.SetOnSectionUnloaded(nullptr);
+}
+
+} // namespace
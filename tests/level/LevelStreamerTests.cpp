@@ -0,0 +1,206 @@
+#include <gtest/gtest.h>
+#include "level/LevelCooker.hpp"
+#include "level/LevelStreamer.hpp"
+#include "utils/Hash.hpp"
+#include <cstdio>
+#include <fstream>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// 100x70 tiles in 32-tile sections: 4x3 sections, the last row and column partial
+class LevelStreamerTests : public ::testing::Test {
+protected:
+    static constexpr int SectionSize = 32;
+    static constexpr float TileSize = 10.0f;
+    static constexpr float SectionWorldSize = SectionSize * TileSize;
+
+    void SetUp() override {
+        level.Width = 100;
+        level.Height = 70;
+        level.TileSize = TileSize;
+        level.Tiles.resize(level.Width * level.Height);
+        level.Collision.resize(level.Tiles.size());
+        for (int y = 0; y < level.Height; ++y) {
+            for (int x = 0; x < level.Width; ++x) {
+                const size_t i = static_cast<size_t>(y) * level.Width + x;
+                level.Tiles[i] = static_cast<uint16_t>(1 + (x * 7 + y * 13) % 200);
+                // Rows of ground and ledges, so each section's colliders fit in its one page
+                level.Collision[i] = y % 4 == 0 ? LevelFormat::Collision::Solid
+                                   : y % 4 == 2 && x < 50 ? LevelFormat::Collision::OneWay
+                                   : LevelFormat::Collision::None;
+            }
+        }
+        level.Spawns.push_back({ "Player", { 15.0f, 25.0f }, 0 });
+        level.Spawns.push_back({ "Coin", { 650.0f, 400.0f }, 5 });
+
+        path = std::string("level_streamer_test") + LevelFormat::Extension;
+        ASSERT_TRUE(LevelCooker::Write(path, level, SectionSize));
+    }
+
+    void TearDown() override {
+        std::remove(path.c_str());
+    }
+
+    // View covering exactly one section
+    static std::pair<glm::vec2, glm::vec2> SectionView(int x, int y) {
+        const glm::vec2 min(x * SectionWorldSize + 1.0f, y * SectionWorldSize + 1.0f);
+        return { min, min + glm::vec2(SectionWorldSize - 2.0f) };
+    }
+
+    LevelCooker::Level level;
+    std::string path;
+};
+
+TEST_F(LevelStreamerTests, SectionsRoundTrip) {
+    LevelStreamer streamer;
+    ASSERT_TRUE(streamer.Open(path));
+    EXPECT_EQ(streamer.GetHeader().SectionsX, 4u);
+    EXPECT_EQ(streamer.GetHeader().SectionsY, 3u);
+
+    for (int sectionY = 0; sectionY < 3; ++sectionY) {
+        for (int sectionX = 0; sectionX < 4; ++sectionX) {
+            const LevelStreamer::Section section = streamer.GetSection(sectionX, sectionY);
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(section.Tiles) % LevelFormat::SectionAlignment, 0u);
+
+            for (int y = 0; y < SectionSize; ++y) {
+                for (int x = 0; x < SectionSize; ++x) {
+                    const int tileX = section.TileX + x;
+                    const int tileY = section.TileY + y;
+                    const bool inside = tileX < level.Width && tileY < level.Height;
+                    const size_t source = static_cast<size_t>(tileY) * level.Width + tileX;
+                    const size_t target = static_cast<size_t>(y) * SectionSize + x;
+                    ASSERT_EQ(section.Tiles[target], inside ? level.Tiles[source] : 0);
+                    ASSERT_EQ(section.Collision[target], inside ? level.Collision[source] : LevelFormat::Collision::None);
+                }
+            }
+        }
+    }
+
+    // Spawns are stored with the section they are in
+    const LevelStreamer::Section first = streamer.GetSection(0, 0);
+    ASSERT_EQ(first.SpawnCount, 1u);
+    EXPECT_EQ(first.Spawns[0].TypeHash, HashString("Player"));
+    const LevelStreamer::Section coin = streamer.GetSection(2, 1);
+    ASSERT_EQ(coin.SpawnCount, 1u);
+    EXPECT_EQ(coin.Spawns[0].Param, 5u);
+    EXPECT_EQ(coin.Spawns[0].X, 650.0f);
+}
+
+TEST_F(LevelStreamerTests, OpenLoadsNothing) {
+    LevelStreamer streamer;
+    ASSERT_TRUE(streamer.Open(path));
+    EXPECT_EQ(streamer.GetLoadedSectionCount(), 0u);
+    EXPECT_EQ(streamer.GetResidentBytes(), 0u);
+}
+
+TEST_F(LevelStreamerTests, LoadsViewAndEvictsOverBudget) {
+    LevelStreamer::Properties properties;
+    properties.MemoryBudget = 3 * LevelFormat::SectionAlignment;  // Three one-page sections
+    LevelStreamer streamer;
+    ASSERT_TRUE(streamer.Open(path, properties));
+
+    std::set<std::pair<int, int>> loaded;
+    streamer.SetOnSectionLoaded([&](const LevelStreamer::Section& section) {
+        EXPECT_TRUE(loaded.insert({ section.X, section.Y }).second);
+    });
+    streamer.SetOnSectionUnloaded([&](const LevelStreamer::Section& section) {
+        EXPECT_EQ(loaded.erase({ section.X, section.Y }), 1u);
+    });
+
+    // Straddles sections (0,0) and (1,0)
+    streamer.Update({ 200.0f, 10.0f }, { 400.0f, 100.0f });
+    EXPECT_EQ(loaded, (std::set<std::pair<int, int>>{ { 0, 0 }, { 1, 0 } }));
+
+    // Walking right keeps the three most recent sections
+    for (int x = 1; x < 4; ++x) {
+        const auto view = SectionView(x, 0);
+        streamer.Update(view.first, view.second);
+        EXPECT_TRUE(streamer.IsSectionLoaded(x, 0));
+        EXPECT_LE(streamer.GetResidentBytes(), properties.MemoryBudget);
+    }
+    EXPECT_EQ(loaded, (std::set<std::pair<int, int>>{ { 1, 0 }, { 2, 0 }, { 3, 0 } }));
+    EXPECT_EQ(streamer.GetStats().SectionsUnloaded, 1u);
+
+    // Closing hands every loaded section back
+    streamer.Close();
+    EXPECT_TRUE(loaded.empty());
+}
+
+TEST_F(LevelStreamerTests, PrefetchesAlongVelocity) {
+    LevelStreamer::Properties properties;
+    properties.PrefetchTime = 1.0f;
+    LevelStreamer streamer;
+    ASSERT_TRUE(streamer.Open(path, properties));
+
+    int loads = 0;
+    streamer.SetOnSectionLoaded([&](const LevelStreamer::Section&) { ++loads; });
+
+    // Moving up and right fast enough to reach the next section within a second
+    const auto view = SectionView(1, 1);
+    streamer.Update(view.first, view.second, { SectionWorldSize, SectionWorldSize * 0.5f });
+    EXPECT_EQ(loads, 1);
+    EXPECT_TRUE(streamer.IsSectionLoaded(1, 1));
+    EXPECT_TRUE(streamer.IsSectionResident(2, 1));
+    EXPECT_TRUE(streamer.IsSectionResident(2, 2));
+    EXPECT_TRUE(streamer.IsSectionResident(1, 2));
+    EXPECT_FALSE(streamer.IsSectionLoaded(2, 1));
+    EXPECT_FALSE(streamer.IsSectionResident(0, 1));
+    EXPECT_EQ(streamer.GetStats().SectionsPrefetched, 3u);
+
+    // A prefetched section is handed over once it comes into view
+    const auto next = SectionView(2, 1);
+    streamer.Update(next.first, next.second);
+    EXPECT_EQ(loads, 2);
+    EXPECT_TRUE(streamer.IsSectionLoaded(2, 1));
+}
+
+TEST_F(LevelStreamerTests, RejectsCorruptFiles) {
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        // First section entry's Offset now points past the end
+        file.seekp(sizeof(LevelFileHeader));
+        const uint64_t offset = 1ull << 40;
+        file.write(reinterpret_cast<const char*>(&offset), sizeof(offset));
+    }
+
+    LevelStreamer streamer;
+    EXPECT_FALSE(streamer.Open(path));
+    EXPECT_FALSE(streamer.IsOpen());
+}
+
+TEST_F(LevelStreamerTests, RejectsSectionCountThatWraps) {
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        // 2^59 sections: the table size, 2^59 * 32 bytes, wraps to 0
+        LevelFileHeader header;
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        header.SectionsX = 1u << 30;
+        header.SectionsY = 1u << 29;
+        file.seekp(0);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+
+    LevelStreamer streamer;
+    EXPECT_FALSE(streamer.Open(path));
+    EXPECT_FALSE(streamer.IsOpen());
+}
+
+TEST_F(LevelStreamerTests, RejectsSectionOffsetThatWraps) {
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        // Offset + Size wraps around to a small number that looks in bounds
+        file.seekp(sizeof(LevelFileHeader));
+        const uint64_t offset = UINT64_MAX - 7;
+        file.write(reinterpret_cast<const char*>(&offset), sizeof(offset));
+    }
+
+    LevelStreamer streamer;
+    EXPECT_FALSE(streamer.Open(path));
+    EXPECT_FALSE(streamer.IsOpen());
+}
+
+} // namespace
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include "physics/DynamicAABBTree.hpp"
+#include "physics/PhysicsWorld.hpp"
+#include "physics/SpatialHashBroadphase.hpp"
+#include <algorithm>
+#include <memory>
+#include <random>
+
+namespace {
+
+std::unique_ptr<Broadphase> MakeBroadphase(BroadphaseType type) {
+    if (type == BroadphaseType::AABBTree) {
+        return std::make_unique<DynamicAABBTree>();
+    }
+    return std::make_unique<SpatialHashBroadphase>();
+}
+
+AABB RandomBox(std::mt19937& rng) {
+    std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+    std::uniform_real_distribution<float> size(2.0f, 150.0f);
+    const glm::vec2 min{ position(rng), position(rng) };
+    return { min, min + glm::vec2(size(rng), size(rng)) };
+}
+
+class BroadphaseTests : public ::testing::TestWithParam<BroadphaseType> {};
+
+TEST_P(BroadphaseTests, MatchesBruteForceThroughMovesAndDestroys) {
+    std::unique_ptr<Broadphase> broadphase = MakeBroadphase(GetParam());
+    std::mt19937 rng(1234);
+
+    // Boxes indexed by user data; destroyed proxies are flagged dead
+    std::vector<AABB> boxes;
+    std::vector<Broadphase::ProxyId> proxies;
+    std::vector<bool> alive;
+    for (uint32_t i = 0; i < 300; ++i) {
+        boxes.push_back(RandomBox(rng));
+        proxies.push_back(broadphase->CreateProxy(boxes.back(), i));
+        alive.push_back(true);
+    }
+
+    std::vector<BroadphasePair> pairs;
+    for (int round = 0; round < 5; ++round) {
+        // Small drifts (mostly within cells and fat boxes) and a few teleports
+        std::uniform_real_distribution<float> drift(-6.0f, 6.0f);
+        for (uint32_t i = 0; i < boxes.size(); ++i) {
+            if (!alive[i]) continue;
+            if (i % 17 == static_cast<uint32_t>(round)) {
+                boxes[i] = RandomBox(rng);
+            } else {
+                const glm::vec2 offset{ drift(rng), drift(rng) };
+                boxes[i] = { boxes[i].Min + offset, boxes[i].Max + offset };
+            }
+            broadphase->MoveProxy(proxies[i], boxes[i]);
+        }
+        for (uint32_t i = round; i < boxes.size(); i += 23) {
+            if (alive[i]) {
+                broadphase->DestroyProxy(proxies[i]);
+                alive[i] = false;
+            }
+        }
+
+        std::vector<BroadphasePair> expected;
+        for (uint32_t i = 0; i < boxes.size(); ++i) {
+            for (uint32_t j = i + 1; j < boxes.size(); ++j) {
+                if (alive[i] && alive[j] && boxes[i].Overlaps(boxes[j])) {
+                    expected.push_back({ i, j });
+                }
+            }
+        }
+
+        broadphase->FindPairs(pairs);
+        std::sort(pairs.begin(), pairs.end());
+        EXPECT_EQ(pairs, expected) << "round " << round;
+
+        const AABB region = RandomBox(rng);
+        std::vector<uint32_t> found;
+        broadphase->QueryRegion(region, [&](uint32_t userData) { found.push_back(userData); });
+        std::sort(found.begin(), found.end());
+
+        std::vector<uint32_t> expectedFound;
+        for (uint32_t i = 0; i < boxes.size(); ++i) {
+            if (alive[i] && boxes[i].Overlaps(region)) {
+                expectedFound.push_back(i);
+            }
+        }
+        EXPECT_EQ(found, expectedFound) << "round " << round;
+    }
+
+    size_t aliveCount = std::count(alive.begin(), alive.end(), true);
+    EXPECT_EQ(broadphase->GetProxyCount(), aliveCount);
+}
+
+TEST_P(BroadphaseTests, QueryStopsEarly) {
+    std::unique_ptr<Broadphase> broadphase = MakeBroadphase(GetParam());
+    for (uint32_t i = 0; i < 10; ++i) {
+        broadphase->CreateProxy({ { 0.0f, 0.0f }, { 10.0f, 10.0f } }, i);
+    }
+
+    int visited = 0;
+    broadphase->QueryRegion({ { 1.0f, 1.0f }, { 2.0f, 2.0f } }, [&](uint32_t) {
+        ++visited;
+        return visited < 3;
+    });
+    EXPECT_EQ(visited, 3);
+}
+
+INSTANTIATE_TEST_SUITE_P(AllTypes, BroadphaseTests,
+    ::testing::Values(BroadphaseType::SpatialHash, BroadphaseType::AABBTree));
+
+TEST(DynamicAABBTreeTests, StaysBalancedForSortedInserts) {
+    DynamicAABBTree tree;
+    for (uint32_t i = 0; i < 1024; ++i) {
+        const float x = static_cast<float>(i) * 20.0f;
+        tree.CreateProxy({ { x, 0.0f }, { x + 10.0f, 10.0f } }, i);
+    }
+
+    // A degenerate (list-like) tree would be ~1000 deep
+    EXPECT_LE(tree.GetHeight(), 20);
+}
+
+TEST(PhysicsBroadphaseTests, PairsAndQueriesSurviveBroadphaseSwap) {
+    PhysicsWorld::Properties props;
+    props.Gravity = { 0.0f, 0.0f };
+    PhysicsWorld world(props);
+
+    BodyId a = world.CreateBody({ { 0.0f, 0.0f }, { 10.0f, 10.0f } });
+    BodyId b = world.CreateBody({ { 15.0f, 0.0f }, { 10.0f, 10.0f } });
+    BodyId c = world.CreateBody({ { 200.0f, 0.0f }, { 10.0f, 10.0f }, { -11700.0f, 0.0f } });
+    world.DestroyBody(world.CreateBody({ { 5.0f, 5.0f }, { 10.0f, 10.0f } }));
+
+    for (BroadphaseType type : { BroadphaseType::SpatialHash, BroadphaseType::AABBTree }) {
+        world.SetBroadphase(type);
+        EXPECT_EQ(world.GetBroadphaseType(), type);
+
+        world.SetPosition(c, { 200.0f, 0.0f });
+        const auto& pairs = world.FindBodyPairs();
+        ASSERT_EQ(pairs.size(), 1u);
+        EXPECT_TRUE((pairs[0].first == a && pairs[0].second == b) || (pairs[0].first == b && pairs[0].second == a));
+
+        // c moves onto a and b during the step; the proxies follow
+        world.Step(1.0f / 60.0f);
+        EXPECT_EQ(world.FindBodyPairs().size(), 3u);
+
+        std::vector<BodyId> found;
+        world.QueryRegion({ { 140.0f, -5.0f }, { 160.0f, 5.0f } }, [&](BodyId body) { found.push_back(body); });
+        EXPECT_TRUE(found.empty());
+        world.QueryRegion({ { -8.0f, -5.0f }, { -2.0f, 5.0f } }, [&](BodyId body) { found.push_back(body); });
+        ASSERT_EQ(found.size(), 2u);
+        EXPECT_TRUE(std::find(found.begin(), found.end(), a) != found.end());
+        EXPECT_TRUE(std::find(found.begin(), found.end(), c) != found.end());
+    }
+}
+
+} // namespace
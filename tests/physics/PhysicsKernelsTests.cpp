@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+#include "physics/PhysicsKernels.hpp"
+#include "physics/PhysicsWorld.hpp"
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+
+// Restores the detected level when a test that forces one finishes
+class PhysicsKernelsTests : public ::testing::Test {
+protected:
+    void TearDown() override {
+        PhysicsKernels::SetActiveLevel(PhysicsKernels::GetSupportedLevel());
+    }
+
+    static std::vector<SimdLevel> SupportedLevels() {
+        std::vector<SimdLevel> levels;
+        for (SimdLevel level : { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2 }) {
+            if (level <= PhysicsKernels::GetSupportedLevel()) {
+                levels.push_back(level);
+            }
+        }
+        return levels;
+    }
+};
+
+std::vector<float> RandomFloats(std::mt19937& rng, size_t count, float min, float max) {
+    std::uniform_real_distribution<float> distribution(min, max);
+    std::vector<float> values(count);
+    for (float& value : values) {
+        value = distribution(rng);
+    }
+    return values;
+}
+
+bool BitEqual(const std::vector<float>& a, const std::vector<float>& b) {
+    return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(float)) == 0;
+}
+
+TEST_F(PhysicsKernelsTests, IntegrationIsBitIdenticalAtEveryLevel) {
+    // Odd count so every level runs its scalar tail too
+    constexpr size_t Count = 1003;
+    std::mt19937 rng(42);
+    const std::vector<float> velocityX = RandomFloats(rng, Count, -500.0f, 500.0f);
+    const std::vector<float> velocityY = RandomFloats(rng, Count, -2500.0f, 500.0f);
+    const std::vector<float> gravityScale = RandomFloats(rng, Count, 0.0f, 2.0f);
+    const std::vector<float> positionX = RandomFloats(rng, Count, -1e4f, 1e4f);
+    const std::vector<float> positionY = RandomFloats(rng, Count, -1e4f, 1e4f);
+
+    auto run = [&](SimdLevel level) {
+        EXPECT_EQ(PhysicsKernels::SetActiveLevel(level), level);
+        std::vector<float> vx = velocityX, vy = velocityY, px = positionX, py = positionY;
+        PhysicsKernels::IntegrateVelocities(vx.data(), vy.data(), gravityScale.data(), Count,
+                                            glm::vec2(3.0f, -980.0f) / 60.0f, 2000.0f);
+        PhysicsKernels::IntegratePositions(px.data(), py.data(), vx.data(), vy.data(), Count, 1.0f / 60.0f);
+        return std::vector<std::vector<float>>{ vx, vy, px, py };
+    };
+
+    const auto expected = run(SimdLevel::Scalar);
+    for (float value : expected[1]) {
+        ASSERT_GE(value, -2000.0f);
+    }
+
+    for (SimdLevel level : SupportedLevels()) {
+        const auto actual = run(level);
+        for (size_t array = 0; array < expected.size(); ++array) {
+            EXPECT_TRUE(BitEqual(actual[array], expected[array]))
+                << PhysicsKernels::GetLevelName(level) << " array " << array;
+        }
+    }
+}
+
+TEST_F(PhysicsKernelsTests, FindOverlapsMatchesAABBOverlaps) {
+    constexpr size_t Count = 517;
+    std::mt19937 rng(7);
+    const std::vector<float> minX = RandomFloats(rng, Count, -100.0f, 100.0f);
+    std::vector<float> minY = RandomFloats(rng, Count, -100.0f, 100.0f);
+    std::vector<float> maxX = RandomFloats(rng, Count, 0.0f, 30.0f);
+    std::vector<float> maxY = RandomFloats(rng, Count, 0.0f, 30.0f);
+    for (size_t i = 0; i < Count; ++i) {
+        maxX[i] += minX[i];
+        maxY[i] += minY[i];
+    }
+
+    // Boxes exactly touching the query do not overlap
+    const AABB query{ { -20.0f, -10.0f }, { 35.0f, 40.0f } };
+    maxX[3] = query.Min.x;
+    minY[3] = -5.0f;
+    maxY[3] = 5.0f;
+
+    std::vector<uint32_t> expected;
+    for (uint32_t i = 0; i < Count; ++i) {
+        if (query.Overlaps({ { minX[i], minY[i] }, { maxX[i], maxY[i] } })) {
+            expected.push_back(i);
+        }
+    }
+    ASSERT_FALSE(expected.empty());
+
+    for (SimdLevel level : SupportedLevels()) {
+        PhysicsKernels::SetActiveLevel(level);
+        std::vector<uint32_t> indices(Count);
+        const size_t found = PhysicsKernels::FindOverlaps(query, minX.data(), minY.data(), maxX.data(), maxY.data(),
+                                                          Count, indices.data());
+        indices.resize(found);
+        EXPECT_EQ(indices, expected) << PhysicsKernels::GetLevelName(level);
+    }
+}
+
+TEST_F(PhysicsKernelsTests, OverlapMaskMatchesFindOverlaps) {
+    // Whole words plus a partial one
+    constexpr size_t Count = 2 * 32 + 13;
+    std::mt19937 rng(11);
+    const std::vector<float> minX = RandomFloats(rng, Count, -100.0f, 100.0f);
+    const std::vector<float> minY = RandomFloats(rng, Count, -100.0f, 100.0f);
+    std::vector<float> maxX = RandomFloats(rng, Count, 0.0f, 30.0f);
+    std::vector<float> maxY = RandomFloats(rng, Count, 0.0f, 30.0f);
+    for (size_t i = 0; i < Count; ++i) {
+        maxX[i] += minX[i];
+        maxY[i] += minY[i];
+    }
+    const AABB query{ { -40.0f, -30.0f }, { 25.0f, 60.0f } };
+
+    std::vector<uint32_t> expected(PhysicsKernels::GetMaskWordCount(Count), 0);
+    std::vector<uint32_t> indices(Count);
+    const size_t found = PhysicsKernels::FindOverlaps(query, minX.data(), minY.data(), maxX.data(), maxY.data(),
+                                                      Count, indices.data());
+    ASSERT_GT(found, 0u);
+    for (size_t i = 0; i < found; ++i) {
+        expected[indices[i] / 32] |= 1u << (indices[i] % 32);
+    }
+
+    for (SimdLevel level : SupportedLevels()) {
+        PhysicsKernels::SetActiveLevel(level);
+        std::vector<uint32_t> mask(expected.size(), 0xFFFFFFFFu);
+        PhysicsKernels::OverlapMask(query, minX.data(), minY.data(), maxX.data(), maxY.data(), Count, mask.data());
+        EXPECT_EQ(mask, expected) << PhysicsKernels::GetLevelName(level);
+    }
+}
+
+TEST_F(PhysicsKernelsTests, PhysicsStepIsIdenticalAtEveryLevel) {
+    auto simulate = [](SimdLevel level) {
+        PhysicsKernels::SetActiveLevel(level);
+        PhysicsWorld world;
+        world.AddStatic({ { -500.0f, -50.0f }, { 500.0f, 0.0f } });
+        world.AddStatic({ { -100.0f, 60.0f }, { 100.0f, 64.0f } }, StaticType::OneWay);
+        world.AddStatic({ { 200.0f, 0.0f }, { 220.0f, 300.0f } });
+        // Enough small tiles in one grid cell for the overlap kernel to run
+        for (int i = 0; i < 12; ++i) {
+            const float x = -120.0f + i * 10.0f;
+            world.AddStatic({ { x, 100.0f }, { x + 8.0f, 108.0f } });
+        }
+
+        std::mt19937 rng(99);
+        std::uniform_real_distribution<float> position(-300.0f, 300.0f);
+        std::uniform_real_distribution<float> speed(-300.0f, 300.0f);
+        std::vector<BodyId> bodies;
+        for (int i = 0; i < 101; ++i) {
+            bodies.push_back(world.CreateBody({ { position(rng), position(rng) + 350.0f }, { 5.0f, 7.0f },
+                                                { speed(rng), speed(rng) } }));
+        }
+        for (int step = 0; step < 120; ++step) {
+            world.Step(1.0f / 60.0f);
+        }
+
+        std::vector<float> state;
+        for (BodyId body : bodies) {
+            state.push_back(world.GetPosition(body).x);
+            state.push_back(world.GetPosition(body).y);
+            state.push_back(world.GetVelocity(body).x);
+            state.push_back(world.GetVelocity(body).y);
+        }
+        return state;
+    };
+
+    const std::vector<float> expected = simulate(SimdLevel::Scalar);
+    for (SimdLevel level : SupportedLevels()) {
+        EXPECT_TRUE(BitEqual(simulate(level), expected)) << PhysicsKernels::GetLevelName(level);
+    }
+}
+
+} // namespace
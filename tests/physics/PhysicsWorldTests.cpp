@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include "physics/PhysicsWorld.hpp"
+
+namespace {
+
+constexpr float Step = 1.0f / 60.0f;
+
+void RunSteps(PhysicsWorld& world, int steps) {
+    for (int i = 0; i < steps; ++i) {
+        world.Step(Step);
+    }
+}
+
+TEST(PhysicsWorldTests, BodyFallsAndRestsOnGround) {
+    PhysicsWorld world;
+    world.AddStatic({ { -1000.0f, -100.0f }, { 1000.0f, 0.0f } });
+    BodyId body = world.CreateBody({ { 0.0f, 200.0f }, { 8.0f, 8.0f } });
+
+    RunSteps(world, 120);
+    EXPECT_FLOAT_EQ(world.GetPosition(body).y, 8.0f);
+    EXPECT_FLOAT_EQ(world.GetVelocity(body).y, 0.0f);
+    EXPECT_TRUE(world.IsGrounded(body));
+
+    // Stays put and grounded while resting
+    RunSteps(world, 60);
+    EXPECT_FLOAT_EQ(world.GetPosition(body).y, 8.0f);
+    EXPECT_TRUE(world.IsGrounded(body));
+}
+
+TEST(PhysicsWorldTests, FastBodyDoesNotTunnelThroughThinPlatform) {
+    PhysicsWorld world;
+    world.AddStatic({ { -50.0f, 0.0f }, { 50.0f, 1.0f } });
+
+    // Moves 80+ units per step against a 1 unit thick platform
+    BodyId body = world.CreateBody({ { 0.0f, 300.0f }, { 4.0f, 4.0f }, { 0.0f, -4800.0f } });
+    RunSteps(world, 10);
+    EXPECT_FLOAT_EQ(world.GetPosition(body).y, 5.0f);
+    EXPECT_TRUE(world.IsGrounded(body));
+}
+
+TEST(PhysicsWorldTests, OneWayPlatformOnlyStopsFromAbove) {
+    PhysicsWorld world;
+    world.AddStatic({ { -50.0f, 100.0f }, { 50.0f, 110.0f } }, StaticType::OneWay);
+
+    BodyId rising = world.CreateBody({ { 0.0f, 50.0f }, { 4.0f, 4.0f }, { 0.0f, 900.0f }, 0.0f });
+    RunSteps(world, 10);
+    EXPECT_GT(world.GetPosition(rising).y, 110.0f);
+    EXPECT_EQ(world.GetContacts(rising) & ContactCeiling, 0);
+
+    BodyId falling = world.CreateBody({ { 0.0f, 200.0f }, { 4.0f, 4.0f } });
+    RunSteps(world, 120);
+    EXPECT_FLOAT_EQ(world.GetPosition(falling).y, 114.0f);
+    EXPECT_TRUE(world.IsGrounded(falling));
+}
+
+TEST(PhysicsWorldTests, BodySlidesAlongWallsAndFloorSeams) {
+    PhysicsWorld world;
+    // Floor made of separate tiles, and a wall at x = 200
+    for (int i = 0; i < 10; ++i) {
+        world.AddStatic({ { i * 32.0f, -32.0f }, { (i + 1) * 32.0f, 0.0f } });
+    }
+    world.AddStatic({ { 200.0f, 0.0f }, { 232.0f, 200.0f } });
+
+    BodyId body = world.CreateBody({ { 16.0f, 8.0f }, { 8.0f, 8.0f } });
+    for (int i = 0; i < 120; ++i) {
+        world.SetVelocity(body, { 300.0f, world.GetVelocity(body).y });
+        world.Step(Step);
+    }
+
+    // Crossed every seam without snagging and stopped flush against the wall
+    EXPECT_FLOAT_EQ(world.GetPosition(body).x, 192.0f);
+    EXPECT_FLOAT_EQ(world.GetPosition(body).y, 8.0f);
+    EXPECT_TRUE(world.GetContacts(body) & ContactWallRight);
+    EXPECT_TRUE(world.GetContacts(body) & ContactGround);
+}
+
+TEST(PhysicsWorldTests, RemovedStaticStopsColliding) {
+    PhysicsWorld world;
+    const uint32_t floor = world.AddStatic({ { -1000.0f, -100.0f }, { 1000.0f, 0.0f } });
+    world.AddStatic({ { -1000.0f, -500.0f }, { 1000.0f, -400.0f } });
+    BodyId body = world.CreateBody({ { 0.0f, 50.0f }, { 8.0f, 8.0f } });
+    RunSteps(world, 60);
+    ASSERT_FLOAT_EQ(world.GetPosition(body).y, 8.0f);
+
+    world.RemoveStatic(floor);
+    EXPECT_EQ(world.GetStaticCount(), 1u);
+    RunSteps(world, 120);
+    EXPECT_FLOAT_EQ(world.GetPosition(body).y, -392.0f);
+
+    // The id is free for the next collider
+    EXPECT_EQ(world.AddStatic({ { 0.0f, 0.0f }, { 1.0f, 1.0f } }), floor);
+    EXPECT_EQ(world.GetStaticCount(), 2u);
+}
+
+TEST(PhysicsWorldTests, OverlappingBodyIsPushedOut) {
+    PhysicsWorld world;
+    world.AddStatic({ { 0.0f, 0.0f }, { 100.0f, 100.0f } });
+
+    // Teleported just inside the right edge
+    BodyId body = world.CreateBody({ { 98.0f, 50.0f }, { 4.0f, 4.0f }, { 0.0f, 0.0f }, 0.0f });
+    world.Step(Step);
+    EXPECT_FLOAT_EQ(world.GetPosition(body).x, 104.0f);
+    EXPECT_TRUE(world.GetContacts(body) & ContactWallLeft);
+}
+
+TEST(PhysicsWorldTests, DestroyingBodiesKeepsTheOthers) {
+    PhysicsWorld world;
+    BodyId a = world.CreateBody({ { 1.0f, 0.0f }, { 1.0f, 1.0f } });
+    BodyId b = world.CreateBody({ { 2.0f, 0.0f }, { 1.0f, 1.0f } });
+    BodyId c = world.CreateBody({ { 3.0f, 0.0f }, { 1.0f, 1.0f } });
+
+    world.DestroyBody(a);
+    EXPECT_FALSE(world.IsValid(a));
+    EXPECT_EQ(world.GetBodyCount(), 2u);
+    EXPECT_FLOAT_EQ(world.GetPosition(b).x, 2.0f);
+    EXPECT_FLOAT_EQ(world.GetPosition(c).x, 3.0f);
+
+    BodyId d = world.CreateBody({ { 4.0f, 0.0f }, { 1.0f, 1.0f } });
+    EXPECT_EQ(d.Index, a.Index);
+    EXPECT_FALSE(world.IsValid(a));
+    EXPECT_FLOAT_EQ(world.GetPosition(d).x, 4.0f);
+}
+
+} // namespace
@@ -0,0 +1,144 @@
+// Offline texture atlas packer.
+//
+//   AtlasPacker <output.atlas> [--page-size N] [--padding N] <image>...
+//
+// Packs the images into <output>_N.tga pages next to the index. Sprites are
+// named after their file name without directory or extension.
+#include "graphics/AtlasBuilder.hpp"
+#include "core/Logger.hpp"
+#include <stb_image.h>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::string GetStem(const std::string& path) {
+    const size_t slash = path.find_last_of("/\\");
+    const size_t start = slash == std::string::npos ? 0 : slash + 1;
+    const size_t dot = path.find_last_of('.');
+    const size_t end = (dot == std::string::npos || dot < start) ? path.size() : dot;
+    return path.substr(start, end - start);
+}
+
+std::string GetFileName(const std::string& path) {
+    const size_t slash = path.find_last_of("/\\");
+    return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+
+// Uncompressed 32-bit TGA with a bottom-left origin, matching the flipped rows
+// the engine loads with. stb_image reads it back without any extra work.
+bool WriteTGA(const std::string& path, const AtlasBuilder::Page& page) {
+    std::ofstream file(path, std::ios::binary);
+    if (!file) return false;
+
+    uint8_t header[18] = {};
+    header[2] = 2;  // Uncompressed true-color
+    header[12] = static_cast<uint8_t>(page.Width & 0xFF);
+    header[13] = static_cast<uint8_t>(page.Width >> 8);
+    header[14] = static_cast<uint8_t>(page.Height & 0xFF);
+    header[15] = static_cast<uint8_t>(page.Height >> 8);
+    header[16] = 32;
+    header[17] = 8;  // 8 alpha bits, bottom-left origin
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+    // TGA stores BGRA
+    std::vector<uint8_t> row(static_cast<size_t>(page.Width) * 4);
+    for (int y = 0; y < page.Height; ++y) {
+        const uint8_t* src = &page.Pixels[static_cast<size_t>(y) * page.Width * 4];
+        for (int x = 0; x < page.Width; ++x) {
+            row[x * 4 + 0] = src[x * 4 + 2];
+            row[x * 4 + 1] = src[x * 4 + 1];
+            row[x * 4 + 2] = src[x * 4 + 0];
+            row[x * 4 + 3] = src[x * 4 + 3];
+        }
+        file.write(reinterpret_cast<const char*>(row.data()), static_cast<std::streamsize>(row.size()));
+    }
+    return static_cast<bool>(file);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Logger::Init();
+
+    if (argc < 3) {
+        LOG_ERROR("Usage: {} <output.atlas> [--page-size N] [--padding N] <image>...", argv[0]);
+        return 1;
+    }
+
+    const std::string output = argv[1];
+    int pageSize = 2048;
+    int padding = 1;
+    std::vector<std::string> inputs;
+
+    for (int i = 2; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--page-size") == 0 && i + 1 < argc) {
+            pageSize = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--padding") == 0 && i + 1 < argc) {
+            padding = std::atoi(argv[++i]);
+        } else {
+            inputs.push_back(argv[i]);
+        }
+    }
+
+    // TGA dimensions are 16-bit
+    if (pageSize <= 0 || pageSize > 65535 || padding < 0 || inputs.empty()) {
+        LOG_ERROR("Invalid page size, padding or empty image list");
+        return 1;
+    }
+
+    stbi_set_flip_vertically_on_load(true);
+    std::vector<AtlasBuilder::Image> images;
+    int result = 0;
+    for (const std::string& input : inputs) {
+        AtlasBuilder::Image image;
+        int channels = 0;
+        image.Name = GetStem(input);
+        image.Pixels = stbi_load(input.c_str(), &image.Width, &image.Height, &channels, 4);
+        if (!image.Pixels) {
+            LOG_ERROR("Failed to load image: {}", input);
+            result = 1;
+            break;
+        }
+        images.push_back(std::move(image));
+    }
+
+    AtlasBuilder builder(pageSize, padding);
+    if (result == 0 && !builder.Build(images)) {
+        result = 1;
+    }
+
+    for (AtlasBuilder::Image& image : images) {
+        stbi_image_free(const_cast<unsigned char*>(image.Pixels));
+    }
+
+    if (result == 0) {
+        const size_t dot = output.find_last_of('.');
+        const std::string base = (dot == std::string::npos) ? output : output.substr(0, dot);
+
+        std::vector<std::string> pagePaths;
+        for (size_t i = 0; i < builder.GetPages().size() && result == 0; ++i) {
+            const std::string pagePath = base + "_" + std::to_string(i) + ".tga";
+            if (!WriteTGA(pagePath, builder.GetPages()[i])) {
+                LOG_ERROR("Failed to write atlas page: {}", pagePath);
+                result = 1;
+            }
+            // The index stores paths relative to its own directory
+            pagePaths.push_back(GetFileName(pagePath));
+        }
+
+        if (result == 0 && !builder.WriteIndex(output, pagePaths)) {
+            result = 1;
+        }
+        if (result == 0) {
+            LOG_INFO("Wrote {} with {} regions on {} page(s)", output, builder.GetRegions().size(), builder.GetPages().size());
+        }
+    }
+
+    Logger::Shutdown();
+    return result;
+}
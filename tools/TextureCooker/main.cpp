@@ -0,0 +1,67 @@
+// Offline texture cooker.
+//
+//   TextureCooker [--lz4] <input.png> [output.ptex]
+//
+// Decodes the image once, builds the full mip chain and writes it in the
+// engine's cooked format so loading is a straight upload from a mapping.
+#include "graphics/TextureCooker.hpp"
+#include "graphics/TextureFormat.hpp"
+#include "core/Logger.hpp"
+#include <stb_image.h>
+#include <cstring>
+#include <string>
+
+int main(int argc, char* argv[]) {
+    Logger::Init();
+
+    bool compress = false;
+    std::string input;
+    std::string output;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--lz4") == 0) {
+            compress = true;
+        } else if (input.empty()) {
+            input = argv[i];
+        } else if (output.empty()) {
+            output = argv[i];
+        }
+    }
+
+    if (input.empty()) {
+        LOG_ERROR("Usage: {} [--lz4] <input.png> [output{}]", argv[0], TextureFormat::Extension);
+        return 1;
+    }
+    if (output.empty()) {
+        const size_t dot = input.find_last_of('.');
+        output = (dot == std::string::npos ? input : input.substr(0, dot)) + TextureFormat::Extension;
+    }
+
+    // Same orientation the runtime loader uses
+    stbi_set_flip_vertically_on_load(true);
+    int width = 0, height = 0, channels = 0;
+    unsigned char* pixels = stbi_load(input.c_str(), &width, &height, &channels, 0);
+    if (!pixels) {
+        LOG_ERROR("Failed to load image: {}", input);
+        return 1;
+    }
+
+    // Two-channel images have no matching GL format in the engine; widen them
+    if (channels == 2) {
+        stbi_image_free(pixels);
+        pixels = stbi_load(input.c_str(), &width, &height, &channels, 4);
+        channels = 4;
+    }
+
+    auto mips = TextureCooker::BuildMipChain(pixels, width, height, channels);
+    stbi_image_free(pixels);
+
+    if (!TextureCooker::Write(output, mips, channels, compress)) {
+        return 1;
+    }
+
+    LOG_INFO("Cooked {} -> {} ({}x{}, {} channel(s), {} mip level(s){})", input, output, width, height,
+             channels, mips.size(), compress && TextureCooker::IsCompressionAvailable() ? ", LZ4" : "");
+    Logger::Shutdown();
+    return 0;
+}